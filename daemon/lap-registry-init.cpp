@@ -38,6 +38,11 @@ void signal_handler(int signal)
             g_initializer->Shutdown();
         }
     }
+    else if (signal == SIGUSR1 && g_initializer != nullptr)
+    {
+        // Operator-triggered online resize: double the slot count
+        g_initializer->RequestResize(g_initializer->GetSlotCount() * 2);
+    }
 }
 
 // Parse command-line arguments
@@ -45,8 +50,27 @@ struct Config
 {
     RegistryType type = RegistryType::QM;
     String socket_path = "/run/lap/registry_qm.sock";
+    uint32_t reap_interval_ms = RegistryInitializer::DEFAULT_REAP_INTERVAL_MS;
+    RegistryMemoryOptions memory;
+    uint32_t slots = RegistryConfig::MAX_SLOTS;
+    uint32_t max_slots = RegistryConfig::MAX_SLOTS_LIMIT;
 };
 
+// Parse a slot count option value (2..MAX_SLOTS_LIMIT)
+static bool parse_slot_count(const char* text, uint32_t& slots)
+{
+    char* end = nullptr;
+    unsigned long value = strtoul(text, &end, 10);
+    if (end == text || *end != '\0' || value < 2 || value > RegistryConfig::MAX_SLOTS_LIMIT)
+    {
+        LAP_COM_LOG_ERROR << "Invalid slot count: " << text 
+                          << " (must be 2.." << RegistryConfig::MAX_SLOTS_LIMIT << ")";
+        return false;
+    }
+    slots = static_cast<uint32_t>(value);
+    return true;
+}
+
 bool parse_args(int argc, char** argv, Config& config)
 {
     for (int i = 1; i < argc; ++i)
@@ -74,6 +98,40 @@ bool parse_args(int argc, char** argv, Config& config)
         {
             config.socket_path = arg + 9;
         }
+        else if (strncmp(arg, "--reap-interval-ms=", 19) == 0)
+        {
+            char* end = nullptr;
+            unsigned long value = strtoul(arg + 19, &end, 10);
+            if (end == arg + 19 || *end != '\0' || value > 60000)
+            {
+                LAP_COM_LOG_ERROR << "Invalid reap interval: " << (arg + 19) << " (must be 0..60000)";
+                return false;
+            }
+            config.reap_interval_ms = static_cast<uint32_t>(value);
+        }
+        else if (strncmp(arg, "--slots=", 8) == 0)
+        {
+            if (!parse_slot_count(arg + 8, config.slots))
+            {
+                return false;
+            }
+        }
+        else if (strncmp(arg, "--max-slots=", 12) == 0)
+        {
+            if (!parse_slot_count(arg + 12, config.max_slots))
+            {
+                return false;
+            }
+        }
+        else if (strncmp(arg, "--memory=", 9) == 0)
+        {
+            if (!RegistryMemoryOptions::Parse(arg + 9, config.memory))
+            {
+                LAP_COM_LOG_ERROR << "Invalid memory options: " << (arg + 9)
+                                  << " (comma-separated list of hugepages, populate, mlock)";
+                return false;
+            }
+        }
         else if (strcmp(arg, "--help") == 0 || strcmp(arg, "-h") == 0)
         {
             std::cout << "Usage: " << argv[0] << " [options]\n"
@@ -81,6 +139,14 @@ bool parse_args(int argc, char** argv, Config& config)
                       << "  --type=<qm|asil>        Registry type (default: qm)\n"
                       << "  --socket=<path>         Unix domain socket path\n"
                       << "                          (default: /run/lap/registry_qm.sock)\n"
+                      << "  --reap-interval-ms=<n>  Crashed-owner reaper poll interval\n"
+                      << "                          (default: 100, 0 disables reaping;\n"
+                      << "                          growth and SIGUSR1 still work)\n"
+                      << "  --slots=<n>             Initial slots per registry (default: 1024)\n"
+                      << "  --max-slots=<n>         Online growth limit, equal to --slots\n"
+                      << "                          disables growth (default: 65536)\n"
+                      << "  --memory=<opts>         Registry memory backing, comma-separated:\n"
+                      << "                          hugepages,populate,mlock (default: none)\n"
                       << "  --help, -h              Show this help message\n"
                       << "\n"
                       << "Example:\n"
@@ -114,11 +180,15 @@ int main(int argc, char** argv)
     // Setup signal handlers
     signal(SIGINT, signal_handler);
     signal(SIGTERM, signal_handler);
+    signal(SIGUSR1, signal_handler);  // Grow registry (online resize)
     signal(SIGPIPE, SIG_IGN);  // Ignore broken pipe
     
     // Create initializer
     RegistryInitializer initializer(config.type, config.socket_path);
     g_initializer = &initializer;
+    initializer.SetReapInterval(config.reap_interval_ms);
+    initializer.SetMemoryOptions(config.memory);
+    initializer.SetSlotCount(config.slots, config.max_slots);
     
     // Initialize registry (create memfd, initialize slots, seal memory)
     auto init_result = initializer.Initialize();
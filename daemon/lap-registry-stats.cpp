@@ -0,0 +1,234 @@
+/**
+ * @file        lap-registry-stats.cpp
+ * @author      LightAP Development Team
+ * @brief       Registry statistics CLI - prints the shared counters of a registry memfd
+ * @date        2025-11-20
+ * @details     Fetches the registry memfd from lap-registry-init (same UDS socket as
+ *              every client), maps it and prints the statistics region: totals once,
+ *              or per-interval deltas to correlate discovery latency spikes with
+ *              writer contention. Read-only with respect to the registry.
+ * @copyright   Copyright (c) 2025
+ * @usage       /usr/local/bin/lap-registry-stats --socket=/run/lap/registry_qm.sock --interval-ms=1000
+ */
+
+#include "SharedMemoryRegistry.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <atomic>
+#include <memory>
+#include <thread>
+
+using namespace lap::com::registry;
+using lap::core::String;
+
+// Global stop flag (SIGINT / SIGTERM end interval mode)
+static std::atomic<bool> g_stop{false};
+
+void signal_handler(int signal)
+{
+    if (signal == SIGINT || signal == SIGTERM)
+    {
+        g_stop.store(true, std::memory_order_release);
+    }
+}
+
+// Parse command-line arguments
+struct Config
+{
+    RegistryType type = RegistryType::QM;
+    String socket_path = "/run/lap/registry_qm.sock";
+    uint32_t interval_ms = 0;  // 0 = print totals once
+    uint32_t count = 0;        // 0 = until interrupted
+};
+
+// Parse an unsigned option value (0..max)
+static bool parse_uint(const char* name, const char* text, uint32_t max, uint32_t& value)
+{
+    char* end = nullptr;
+    unsigned long parsed = strtoul(text, &end, 10);
+    if (end == text || *end != '\0' || parsed > max)
+    {
+        std::fprintf(stderr, "Invalid %s: %s (must be 0..%u)\n", name, text, max);
+        return false;
+    }
+    value = static_cast<uint32_t>(parsed);
+    return true;
+}
+
+bool parse_args(int argc, char** argv, Config& config)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const char* arg = argv[i];
+
+        if (strncmp(arg, "--type=", 7) == 0)
+        {
+            const char* type_str = arg + 7;
+            if (strcmp(type_str, "qm") == 0)
+            {
+                config.type = RegistryType::QM;
+            }
+            else if (strcmp(type_str, "asil") == 0)
+            {
+                config.type = RegistryType::ASIL;
+            }
+            else
+            {
+                std::fprintf(stderr, "Invalid registry type: %s (must be 'qm' or 'asil')\n", type_str);
+                return false;
+            }
+        }
+        else if (strncmp(arg, "--socket=", 9) == 0)
+        {
+            config.socket_path = arg + 9;
+        }
+        else if (strncmp(arg, "--interval-ms=", 14) == 0)
+        {
+            if (!parse_uint("interval", arg + 14, 3600000, config.interval_ms))
+            {
+                return false;
+            }
+        }
+        else if (strncmp(arg, "--count=", 8) == 0)
+        {
+            if (!parse_uint("count", arg + 8, UINT32_MAX, config.count))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            std::printf("Usage: %s [options]\n"
+                        "Options:\n"
+                        "  --type=<qm|asil>        Registry type (default: qm)\n"
+                        "  --socket=<path>         lap-registry-init socket\n"
+                        "                          (default: /run/lap/registry_qm.sock)\n"
+                        "  --interval-ms=<n>       Print deltas every n ms (default: 0,\n"
+                        "                          print totals once)\n"
+                        "  --count=<n>             Stop after n intervals (default: 0,\n"
+                        "                          until interrupted)\n"
+                        "  --help, -h              Show this help message\n",
+                        argv[0]);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Totals, one "name value" line per counter
+static void print_totals(const RegistryStats& stats)
+{
+    std::printf("slot_count        %u\n"
+                "live_slots        %u\n"
+                "generation        %u\n"
+                "epoch             %u\n"
+                "registrations     %" PRIu64 "\n"
+                "unregistrations   %" PRIu64 "\n"
+                "reclaims          %" PRIu64 "\n"
+                "heartbeats        %" PRIu64 "\n"
+                "reader_retries    %" PRIu64 "\n"
+                "reader_failures   %" PRIu64 "\n"
+                "max_retry_streak  %" PRIu64 "\n"
+                "writer_waits      %" PRIu64 "\n",
+                stats.slot_count, stats.live_slots, stats.generation, stats.epoch,
+                stats.registrations, stats.unregistrations, stats.reclaims, stats.heartbeats,
+                stats.reader_retries, stats.reader_failures, stats.max_retry_streak, stats.writer_waits);
+}
+
+// One row of per-interval deltas (max_retry_streak is the running maximum)
+static void print_delta(const RegistryStats& prev, const RegistryStats& now)
+{
+    std::printf("%6u %6u %8" PRIu64 " %8" PRIu64 " %8" PRIu64 " %10" PRIu64 " %10" PRIu64 " %8" PRIu64
+                " %8" PRIu64 " %8" PRIu64 "\n",
+                now.live_slots, now.generation - prev.generation,
+                now.registrations - prev.registrations,
+                now.unregistrations - prev.unregistrations,
+                now.reclaims - prev.reclaims,
+                now.heartbeats - prev.heartbeats,
+                now.reader_retries - prev.reader_retries,
+                now.reader_failures - prev.reader_failures,
+                now.max_retry_streak,
+                now.writer_waits - prev.writer_waits);
+    std::fflush(stdout);
+}
+
+int main(int argc, char** argv)
+{
+    Config config;
+    if (!parse_args(argc, argv, config))
+    {
+        return EXIT_FAILURE;
+    }
+
+    signal(SIGINT, signal_handler);
+    signal(SIGTERM, signal_handler);
+
+    // The registry is re-fetched from the daemon after an online resize
+    std::unique_ptr<SingleRegistry> registry;
+    auto attach = [&config, &registry]() -> bool {
+        registry = std::make_unique<SingleRegistry>(config.type);
+        auto result = registry->InitializeFromSocket(config.socket_path);
+        if (!result.HasValue())
+        {
+            std::fprintf(stderr, "Cannot attach to %s (error %d)\n", config.socket_path.c_str(),
+                         static_cast<int>(result.Error().Value()));
+            return false;
+        }
+        return true;
+    };
+
+    if (!attach())
+    {
+        return EXIT_FAILURE;
+    }
+
+    auto stats = registry->GetStats();
+    if (!stats.HasValue())
+    {
+        return EXIT_FAILURE;
+    }
+
+    if (config.interval_ms == 0)
+    {
+        print_totals(stats.Value());
+        return EXIT_SUCCESS;
+    }
+
+    std::printf("#  live    gen      reg    unreg  reclaim  heartbeat    retries  failure   streak    waits\n");
+    RegistryStats prev = stats.Value();
+    for (uint32_t interval = 0; config.count == 0 || interval < config.count; ++interval)
+    {
+        // Sleep in short steps so SIGINT ends the loop promptly
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(config.interval_ms);
+        while (!g_stop.load(std::memory_order_acquire) && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(std::min<uint32_t>(config.interval_ms, 50)));
+        }
+        if (g_stop.load(std::memory_order_acquire))
+        {
+            break;
+        }
+
+        if (registry->IsRetired() && !attach())
+        {
+            return EXIT_FAILURE;
+        }
+
+        stats = registry->GetStats();
+        if (!stats.HasValue())
+        {
+            return EXIT_FAILURE;
+        }
+        print_delta(prev, stats.Value());
+        prev = stats.Value();
+    }
+
+    return EXIT_SUCCESS;
+}
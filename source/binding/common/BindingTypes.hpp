@@ -20,6 +20,7 @@
 #ifndef LAP_COM_BINDING_TYPES_HPP
 #define LAP_COM_BINDING_TYPES_HPP
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 
@@ -55,6 +56,23 @@ namespace binding
               last_error_message("OK") {}
     };
 
+    /**
+     * @brief Transport-owned event payload buffer (zero-copy send/receive)
+     * @note Send side: obtained from ITransportBinding::LoanEvent() and given back
+     *       with either SendLoanedEvent() or ReleaseLoanedEvent(), exactly once.
+     *       Receive side: delivered to a LoanedEventCallback (payload read-only)
+     *       and given back with ReleaseReceivedEvent(), exactly once.
+     */
+    struct EventLoan
+    {
+        uint64_t service_id{0};         ///< AUTOSAR service ID
+        uint64_t instance_id{0};        ///< AUTOSAR instance ID
+        uint32_t event_id{0};           ///< Event identifier
+        void* payload{nullptr};         ///< Writable payload in transport memory
+        size_t size{0};                 ///< Payload size in bytes
+        void* handle{nullptr};          ///< Binding-specific loan handle
+    };
+
     /**
      * @brief Transport performance metrics
      * @note Used by ITransportBinding::GetMetrics() for monitoring
@@ -19,12 +19,16 @@
  * <table>
  * <tr><th>Date        <th>Version  <th>Author          <th>Description
  * <tr><td>2025/11/21  <td>1.0      <td>LightAP Team    <td>Initial transport binding interface
+ * <tr><td>2025/11/23  <td>1.1      <td>LightAP Team    <td>Loaned event payloads (zero-copy send)
+ * <tr><td>2025/11/24  <td>1.2      <td>LightAP Team    <td>Borrowed event payloads (zero-copy receive)
+ * <tr><td>2025/11/24  <td>1.3      <td>LightAP Team    <td>Borrow limit of zero-copy subscribers
  * </table>
  */
 #ifndef LAP_COM_BINDING_ITRANSPORT_BINDING_HPP
 #define LAP_COM_BINDING_ITRANSPORT_BINDING_HPP
 
 #include "BindingTypes.hpp"
+#include "ComTypes.hpp"
 
 #include <lap/core/CResult.hpp>
 #include <lap/core/COptional.hpp>
@@ -62,6 +66,14 @@ namespace binding
         const ByteBuffer& data
     )>;
 
+    /**
+     * @brief Borrowed event callback function type (zero-copy receive)
+     * @param loan Received payload, still in transport memory (read-only)
+     * @note The callee owns the loan and hands it to
+     *       ITransportBinding::ReleaseReceivedEvent() exactly once, from any thread
+     */
+    using LoanedEventCallback = std::function<void(EventLoan& loan)>;
+
     /**
      * @brief Method request callback function type
      * @param service_id AUTOSAR service ID
@@ -230,6 +242,94 @@ namespace binding
             uint32_t event_id
         ) noexcept = 0;
 
+        /**
+         * @brief Loan a payload buffer in transport memory for an event
+         * @param service_id AUTOSAR service ID
+         * @param instance_id AUTOSAR instance ID
+         * @param event_id Event identifier
+         * @param size Payload size in bytes
+         * @return Result<EventLoan> Loan or error code
+         * 
+         * @note Zero-copy send: the caller writes the payload in place and
+         *       publishes it with SendLoanedEvent(), no intermediate buffer
+         * @note Default: kNotSupported (bindings without shared payload memory)
+         * @note Loans must be sent or released before StopOfferService()
+         */
+        virtual Result<EventLoan> LoanEvent(
+            uint64_t /*service_id*/,
+            uint64_t /*instance_id*/,
+            uint32_t /*event_id*/,
+            size_t /*size*/
+        ) noexcept
+        {
+            return Result<EventLoan>::FromError(
+                MakeErrorCode(ComErrc::kNotSupported, 0));
+        }
+
+        /**
+         * @brief Publish a loaned payload
+         * @param loan Loan from LoanEvent() (consumed, also on error)
+         * @return Result<void> Success or error code
+         */
+        virtual Result<void> SendLoanedEvent(EventLoan& /*loan*/) noexcept
+        {
+            return Result<void>::FromError(
+                MakeErrorCode(ComErrc::kNotSupported, 0));
+        }
+
+        /**
+         * @brief Return a loaned payload without publishing it
+         * @param loan Loan from LoanEvent() (consumed)
+         */
+        virtual void ReleaseLoanedEvent(EventLoan& /*loan*/) noexcept
+        {
+        }
+
+        /**
+         * @brief Subscribe to service events without copying payloads
+         * @param service_id AUTOSAR service ID
+         * @param instance_id AUTOSAR instance ID
+         * @param event_id Event identifier
+         * @param callback Receives each payload as a borrowed transport sample
+         * @return Result<void> Success or error code
+         * 
+         * @note Zero-copy receive: the payload stays in transport memory until
+         *       ReleaseReceivedEvent(); the transport bounds how many samples a
+         *       subscriber may hold at once (GetMaxBorrowedSamples())
+         * @note Default: kNotSupported (use SubscribeEvent())
+         * @note Ended with UnsubscribeEvent()
+         */
+        virtual Result<void> SubscribeLoanedEvent(
+            uint64_t /*service_id*/,
+            uint64_t /*instance_id*/,
+            uint32_t /*event_id*/,
+            LoanedEventCallback /*callback*/
+        ) noexcept
+        {
+            return Result<void>::FromError(
+                MakeErrorCode(ComErrc::kNotSupported, 0));
+        }
+
+        /**
+         * @brief Return a payload received through SubscribeLoanedEvent()
+         * @param loan Borrowed payload (consumed)
+         */
+        virtual void ReleaseReceivedEvent(EventLoan& /*loan*/) noexcept
+        {
+        }
+
+        /**
+         * @brief Samples one SubscribeLoanedEvent() subscriber may hold at once
+         * @return Borrow limit, 0 if the transport does not bound it
+         * 
+         * @note Once the limit is reached the transport delivers nothing more
+         *       until a payload is returned with ReleaseReceivedEvent()
+         */
+        virtual uint32_t GetMaxBorrowedSamples() const noexcept
+        {
+            return 0;
+        }
+
         // ====================================================================
         // Method Communication
         // ====================================================================
@@ -344,6 +444,9 @@ namespace binding
          * @return true if zero-copy capable (e.g., iceoryx2)
          * 
          * @note Used by BindingSelector for optimization decisions
+         * @note Bindings with shared payload memory (iceoryx2) also implement
+         *       LoanEvent()/SendLoanedEvent() for zero-copy sends and
+         *       SubscribeLoanedEvent() for zero-copy receives
          */
         virtual bool SupportsZeroCopy() const noexcept = 0;
 
@@ -55,6 +55,9 @@ struct Iceoryx2Config
     size_t max_payload_size = 1024;           // Maximum payload size in bytes
     size_t subscriber_max_buffer_size = 1024;  // Maximum buffer size for subscribers
     size_t publisher_max_slice_len = 1024;     // Maximum slice length for publishers
+    size_t max_loaned_samples = 2;             // Samples a publisher can have loaned (LoanEvent) at once
+    size_t subscriber_max_borrowed_samples = 2; // Samples a subscriber can hold (SubscribeLoanedEvent) at once;
+                                                // bounds the ProxyEvent queue depth in zero-copy mode
     size_t max_publishers = 8;                 // Maximum number of publishers per service
     size_t max_subscribers = 8;                // Maximum number of subscribers per service
     size_t history_size = 0;                   // History depth (0 = no history)
@@ -92,6 +95,18 @@ public:
     Result<void> UnsubscribeEvent(uint64_t service_id, uint64_t instance_id,
                                    uint32_t event_id) noexcept override;
 
+    // Zero-copy Event Send (payload written directly into a loaned slice)
+    Result<EventLoan> LoanEvent(uint64_t service_id, uint64_t instance_id,
+                                uint32_t event_id, size_t size) noexcept override;
+    Result<void> SendLoanedEvent(EventLoan& loan) noexcept override;
+    void ReleaseLoanedEvent(EventLoan& loan) noexcept override;
+
+    // Zero-copy Event Receive (callback borrows the iceoryx2 sample)
+    Result<void> SubscribeLoanedEvent(uint64_t service_id, uint64_t instance_id,
+                                      uint32_t event_id, LoanedEventCallback callback) noexcept override;
+    void ReleaseReceivedEvent(EventLoan& loan) noexcept override;
+    uint32_t GetMaxBorrowedSamples() const noexcept override;
+
     // Method Communication (Not Supported)
     Result<ByteBuffer> CallMethod(uint64_t service_id, uint64_t instance_id,
                                    uint32_t method_id, const ByteBuffer& request) noexcept override;
@@ -128,7 +143,9 @@ private:
         uint64_t instance_id;
         uint32_t event_id;
         EventCallback callback;
+        LoanedEventCallback loaned_callback;  // Set instead of callback for borrowed samples
         std::string service_name;
+        bool borrow_limit_logged{false};      // Listener reported the exhausted borrow limit
         std::atomic<bool> running{false};
         std::thread listener_thread;
         iox2_port_factory_pub_sub_h service;
@@ -137,9 +154,13 @@ private:
 
     std::string makeServiceName(uint64_t service_id, uint64_t instance_id) const noexcept;
     uint64_t makeServiceKey(uint64_t service_id, uint64_t instance_id) const noexcept;
+    Result<void> createSubscriber(uint64_t service_id, uint64_t instance_id, uint32_t event_id,
+                                  EventCallback callback, LoanedEventCallback loaned_callback) noexcept;
     void listenerThread(SubscriberWrapper* wrapper) noexcept;
+    void recordSend(size_t bytes, uint64_t latency_ns) noexcept;
 
     mutable std::mutex mutex_;
+    std::mutex sample_mutex_;  // Serializes receive with drops of borrowed samples (any thread)
     bool initialized_;
     std::string node_name_;
     iox2_node_h node_;
@@ -215,6 +215,10 @@ Result<void> Iceoryx2Binding::OfferService(uint64_t service_id, uint64_t instanc
     iox2_service_builder_pub_sub_set_max_publishers(&service_builder_pub_sub, config_.max_publishers);
     iox2_service_builder_pub_sub_set_max_subscribers(&service_builder_pub_sub, config_.max_subscribers);
     
+    // Bound on samples one subscriber can borrow (SubscribeLoanedEvent)
+    iox2_service_builder_pub_sub_set_subscriber_max_borrowed_samples(&service_builder_pub_sub,
+                                                                     config_.subscriber_max_borrowed_samples);
+
     // Set history size if configured
     if (config_.history_size > 0)
     {
@@ -239,6 +243,10 @@ Result<void> Iceoryx2Binding::OfferService(uint64_t service_id, uint64_t instanc
     // Set maximum slice length for dynamic payloads (from config)
     iox2_port_factory_publisher_builder_set_initial_max_slice_len(&publisher_builder, 
                                                                    config_.publisher_max_slice_len);
+
+    // Bound on LoanEvent() loans held at once (SkeletonEvent::Allocate before Send)
+    iox2_port_factory_publisher_builder_set_max_loaned_samples(&publisher_builder,
+                                                               config_.max_loaned_samples);
     
     if (iox2_port_factory_publisher_builder_create(publisher_builder, NULL, &wrapper->publisher) != IOX2_OK)
     {
@@ -368,16 +376,7 @@ Result<void> Iceoryx2Binding::SendEvent(uint64_t service_id, uint64_t instance_i
     auto end = std::chrono::steady_clock::now();
     uint64_t latency_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
 
-    // Update metrics
-    metrics_.messages_sent++;
-    metrics_.bytes_sent += data.size();
-    if (metrics_.messages_sent == 1) {
-        metrics_.avg_latency_ns = latency_ns;
-    } else {
-        metrics_.avg_latency_ns = (metrics_.avg_latency_ns * (metrics_.messages_sent - 1) + latency_ns) / metrics_.messages_sent;
-    }
-    metrics_.max_latency_ns = std::max(metrics_.max_latency_ns, latency_ns);
-    metrics_.min_latency_ns = std::min(metrics_.min_latency_ns, latency_ns);
+    recordSend(data.size(), latency_ns);
 
     std::ostringstream oss2;
     oss2 << "Event sent: service=" << service_name
@@ -389,8 +388,142 @@ Result<void> Iceoryx2Binding::SendEvent(uint64_t service_id, uint64_t instance_i
     return Result<void>::FromValue();
 }
 
+Result<EventLoan> Iceoryx2Binding::LoanEvent(uint64_t service_id, uint64_t instance_id,
+                                             uint32_t event_id, size_t size) noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (!initialized_)
+    {
+        LAP_COM_LOG_ERROR << "iceoryx2 binding not initialized";
+        return Result<EventLoan>::FromError(
+            MakeErrorCode(ComErrc::kNotInitialized, 0));
+    }
+
+    uint64_t key = makeServiceKey(service_id, instance_id);
+
+    auto it = publishers_.find(key);
+    if (it == publishers_.end())
+    {
+        LAP_COM_LOG_ERROR << "Publisher not found for service: " << makeServiceName(service_id, instance_id);
+        return Result<EventLoan>::FromError(
+            MakeErrorCode(ComErrc::kServiceNotOffered, 0));
+    }
+
+    // The publisher cannot loan beyond its configured slice length
+    if (size > config_.publisher_max_slice_len)
+    {
+        std::ostringstream oss;
+        oss << "Loan exceeds publisher_max_slice_len for service: " << it->second->service_name
+            << ", size=" << size << ", max=" << config_.publisher_max_slice_len;
+        LAP_COM_LOG_ERROR << oss.str();
+        return Result<EventLoan>::FromError(
+            MakeErrorCode(ComErrc::kMessageTooLarge, 0));
+    }
+
+    iox2_sample_mut_h sample = NULL;
+    int loan_result = iox2_publisher_loan_slice_uninit(&it->second->publisher, NULL, &sample, size);
+    if (loan_result != IOX2_OK)
+    {
+        std::ostringstream oss;
+        oss << "Failed to loan sample for service: " << it->second->service_name
+            << ", size=" << size << ", error=" << loan_result;
+        LAP_COM_LOG_ERROR << oss.str();
+        return Result<EventLoan>::FromError(
+            MakeErrorCode(ComErrc::kNetworkBindingFailure, 0));
+    }
+
+    void* payload = NULL;
+    iox2_sample_mut_payload_mut(&sample, &payload, NULL);
+
+    EventLoan loan;
+    loan.service_id = service_id;
+    loan.instance_id = instance_id;
+    loan.event_id = event_id;
+    loan.payload = payload;
+    loan.size = size;
+    loan.handle = sample;
+    return Result<EventLoan>::FromValue(loan);
+}
+
+Result<void> Iceoryx2Binding::SendLoanedEvent(EventLoan& loan) noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    iox2_sample_mut_h sample = static_cast<iox2_sample_mut_h>(loan.handle);
+    loan.handle = NULL;
+    loan.payload = NULL;
+    if (sample == NULL)
+    {
+        return Result<void>::FromError(
+            MakeErrorCode(ComErrc::kInvalidArgument, 0));
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    // Payload was written in place: publish without any copy
+    if (iox2_sample_mut_send(sample, NULL) != IOX2_OK)
+    {
+        LAP_COM_LOG_ERROR << "Failed to send loaned sample for service: "
+                          << makeServiceName(loan.service_id, loan.instance_id);
+        return Result<void>::FromError(
+            MakeErrorCode(ComErrc::kNetworkBindingFailure, 0));
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    uint64_t latency_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+    recordSend(loan.size, latency_ns);
+    return Result<void>::FromValue();
+}
+
+void Iceoryx2Binding::ReleaseLoanedEvent(EventLoan& loan) noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (loan.handle != NULL)
+    {
+        iox2_sample_mut_drop(static_cast<iox2_sample_mut_h>(loan.handle));
+    }
+    loan.handle = NULL;
+    loan.payload = NULL;
+}
+
 Result<void> Iceoryx2Binding::SubscribeEvent(uint64_t service_id, uint64_t instance_id,
                                                uint32_t event_id, EventCallback callback) noexcept
+{
+    return createSubscriber(service_id, instance_id, event_id, std::move(callback), nullptr);
+}
+
+Result<void> Iceoryx2Binding::SubscribeLoanedEvent(uint64_t service_id, uint64_t instance_id,
+                                                     uint32_t event_id, LoanedEventCallback callback) noexcept
+{
+    if (!callback)
+    {
+        return Result<void>::FromError(
+            MakeErrorCode(ComErrc::kInvalidArgument, 0));
+    }
+    return createSubscriber(service_id, instance_id, event_id, nullptr, std::move(callback));
+}
+
+void Iceoryx2Binding::ReleaseReceivedEvent(EventLoan& loan) noexcept
+{
+    if (loan.handle != NULL)
+    {
+        std::lock_guard<std::mutex> lock(sample_mutex_);
+        iox2_sample_drop(static_cast<iox2_sample_h>(loan.handle));
+    }
+    loan.handle = NULL;
+    loan.payload = NULL;
+}
+
+uint32_t Iceoryx2Binding::GetMaxBorrowedSamples() const noexcept
+{
+    return static_cast<uint32_t>(config_.subscriber_max_borrowed_samples);
+}
+
+Result<void> Iceoryx2Binding::createSubscriber(uint64_t service_id, uint64_t instance_id, uint32_t event_id,
+                                                 EventCallback callback, LoanedEventCallback loaned_callback) noexcept
 {
     std::lock_guard<std::mutex> lock(mutex_);
 
@@ -416,7 +549,8 @@ Result<void> Iceoryx2Binding::SubscribeEvent(uint64_t service_id, uint64_t insta
     wrapper->service_id = service_id;
     wrapper->instance_id = instance_id;
     wrapper->event_id = event_id;
-    wrapper->callback = callback;
+    wrapper->callback = std::move(callback);
+    wrapper->loaned_callback = std::move(loaned_callback);
     wrapper->service_name = service_name;
 
     // Create iceoryx2 subscriber using C API
@@ -594,6 +728,20 @@ uint64_t Iceoryx2Binding::makeServiceKey(uint64_t service_id, uint64_t instance_
     return (service_id << 32) | (instance_id & 0xFFFFFFFF);
 }
 
+void Iceoryx2Binding::recordSend(size_t bytes, uint64_t latency_ns) noexcept
+{
+    // Caller holds mutex_
+    metrics_.messages_sent++;
+    metrics_.bytes_sent += bytes;
+    if (metrics_.messages_sent == 1) {
+        metrics_.avg_latency_ns = latency_ns;
+    } else {
+        metrics_.avg_latency_ns = (metrics_.avg_latency_ns * (metrics_.messages_sent - 1) + latency_ns) / metrics_.messages_sent;
+    }
+    metrics_.max_latency_ns = std::max(metrics_.max_latency_ns, latency_ns);
+    metrics_.min_latency_ns = std::min(metrics_.min_latency_ns, latency_ns);
+}
+
 void Iceoryx2Binding::listenerThread(SubscriberWrapper* wrapper) noexcept
 {
     LAP_COM_LOG_INFO << "Listener thread started for service: " << wrapper->service_name;
@@ -602,8 +750,27 @@ void Iceoryx2Binding::listenerThread(SubscriberWrapper* wrapper) noexcept
     {
         // Receive samples from iceoryx2 C API
         iox2_sample_h sample_handle = NULL;
-        int result = iox2_subscriber_receive(&wrapper->subscriber, NULL, &sample_handle);
+        int result = IOX2_OK;
+        {
+            std::lock_guard<std::mutex> sample_lock(sample_mutex_);
+            result = iox2_subscriber_receive(&wrapper->subscriber, NULL, &sample_handle);
+        }
         
+        if (result == iox2_receive_error_e_EXCEEDS_MAX_BORROWS)
+        {
+            // Not an empty queue: the application holds every borrowable sample
+            if (!wrapper->borrow_limit_logged)
+            {
+                wrapper->borrow_limit_logged = true;
+                LAP_COM_LOG_WARN << "Receive stalled for service: " << wrapper->service_name
+                                 << ", " << config_.subscriber_max_borrowed_samples
+                                 << " borrowed samples held (release samples or raise"
+                                 << " subscriber_max_borrowed_samples)";
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            continue;
+        }
+
         if (result != IOX2_OK || sample_handle == NULL)
         {
             // No data available yet
@@ -615,6 +782,28 @@ void Iceoryx2Binding::listenerThread(SubscriberWrapper* wrapper) noexcept
         const void* payload = NULL;
         size_t payload_len = 0;
         iox2_sample_payload(&sample_handle, &payload, &payload_len);
+
+        if (wrapper->loaned_callback)
+        {
+            // Zero-copy: the callback owns the sample until ReleaseReceivedEvent()
+            EventLoan loan;
+            loan.service_id = wrapper->service_id;
+            loan.instance_id = wrapper->instance_id;
+            loan.event_id = wrapper->event_id;
+            loan.payload = const_cast<void*>(payload);
+            loan.size = payload_len;
+            loan.handle = sample_handle;
+            wrapper->loaned_callback(loan);
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                metrics_.messages_received++;
+                metrics_.bytes_received += payload_len;
+            }
+
+            std::this_thread::sleep_for(std::chrono::microseconds(config_.listener_poll_interval_us));
+            continue;
+        }
         
         ByteBuffer data(static_cast<const uint8_t*>(payload), 
                        static_cast<const uint8_t*>(payload) + payload_len);
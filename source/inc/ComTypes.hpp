@@ -18,6 +18,8 @@
 #include <core/CInstanceSpecifier.hpp>
 #include <lap/log/CLog.hpp>
 
+#include "SamplePool.hpp"
+
 #include <cstdint>
 #include <chrono>
 
@@ -114,6 +116,9 @@ namespace com
         kFdPassingFailed            = 0x10C, ///< Failed to pass file descriptor via SCM_RIGHTS
         kFdReceiveFailed            = 0x10D, ///< Failed to receive file descriptor
         kPermissionDenied           = 0x10E, ///< Insufficient permissions
+        kRegistryLayoutMismatch     = 0x10F, ///< Registry memfd header missing or incompatible
+        kRegistryRetired            = 0x110, ///< Registry memfd superseded by a resized generation
+        kRegistryContended          = 0x111, ///< Registry entry held by a writer beyond the reader backoff
     };
     
     /**
@@ -222,6 +227,12 @@ namespace com
                     return "Failed to receive file descriptor";
                 case ComErrc::kPermissionDenied:
                     return "Insufficient permissions";
+                case ComErrc::kRegistryLayoutMismatch:
+                    return "Registry memfd header missing or incompatible";
+                case ComErrc::kRegistryRetired:
+                    return "Registry memfd superseded by a resized generation";
+                case ComErrc::kRegistryContended:
+                    return "Registry entry held by a writer beyond the reader backoff";
                 default:
                     return "Unknown Communication Management error";
             }
@@ -334,10 +345,11 @@ namespace com
     /**
      * @brief Sample pointer for event data
      * @tparam SampleType Type of sample data
-     * @note SWS_CM_00320
+     * @note SWS_CM_00320. Samples may live in the event's SamplePool; the
+     *       deleter hands them back to it.
      */
     template<typename SampleType>
-    using SamplePtr = std::unique_ptr<const SampleType>;
+    using SamplePtr = std::unique_ptr<const SampleType, SampleDeleter<const SampleType>>;
     
     /**
      * @brief Sample allocation result
@@ -345,7 +357,7 @@ namespace com
      * @note SWS_CM_00321
      */
     template<typename SampleType>
-    using SampleAllocateePtr = std::unique_ptr<SampleType>;
+    using SampleAllocateePtr = std::unique_ptr<SampleType, SampleDeleter<SampleType>>;
     
     /**
      * @brief Event receive handler callback
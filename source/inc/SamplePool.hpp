@@ -0,0 +1,260 @@
+/**
+ * @file        SamplePool.hpp
+ * @author      LightAP Development Team
+ * @brief       Fixed-capacity sample storage for events
+ * @date        2025-11-22
+ * @details     SamplePool hands out preallocated, suitably aligned slots from a
+ *              lock-free free list. SampleDeleter is the deleter of SamplePtr and
+ *              SampleAllocateePtr: it destroys the sample in place and returns the
+ *              memory to its SampleStorage (a pool, or a transport that loaned it),
+ *              or falls back to delete for heap samples.
+ * @copyright   Copyright (c) 2025
+ * @note        The pool is reference counted by its owner and by every sample in
+ *              flight, so samples may outlive the event that allocated them.
+ */
+#ifndef LAP_COM_SAMPLE_POOL_HPP
+#define LAP_COM_SAMPLE_POOL_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace lap
+{
+namespace com
+{
+    /**
+     * @brief Owner of sample memory that SampleDeleter hands samples back to
+     * @details @p context is the per-sample word stored in the deleter (e.g. a
+     *          transport loan handle); pools ignore it.
+     */
+    class SampleStorage
+    {
+    public:
+        virtual void Recycle(void* sample, void* context) noexcept = 0;
+
+    protected:
+        ~SampleStorage() = default;
+    };
+
+    /**
+     * @brief Fixed number of equally sized sample slots
+     *
+     * @details The free list is a Treiber stack of slot indices; the head carries a
+     *          32-bit tag next to the index so a concurrent pop/push cannot ABA.
+     *          Acquire() and Recycle() may run on any thread.
+     */
+    class SamplePool final : public SampleStorage
+    {
+    public:
+        /**
+         * @brief Create a pool of capacity slots of slotSize bytes
+         * @return Pool owned by the caller (drop with Release()), nullptr on allocation failure
+         */
+        static SamplePool* Create(uint32_t capacity, size_t slotSize, size_t slotAlign) noexcept
+        {
+            if (capacity == 0 || capacity == kNil || slotAlign == 0 || (slotAlign & (slotAlign - 1)) != 0) {
+                return nullptr;
+            }
+            std::unique_ptr<SamplePool> pool(new (std::nothrow) SamplePool(capacity, slotSize, slotAlign));
+            if (!pool || !pool->storage_ || !pool->next_) {
+                return nullptr;
+            }
+            return pool.release();
+        }
+
+        template<typename T>
+        static SamplePool* Create(uint32_t capacity) noexcept
+        {
+            return Create(capacity, sizeof(T), alignof(T));
+        }
+
+        SamplePool(const SamplePool&) = delete;
+        SamplePool& operator=(const SamplePool&) = delete;
+
+        [[nodiscard]] uint32_t Capacity() const noexcept
+        {
+            return capacity_;
+        }
+
+        /**
+         * @brief Take a free slot
+         * @return Uninitialized slot, nullptr if all slots are in use
+         * @note The slot holds a reference on the pool until Recycle()
+         */
+        void* Acquire() noexcept
+        {
+            uint64_t head = head_.load(std::memory_order_acquire);
+            for (;;) {
+                const uint32_t index = static_cast<uint32_t>(head);
+                if (index == kNil) {
+                    return nullptr;
+                }
+                const uint32_t next = next_[index].load(std::memory_order_relaxed);
+                if (head_.compare_exchange_weak(head, Pack(head, next),
+                                                std::memory_order_acquire, std::memory_order_acquire)) {
+                    refs_.fetch_add(1, std::memory_order_relaxed);
+                    return storage_ + static_cast<size_t>(index) * stride_;
+                }
+            }
+        }
+
+        /**
+         * @brief Return a slot obtained from Acquire() (object already destroyed)
+         */
+        void Recycle(void* slot, void* /*context*/ = nullptr) noexcept override
+        {
+            const uint32_t index = static_cast<uint32_t>(
+                (static_cast<unsigned char*>(slot) - storage_) / stride_);
+            uint64_t head = head_.load(std::memory_order_relaxed);
+            do {
+                next_[index].store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+            } while (!head_.compare_exchange_weak(head, Pack(head, index),
+                                                  std::memory_order_release, std::memory_order_relaxed));
+            Release();
+        }
+
+        /**
+         * @brief Drop the owner's reference; the pool is freed with the last sample
+         */
+        void Release() noexcept
+        {
+            if (refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                delete this;
+            }
+        }
+
+        ~SamplePool() noexcept
+        {
+            if (storage_) {
+                ::operator delete(storage_, std::align_val_t(align_));
+            }
+        }
+
+    private:
+        static constexpr uint32_t kNil = 0xFFFFFFFFU;
+
+        SamplePool(uint32_t capacity, size_t slotSize, size_t slotAlign) noexcept
+            : align_(slotAlign < alignof(std::max_align_t) ? alignof(std::max_align_t) : slotAlign)
+            , stride_(((slotSize == 0 ? 1 : slotSize) + slotAlign - 1) / slotAlign * slotAlign)
+            , capacity_(capacity)
+            , next_(new (std::nothrow) std::atomic<uint32_t>[capacity])
+        {
+            storage_ = static_cast<unsigned char*>(
+                ::operator new(stride_ * capacity, std::align_val_t(align_), std::nothrow));
+            if (next_) {
+                for (uint32_t i = 0; i < capacity; ++i) {
+                    next_[i].store(i + 1 < capacity ? i + 1 : kNil, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /// New head value: bump the tag of @p head, point at @p index
+        static uint64_t Pack(uint64_t head, uint32_t index) noexcept
+        {
+            return (((head >> 32) + 1) << 32) | index;
+        }
+
+        size_t align_;
+        size_t stride_;
+        uint32_t capacity_;
+        unsigned char* storage_{nullptr};
+        std::unique_ptr<std::atomic<uint32_t>[]> next_;  ///< Free-list links per slot
+
+        alignas(64) std::atomic<uint64_t> head_{0};     ///< tag << 32 | first free slot
+        alignas(64) std::atomic<uint32_t> refs_{1};     ///< Owner + samples in flight
+    };
+
+    /**
+     * @brief unique_ptr deleter for SamplePool owners (drops the owner reference)
+     */
+    struct SamplePoolRelease
+    {
+        void operator()(SamplePool* pool) const noexcept
+        {
+            pool->Release();
+        }
+    };
+
+    using SamplePoolHandle = std::unique_ptr<SamplePool, SamplePoolRelease>;
+
+    /**
+     * @brief Deleter for pooled, loaned or heap-allocated samples
+     * @tparam T Sample type (may be const)
+     * @details Default constructed (and converted from std::default_delete) it
+     *          deletes, so heap samples and std::make_unique keep working.
+     */
+    template<typename T>
+    class SampleDeleter
+    {
+    public:
+        constexpr SampleDeleter() noexcept = default;
+
+        explicit SampleDeleter(SampleStorage* storage, void* context = nullptr) noexcept
+            : storage_(storage)
+            , context_(context)
+        {}
+
+        /// SampleAllocateePtr<T> -> SamplePtr<T>
+        template<typename U, typename = typename std::enable_if<
+            std::is_same<typename std::remove_cv<U>::type, typename std::remove_cv<T>::type>::value &&
+            std::is_convertible<U*, T*>::value>::type>
+        SampleDeleter(const SampleDeleter<U>& other) noexcept
+            : storage_(other.Storage())
+            , context_(other.Context())
+        {}
+
+        /// std::unique_ptr<U> (heap sample) -> SamplePtr / SampleAllocateePtr
+        template<typename U, typename = typename std::enable_if<std::is_convertible<U*, T*>::value>::type>
+        SampleDeleter(const std::default_delete<U>&) noexcept
+        {}
+
+        void operator()(T* sample) const noexcept
+        {
+            if (storage_ == nullptr) {
+                delete sample;
+                return;
+            }
+            sample->~T();
+            storage_->Recycle(const_cast<typename std::remove_cv<T>::type*>(sample), context_);
+        }
+
+        /// Owner of the sample memory, nullptr for heap samples
+        [[nodiscard]] SampleStorage* Storage() const noexcept
+        {
+            return storage_;
+        }
+
+        [[nodiscard]] void* Context() const noexcept
+        {
+            return context_;
+        }
+
+    private:
+        SampleStorage* storage_{nullptr};
+        void* context_{nullptr};
+    };
+
+    /**
+     * @brief Construct a sample in a pool slot
+     * @return Owning pointer, empty if the pool is exhausted
+     */
+    template<typename T, typename... Args>
+    std::unique_ptr<T, SampleDeleter<T>> MakePooledSample(SamplePool& pool, Args&&... args)
+    {
+        void* slot = pool.Acquire();
+        if (slot == nullptr) {
+            return std::unique_ptr<T, SampleDeleter<T>>();
+        }
+        return std::unique_ptr<T, SampleDeleter<T>>(
+            ::new (slot) T(std::forward<Args>(args)...), SampleDeleter<T>(&pool));
+    }
+
+} // namespace com
+} // namespace lap
+
+#endif // LAP_COM_SAMPLE_POOL_HPP
@@ -0,0 +1,304 @@
+/**
+ * @file        EndpointAddress.hpp
+ * @author      LightAP Development Team
+ * @brief       Pre-parsed binary form of a ServiceSlot endpoint string
+ * @date        2025-11-20
+ * @details     The registering process parses ServiceSlot::endpoint once and stores
+ *              the result next to the string, so consumers set up connections
+ *              without string parsing or allocation and compare endpoints with
+ *              memcmp. Supported schemes:
+ *              - tcp://192.168.1.10:30509, udp://[fe80::1]:30490  (IPv4/IPv6 + port)
+ *              - uds:///var/run/lap_service.sock                  (path inside endpoint)
+ *              - shm://service_name/instance_1                    (name hash)
+ *              - topic://domain_0/service_topic                   (name hash)
+ * @copyright   Copyright (c) 2025
+ * @note        AUTOSAR R24-11 Compliance:
+ *              - SWS_CM_00303: Service Instance Attributes
+ * @reference   SERVICE_DISCOVERY_ARCHITECTURE.md §2.1 (Core Data Structures)
+ *              inet_pton(3), unix(7)
+ * sdk:
+ * platform:    Linux 5.10+
+ * project:     LightAP
+ * @version
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author          <th>Description
+ * <tr><td>2025/11/20  <td>1.0      <td>LightAP Team    <td>Initial implementation
+ * </table>
+ */
+#ifndef LAP_COM_REGISTRY_ENDPOINT_ADDRESS_HPP
+#define LAP_COM_REGISTRY_ENDPOINT_ADDRESS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+namespace lap
+{
+namespace com
+{
+namespace registry
+{
+    /**
+     * @brief Transport of a pre-parsed endpoint
+     * @note NONE = not encoded (unknown scheme or written by an older client);
+     *       consumers then fall back to the endpoint string
+     */
+    enum class EndpointTransport : uint8_t
+    {
+        NONE  = 0,  ///< Not encoded
+        TCP   = 1,  ///< tcp://host:port
+        UDP   = 2,  ///< udp://host:port
+        UDS   = 3,  ///< uds://path (Unix domain socket)
+        SHM   = 4,  ///< shm://name (iceoryx2 / shared memory service)
+        TOPIC = 5   ///< topic://name (DDS topic)
+    };
+
+    /**
+     * @brief 32-byte binary endpoint stored in ServiceSlot
+     *
+     * @details Memory layout (total 32 bytes):
+     *   - [0]       transport (EndpointTransport)
+     *   - [1]       address family (AF_INET, AF_INET6, AF_UNIX or 0)
+     *   - [2-3]     port (network byte order, sockaddr_in compatible)
+     *   - [4]       offset of the name/path inside ServiceSlot::endpoint
+     *   - [5]       length of the name/path
+     *   - [6-7]     reserved (zero)
+     *   - [8-23]    address (in_addr in the first 4 bytes, or in6_addr)
+     *   - [24-31]   FNV-1a hash of the name/path (0 for IP endpoints)
+     *
+     * @note Fully zero-initialized, so two encodings of the same endpoint
+     *       compare equal with memcmp (operator==)
+     */
+    struct EndpointAddress final
+    {
+        uint8_t  transport = 0;     ///< EndpointTransport
+        uint8_t  family = 0;        ///< AF_INET / AF_INET6 / AF_UNIX / 0
+        uint16_t port_be = 0;       ///< Port in network byte order
+        uint8_t  name_offset = 0;   ///< Name/path start inside the endpoint string
+        uint8_t  name_length = 0;   ///< Name/path length
+        uint16_t _reserved = 0;     ///< Zero
+        uint8_t  address[16] = {};  ///< IPv4 (first 4 bytes) or IPv6 address
+        uint64_t name_hash = 0;     ///< FNV-1a of the name/path
+
+        /**
+         * @brief Parse an endpoint string
+         * @param endpoint NUL-terminated endpoint (ServiceSlot::endpoint)
+         * @param out Output (reset first; stays NONE on failure)
+         * @return true if the scheme is known and the address is valid
+         *
+         * @note No allocation; IP literals only (host names are not resolved)
+         */
+        static bool Parse(const char* endpoint, EndpointAddress& out) noexcept
+        {
+            out = EndpointAddress{};
+            if (endpoint == nullptr) {
+                return false;
+            }
+
+            const char* separator = std::strstr(endpoint, "://");
+            if (separator == nullptr) {
+                return false;
+            }
+            const size_t scheme_length = static_cast<size_t>(separator - endpoint);
+            const char* rest = separator + 3;
+            const EndpointTransport transport = TransportOf(endpoint, scheme_length);
+
+            switch (transport) {
+            case EndpointTransport::TCP:
+            case EndpointTransport::UDP:
+                if (!parseHostPort(rest, out)) {
+                    out = EndpointAddress{};
+                    return false;
+                }
+                break;
+            case EndpointTransport::UDS:
+                out.family = AF_UNIX;
+                /* fall through */
+            case EndpointTransport::SHM:
+            case EndpointTransport::TOPIC: {
+                const size_t length = std::strlen(rest);
+                if (length == 0 || length > UINT8_MAX ||
+                    (transport == EndpointTransport::UDS && length >= sizeof(sockaddr_un::sun_path))) {
+                    out = EndpointAddress{};
+                    return false;
+                }
+                out.name_offset = static_cast<uint8_t>(rest - endpoint);
+                out.name_length = static_cast<uint8_t>(length);
+                out.name_hash = HashName(rest, length);
+                break;
+            }
+            default:
+                return false;
+            }
+
+            out.transport = static_cast<uint8_t>(transport);
+            return true;
+        }
+
+        /**
+         * @brief Build a socket address for connect()/sendto()
+         * @param endpoint The endpoint string this encoding was parsed from
+         *        (only read for UDS paths, copied without parsing)
+         * @param out Output socket address
+         * @return Address length, or 0 if the transport has no socket address
+         */
+        socklen_t ToSockaddr(const char* endpoint, sockaddr_storage& out) const noexcept
+        {
+            std::memset(&out, 0, sizeof(out));
+            if (family == AF_INET) {
+                auto* addr = reinterpret_cast<sockaddr_in*>(&out);
+                addr->sin_family = AF_INET;
+                addr->sin_port = port_be;
+                std::memcpy(&addr->sin_addr, address, sizeof(addr->sin_addr));
+                return sizeof(sockaddr_in);
+            }
+            if (family == AF_INET6) {
+                auto* addr = reinterpret_cast<sockaddr_in6*>(&out);
+                addr->sin6_family = AF_INET6;
+                addr->sin6_port = port_be;
+                std::memcpy(&addr->sin6_addr, address, sizeof(addr->sin6_addr));
+                return sizeof(sockaddr_in6);
+            }
+            if (family == AF_UNIX && endpoint != nullptr) {
+                auto* addr = reinterpret_cast<sockaddr_un*>(&out);
+                addr->sun_family = AF_UNIX;
+                std::memcpy(addr->sun_path, endpoint + name_offset, name_length);
+                return static_cast<socklen_t>(offsetof(sockaddr_un, sun_path) + name_length + 1);
+            }
+            return 0;
+        }
+
+        /**
+         * @brief Transport of this endpoint
+         */
+        [[nodiscard]] EndpointTransport Transport() const noexcept
+        {
+            return static_cast<EndpointTransport>(transport);
+        }
+
+        /**
+         * @brief Check whether the endpoint was encoded
+         */
+        [[nodiscard]] bool IsValid() const noexcept
+        {
+            return transport != static_cast<uint8_t>(EndpointTransport::NONE);
+        }
+
+        /**
+         * @brief Port in host byte order (0 if none)
+         */
+        [[nodiscard]] uint16_t Port() const noexcept
+        {
+            return ntohs(port_be);
+        }
+
+        /**
+         * @brief Bytewise comparison (encodings are fully zero-initialized)
+         */
+        bool operator==(const EndpointAddress& other) const noexcept
+        {
+            return std::memcmp(this, &other, sizeof(EndpointAddress)) == 0;
+        }
+
+        bool operator!=(const EndpointAddress& other) const noexcept
+        {
+            return !(*this == other);
+        }
+
+        /**
+         * @brief Map a scheme ("tcp", "uds", ...) to its transport
+         */
+        static EndpointTransport TransportOf(const char* scheme, size_t length) noexcept
+        {
+            struct SchemeEntry
+            {
+                const char* name;
+                EndpointTransport transport;
+            };
+            static constexpr SchemeEntry SCHEMES[] = {
+                {"tcp", EndpointTransport::TCP},  {"udp", EndpointTransport::UDP},
+                {"uds", EndpointTransport::UDS},  {"unix", EndpointTransport::UDS},
+                {"shm", EndpointTransport::SHM},  {"topic", EndpointTransport::TOPIC},
+            };
+            for (const auto& entry : SCHEMES) {
+                if (std::strlen(entry.name) == length && std::strncmp(scheme, entry.name, length) == 0) {
+                    return entry.transport;
+                }
+            }
+            return EndpointTransport::NONE;
+        }
+
+        /**
+         * @brief 64-bit FNV-1a hash of a name (same algorithm as the registry probe hash)
+         */
+        static uint64_t HashName(const char* name, size_t length) noexcept
+        {
+            uint64_t hash = 0xCBF29CE484222325ULL;
+            for (size_t i = 0; i < length; ++i) {
+                hash ^= static_cast<uint8_t>(name[i]);
+                hash *= 0x100000001B3ULL;
+            }
+            return hash;
+        }
+
+    private:
+        /**
+         * @brief Parse "a.b.c.d:port" or "[v6]:port"
+         */
+        static bool parseHostPort(const char* text, EndpointAddress& out) noexcept
+        {
+            char host[INET6_ADDRSTRLEN];
+            const char* host_begin = text;
+            const char* host_end = nullptr;
+            const char* port_text = nullptr;
+
+            if (*text == '[') {
+                host_begin = text + 1;
+                host_end = std::strchr(host_begin, ']');
+                if (host_end == nullptr || host_end[1] != ':') {
+                    return false;
+                }
+                port_text = host_end + 2;
+                out.family = AF_INET6;
+            } else {
+                host_end = std::strrchr(text, ':');
+                if (host_end == nullptr) {
+                    return false;
+                }
+                port_text = host_end + 1;
+                out.family = AF_INET;
+            }
+
+            const size_t host_length = static_cast<size_t>(host_end - host_begin);
+            if (host_length == 0 || host_length >= sizeof(host)) {
+                return false;
+            }
+            std::memcpy(host, host_begin, host_length);
+            host[host_length] = '\0';
+            if (inet_pton(out.family, host, out.address) != 1) {
+                return false;
+            }
+
+            char* port_end = nullptr;
+            const unsigned long port = std::strtoul(port_text, &port_end, 10);
+            if (port_end == port_text || *port_end != '\0' || port == 0 || port > UINT16_MAX) {
+                return false;
+            }
+            out.port_be = htons(static_cast<uint16_t>(port));
+            return true;
+        }
+    };
+
+    static_assert(sizeof(EndpointAddress) == 32, "EndpointAddress must be exactly 32 bytes");
+
+} // namespace registry
+} // namespace com
+} // namespace lap
+
+#endif // LAP_COM_REGISTRY_ENDPOINT_ADDRESS_HPP
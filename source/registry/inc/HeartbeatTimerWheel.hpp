@@ -0,0 +1,251 @@
+/**
+ * @file        HeartbeatTimerWheel.hpp
+ * @author      LightAP Development Team
+ * @brief       Hashed timer wheel scheduling per-slot heartbeat refreshes
+ * @date        2025-11-20
+ * @details     Used by the Runtime heartbeat worker to refresh every slot offered by
+ *              the process at its own heartbeat_interval_ms instead of a fixed sleep.
+ *              Slots due in the same tick are collected into one batch, so a single
+ *              clock read and one pass over the registry serve all of them.
+ * @copyright   Copyright (c) 2025
+ * @note        AUTOSAR R24-11 Compliance:
+ *              - SWS_CM_00125: Service health monitoring (heartbeat)
+ * @reference   Varghese & Lauck, "Hashed and Hierarchical Timing Wheels" (scheme 6)
+ */
+#ifndef LAP_COM_REGISTRY_HEARTBEAT_TIMER_WHEEL_HPP
+#define LAP_COM_REGISTRY_HEARTBEAT_TIMER_WHEEL_HPP
+
+#include "SharedMemoryRegistry.hpp"
+
+#include <array>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+namespace lap
+{
+namespace com
+{
+namespace registry
+{
+    /**
+     * @brief Hashed timer wheel of HeartbeatTarget entries
+     *
+     * @details A target due at time t (ms) lives in bucket (t / tick) % WHEEL_SIZE.
+     *          Intervals longer than one wheel revolution (WHEEL_SIZE × tick) stay
+     *          in their bucket for several rounds; Collect() compares due_ms so
+     *          such entries are only fired in the right round.
+     *
+     * @note Not thread-safe: the owner serializes access (Runtime heartbeat mutex)
+     * @note Time is a caller-supplied monotonic millisecond value (steady clock)
+     */
+    class HeartbeatTimerWheel final
+    {
+    public:
+        /// Number of buckets (one revolution = WHEEL_SIZE × tick)
+        static constexpr uint32_t WHEEL_SIZE = 256;
+
+        /// Default tick (10 ms → 2.56 s per revolution)
+        static constexpr uint32_t DEFAULT_TICK_MS = 10;
+
+        /// Returned by NextDeadlineMs() when nothing is scheduled
+        static constexpr uint64_t NO_DEADLINE = std::numeric_limits<uint64_t>::max();
+
+        /**
+         * @brief Constructor
+         * @param tick_ms Wheel resolution in milliseconds (0 is treated as 1)
+         */
+        explicit HeartbeatTimerWheel(uint32_t tick_ms = DEFAULT_TICK_MS) noexcept
+            : tick_ms_(tick_ms == 0 ? 1 : tick_ms)
+            , cursor_tick_(0)
+            , size_(0)
+        {
+        }
+
+        /**
+         * @brief Schedule the first refresh of a target one interval from now
+         * @param target Slot to refresh (due_ms is overwritten)
+         * @param now_ms Current time in milliseconds
+         *
+         * @note An interval of 0 is refreshed once per tick
+         */
+        void Schedule(HeartbeatTarget target, uint64_t now_ms)
+        {
+            if (target.interval_ms == 0) {
+                target.interval_ms = tick_ms_;
+            }
+            target.due_ms = now_ms + target.interval_ms;
+            if (size_ == 0) {
+                cursor_tick_ = std::max(cursor_tick_, now_ms / tick_ms_);
+            }
+            insert(target);
+        }
+
+        /**
+         * @brief Remove all targets of a service instance
+         * @param service_id Service ID
+         * @param instance_id Instance ID
+         * @return Number of removed targets (2 for broadcast services)
+         */
+        uint32_t Cancel(uint64_t service_id, uint64_t instance_id) noexcept
+        {
+            uint32_t removed = 0;
+            for (auto& bucket : buckets_) {
+                for (size_t i = 0; i < bucket.size();) {
+                    if (bucket[i].service_id == service_id && bucket[i].instance_id == instance_id) {
+                        bucket[i] = bucket.back();
+                        bucket.pop_back();
+                        ++removed;
+                    } else {
+                        ++i;
+                    }
+                }
+            }
+            size_ -= removed;
+            return removed;
+        }
+
+        /**
+         * @brief Look up a scheduled instance of a service
+         * @param service_id Service ID
+         * @return Instance ID of the first scheduled target of service_id
+         *         (empty if none is scheduled)
+         */
+        [[nodiscard]] Optional<uint64_t> FindInstance(uint64_t service_id) const noexcept
+        {
+            for (const auto& bucket : buckets_) {
+                for (const auto& target : bucket) {
+                    if (target.service_id == service_id) {
+                        return Optional<uint64_t>(target.instance_id);
+                    }
+                }
+            }
+            return Optional<uint64_t>{};
+        }
+
+        /**
+         * @brief Remove all targets
+         */
+        void Clear() noexcept
+        {
+            for (auto& bucket : buckets_) {
+                bucket.clear();
+            }
+            size_ = 0;
+        }
+
+        /**
+         * @brief Collect every target due at now_ms and reschedule it
+         * @param now_ms Current time in milliseconds
+         * @param due Output (appended) - targets to refresh in this batch
+         *
+         * @details Visits the buckets from the last collected tick up to now
+         *          (at most one revolution). Fired targets are rescheduled at
+         *          now + interval, so a late worker does not burst to catch up.
+         */
+        void Collect(uint64_t now_ms, Vector<HeartbeatTarget>& due)
+        {
+            const uint64_t now_tick = now_ms / tick_ms_;
+            const size_t first = due.size();
+
+            if (size_ != 0 && now_tick >= cursor_tick_) {
+                const uint64_t last_tick = std::min(now_tick, cursor_tick_ + WHEEL_SIZE - 1);
+                for (uint64_t tick = cursor_tick_; tick <= last_tick; ++tick) {
+                    auto& bucket = buckets_[tick % WHEEL_SIZE];
+                    for (size_t i = 0; i < bucket.size();) {
+                        if (bucket[i].due_ms <= now_ms) {
+                            due.push_back(bucket[i]);
+                            bucket[i] = bucket.back();
+                            bucket.pop_back();
+                            --size_;
+                        } else {
+                            ++i;
+                        }
+                    }
+                }
+            }
+
+            // Bucket now_tick may still hold targets due later in this tick
+            cursor_tick_ = std::max(cursor_tick_, now_tick);
+
+            for (size_t i = first; i < due.size(); ++i) {
+                HeartbeatTarget next = due[i];
+                next.due_ms = now_ms + next.interval_ms;
+                insert(next);
+            }
+        }
+
+        /**
+         * @brief Earliest time at which Collect() may find a due target
+         * @return Deadline in milliseconds, or NO_DEADLINE if empty
+         *
+         * @note For later buckets the bucket start is returned; this may be
+         *       earlier than the real due time (multi-round entry), never later
+         */
+        [[nodiscard]] uint64_t NextDeadlineMs() const noexcept
+        {
+            if (size_ == 0) {
+                return NO_DEADLINE;
+            }
+
+            // Current bucket: exact due time of entries left in this tick
+            const uint64_t tick_end_ms = (cursor_tick_ + 1) * tick_ms_;
+            uint64_t current_min = NO_DEADLINE;
+            for (const auto& target : buckets_[cursor_tick_ % WHEEL_SIZE]) {
+                current_min = std::min(current_min, target.due_ms);
+            }
+            if (current_min < tick_end_ms) {
+                return current_min;
+            }
+
+            for (uint64_t tick = cursor_tick_ + 1; tick < cursor_tick_ + WHEEL_SIZE; ++tick) {
+                if (!buckets_[tick % WHEEL_SIZE].empty()) {
+                    return tick * tick_ms_;
+                }
+            }
+            // Only multi-round entries left in the current bucket
+            return std::min(current_min, tick_end_ms + (WHEEL_SIZE - 1) * uint64_t{tick_ms_});
+        }
+
+        /**
+         * @brief Visit every scheduled target in place (e.g. to re-resolve slots)
+         * @param fn Callable taking HeartbeatTarget&; must not change due_ms
+         */
+        template <typename F>
+        void ForEach(F&& fn)
+        {
+            for (auto& bucket : buckets_) {
+                for (auto& target : bucket) {
+                    fn(target);
+                }
+            }
+        }
+
+        /**
+         * @brief Number of scheduled targets
+         */
+        [[nodiscard]] size_t Size() const noexcept { return size_; }
+
+        /**
+         * @brief Wheel resolution in milliseconds
+         */
+        [[nodiscard]] uint32_t GetTickMs() const noexcept { return tick_ms_; }
+
+    private:
+        void insert(const HeartbeatTarget& target)
+        {
+            buckets_[(target.due_ms / tick_ms_) % WHEEL_SIZE].push_back(target);
+            ++size_;
+        }
+
+        std::array<Vector<HeartbeatTarget>, WHEEL_SIZE> buckets_;  ///< Hashed buckets
+        uint32_t tick_ms_;                                         ///< Resolution
+        uint64_t cursor_tick_;                                     ///< Last collected tick
+        size_t size_;                                              ///< Scheduled targets
+    };
+
+} // namespace registry
+} // namespace com
+} // namespace lap
+
+#endif // LAP_COM_REGISTRY_HEARTBEAT_TIMER_WHEEL_HPP
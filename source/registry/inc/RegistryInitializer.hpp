@@ -5,15 +5,17 @@
  * @date        2025-11-20
  * @details     Implements Phase 2 of SERVICE_DISCOVERY_ARCHITECTURE.md §2.2.2:
  *              - Creates single memfd for registry (QM or ASIL)
- *              - Listens on Unix Domain Socket
+ *              - Listens on Unix Domain Socket (epoll, non-blocking accept)
  *              - Passes memfd FD to clients via SCM_RIGHTS
+ *              - Reaps slots of crashed owners (pidfd + epoll)
+ *              - Grows the registry online into a larger successor memfd
  *              - Intended for systemd socket activation
  * @copyright   Copyright (c) 2025
  * @note        AUTOSAR R24-11 Compliance:
  *              - SWS_CM_00001: Service discovery infrastructure
  *              - SWS_CM_00110: Registry lifecycle management
  * @reference   SERVICE_DISCOVERY_ARCHITECTURE.md §2.2.2 (UDS FD Passing)
- *              unix(7), cmsg(3), systemd.socket(5)
+ *              unix(7), cmsg(3), epoll(7), eventfd(2), systemd.socket(5)
  * @version     1.0
  */
 #ifndef LAP_COM_REGISTRY_REGISTRY_INITIALIZER_HPP
@@ -25,7 +27,9 @@
 #include <lap/core/CString.hpp>
 
 #include <cstdint>
+#include <algorithm>
 #include <atomic>
+#include <memory>
 #include <thread>
 #include <sys/socket.h>
 #include <sys/un.h>
@@ -48,7 +52,9 @@ namespace registry
      *          3. Listen on Unix Domain Socket
      *          4. Accept client connections
      *          5. Send memfd FD via SCM_RIGHTS
-     *          6. Keep running until shutdown
+     *          6. Reap slots whose owner process exited (reaper thread)
+     *          7. Grow the registry when it fills up (reaper thread)
+     *          8. Keep running until shutdown
      * 
      * @note Designed for systemd socket activation:
      *       - Socket passed via SD_LISTEN_FDS_START
@@ -57,6 +63,15 @@ namespace registry
     class RegistryInitializer
     {
     public:
+        /// Default upper bound for noticing new owners (reaper epoll timeout)
+        static constexpr uint32_t DEFAULT_REAP_INTERVAL_MS = 100;
+
+        /// listen() backlog (kernel clamps to net.core.somaxconn)
+        static constexpr int LISTEN_BACKLOG = SOMAXCONN;
+
+        /// Events handled per epoll_wait() of the accept loop
+        static constexpr int MAX_ACCEPT_EVENTS = 64;
+
         /**
          * @brief Constructor
          * @param registry_type Type of registry (QM or ASIL)
@@ -82,9 +97,9 @@ namespace registry
          * 
          * @details Steps:
          *          1. Create memfd
-         *          2. Resize to 256KB
+         *          2. Resize to RegistryLayout::TotalSize(slot count)
          *          3. mmap to process space
-         *          4. Initialize slots to IDLE
+         *          4. Format header, tag table and slots (IDLE)
          *          5. Seal memfd (F_SEAL_SHRINK|GROW|SEAL)
          */
         Result<void> Initialize() noexcept;
@@ -94,12 +109,83 @@ namespace registry
          * @param use_systemd_socket If true, use systemd-provided socket (SD_LISTEN_FDS_START)
          * @return Result indicating success or error
          * 
-         * @details Blocks until shutdown
+         * @details Blocks until shutdown. Starts the owner reaper thread, which
+         *          also handles registry growth (owner reaping itself can be
+         *          disabled with SetReapInterval(0)); it is joined before returning.
+         *          The listening socket is non-blocking and watched by epoll; each
+         *          wakeup drains the accept queue (accept4 until EAGAIN), so a boot
+         *          storm of clients is served in batches instead of one accept()
+         *          per wakeup. Clients whose send buffer is full are parked for
+         *          EPOLLOUT instead of blocking the loop.
          */
         Result<void> Run(bool use_systemd_socket = false) noexcept;
+
+        /**
+         * @brief Configure the crash-owner reaper
+         * @param interval_ms Maximum delay before a newly registered owner is
+         *        watched (0 disables reaping); must be set before Run()
+         * 
+         * @note Owner exits are detected immediately via pidfd, the interval only
+         *       bounds how often the registry generation is checked for new owners
+         * @note With 0 the thread keeps running for growth (auto-grow and
+         *       RequestResize()), polling every DEFAULT_REAP_INTERVAL_MS
+         */
+        void SetReapInterval(uint32_t interval_ms) noexcept { reap_interval_ms_ = interval_ms; }
+
+        /**
+         * @brief Get number of slots reclaimed from dead owners
+         * @return Reclaimed slot count since start
+         */
+        uint64_t GetReapedCount() const noexcept { return reaped_count_.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Get number of clients the memfd was sent to
+         * @return Served client count since start
+         */
+        uint64_t GetServedCount() const noexcept { return served_count_.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Select memfd backing (huge pages) and mapping options (populate, mlock)
+         * @param options Memory options; must be set before Initialize()
+         * 
+         * @note Huge pages fall back to regular pages if the pool is exhausted
+         */
+        void SetMemoryOptions(const RegistryMemoryOptions& options) noexcept { memory_options_ = options; }
+
+        /**
+         * @brief Configure the registry capacity
+         * @param slot_count Initial slot count; must be set before Initialize()
+         * @param max_slot_count Online growth limit (equal to slot_count = fixed size)
+         * 
+         * @details Once GROW_LOAD_PERCENT of the slots are active, the reaper
+         *          thread formats a memfd with twice the slots (up to
+         *          max_slot_count), migrates all instances into it, retires the
+         *          old one and serves the new memfd to connecting clients.
+         *          Clients follow via SharedMemoryRegistry::Refresh().
+         */
+        void SetSlotCount(uint32_t slot_count, uint32_t max_slot_count) noexcept
+        {
+            slot_count_.store(slot_count, std::memory_order_relaxed);
+            max_slot_count_ = std::max(slot_count, max_slot_count);
+        }
+
+        /**
+         * @brief Get the slot count of the currently served registry
+         */
+        uint32_t GetSlotCount() const noexcept { return slot_count_.load(std::memory_order_acquire); }
+
+        /**
+         * @brief Ask the reaper thread to grow the registry to slot_count slots
+         * @param slot_count New slot count (ignored unless larger than the current one)
+         * 
+         * @note Async-signal-safe; handled within one reap interval (or
+         *       DEFAULT_REAP_INTERVAL_MS if reaping is disabled)
+         */
+        void RequestResize(uint32_t slot_count) noexcept { resize_request_.store(slot_count, std::memory_order_release); }
         
         /**
          * @brief Shutdown the server (can be called from signal handler)
+         * @note Wakes the accept loop through an eventfd (async-signal-safe)
          */
         void Shutdown() noexcept;
         
@@ -107,20 +193,33 @@ namespace registry
          * @brief Get memfd file descriptor (for testing)
          * @return memfd FD or -1 if not initialized
          */
-        int GetMemfd() const noexcept { return memfd_; }
+        int GetMemfd() const noexcept { return memfd_.load(std::memory_order_acquire); }
         
         /**
          * @brief Get mapped registry slots (for testing)
          * @return Pointer to slot array or nullptr if not initialized
+         * @note Not synchronized with an online resize (reaper thread)
          */
         ServiceSlot* GetSlots() const noexcept { return slots_; }
         
     private:
         /**
-         * @brief Create and initialize memfd
+         * @brief Create, map, format and seal a registry memfd
+         * @param slot_count Number of slots
+         * @param fd Output - memfd
+         * @param base Output - mapping address
+         * @param size Output - memfd/mapping size
          * @return Result indicating success or error
          */
-        Result<void> createMemfd() noexcept;
+        Result<void> createMemfd(uint32_t slot_count, int& fd, void*& base, size_t& size) noexcept;
+
+        /**
+         * @brief Migrate the served registry into a new memfd with slot_count slots
+         * @param slot_count New slot count (larger than the current one)
+         * @return Result indicating success or error (old registry stays served)
+         * @note Runs on the reaper thread, the only user of registry_view_
+         */
+        Result<void> growRegistry(uint32_t slot_count) noexcept;
         
         /**
          * @brief Create Unix domain socket
@@ -130,31 +229,76 @@ namespace registry
         Result<void> createSocket(bool use_systemd) noexcept;
         
         /**
-         * @brief Accept client connection and send memfd FD
-         * @param client_fd Client socket file descriptor
+         * @brief Accept all pending connections and serve them
+         * @param epoll_fd Accept loop epoll instance (for parking clients)
+         * @param pending Output - clients parked for EPOLLOUT
+         * @return false if the listening socket is unusable (shut down)
+         */
+        bool acceptClients(int epoll_fd, Vector<int>& pending) noexcept;
+
+        /**
+         * @brief Send memfd FD to an accepted client
+         * @param client_fd Client socket file descriptor (non-blocking)
+         * @param would_block Output - true if the send must be retried on EPOLLOUT
          * @return Result indicating success or error
          */
-        Result<void> handleClient(int client_fd) noexcept;
+        Result<void> handleClient(int client_fd, bool& would_block) noexcept;
         
         /**
          * @brief Send memfd FD to client via SCM_RIGHTS
          * @param client_fd Client socket file descriptor
+         * @param would_block Output - true if the socket buffer is full (EAGAIN)
          * @return Result indicating success or error
          */
-        Result<void> sendMemfdToClient(int client_fd) noexcept;
+        Result<void> sendMemfdToClient(int client_fd, bool& would_block) noexcept;
+
+        /**
+         * @brief Reaper thread: watch slot owners via pidfd/epoll, reclaim on exit
+         * 
+         * @details Loop:
+         *          1. On generation change, Snapshot() the registry and open a
+         *             pidfd (pidfd_open, Linux 5.3+) for every new owner PID
+         *          2. epoll_wait on all pidfds (timeout = reap interval)
+         *          3. Readable pidfd = owner exited → ReclaimSlot() its slots
+         * 
+         * @note Without pidfd support, owners are checked with kill(pid, 0) on
+         *       every interval instead
+         * @note Owner PIDs must be valid in the daemon's PID namespace
+         */
+        void reaperLoop() noexcept;
+
+        /**
+         * @brief Reclaim all slots owned by a dead process
+         * @param owner_pid PID of the exited owner
+         * @param entries Scratch buffer for the registry snapshot
+         */
+        void reapOwner(pid_t owner_pid, Vector<ServiceSlotSummary>& entries) noexcept;
         
         // Configuration
         RegistryType registry_type_;
         String socket_path_;
         
         // Resources
-        int memfd_ = -1;                    ///< Anonymous memfd file descriptor
+        std::atomic<int> memfd_{-1};        ///< Anonymous memfd file descriptor (served to clients)
         int socket_fd_ = -1;                ///< Unix domain socket file descriptor
+        int wake_fd_ = -1;                  ///< eventfd signalled by Shutdown()
+        void* base_ = nullptr;              ///< Start of the mapping (RegistryHeader)
+        size_t mapped_size_ = 0;            ///< Size of memfd_ and its mapping
         ServiceSlot* slots_ = nullptr;      ///< Mapped registry slots
+        std::unique_ptr<SingleRegistry> registry_view_;  ///< Registry API view on memfd_ (used by the reaper)
+        Vector<int> retired_memfds_;        ///< Memfds replaced by growRegistry() (closed on destruction)
+        Vector<std::pair<void*, size_t>> retired_mappings_;  ///< Their mappings (GetSlots() users)
         
         // Runtime state
         std::atomic<bool> running_{false};  ///< Server running flag
-        std::thread accept_thread_;         ///< Client acceptance thread
+        std::thread reaper_thread_;         ///< Crash-owner reaper thread
+        uint32_t reap_interval_ms_ = DEFAULT_REAP_INTERVAL_MS;  ///< Reaper epoll timeout (0 = off)
+        RegistryMemoryOptions memory_options_;  ///< Huge page / populate / mlock options
+        std::atomic<uint32_t> slot_count_{RegistryConfig::MAX_SLOTS};  ///< Slots of the served registry
+        uint32_t max_slot_count_ = RegistryConfig::MAX_SLOTS_LIMIT;    ///< Online growth limit
+        std::atomic<uint32_t> resize_request_{0};  ///< Pending RequestResize() (0 = none)
+        std::atomic<uint64_t> reaped_count_{0};  ///< Slots reclaimed from dead owners
+        std::atomic<uint64_t> served_count_{0};  ///< Clients the memfd was sent to
     };
 
 } // namespace registry
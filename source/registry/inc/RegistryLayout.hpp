@@ -0,0 +1,524 @@
+/**
+ * @file        RegistryLayout.hpp
+ * @author      LightAP Development Team
+ * @brief       Shared memory layout of a single registry memfd (header, probe tags, chains, index, slots)
+ * @date        2025-11-20
+ * @details     Describes how a registry memfd is partitioned and provides the
+ *              formatting routine shared by the server (RegistryInitializer) and
+ *              the standalone SingleRegistry::Initialize() path.
+ *
+ *              Memory layout (slot_count = N):
+ *                - [0, 256)              RegistryHeader (magic, layout version, slot count)
+ *                - [256, 1280)           statistics region (16 × 64-byte counter shards)
+ *                - [1280, +T)            probe tag table (1 byte per slot, rounded to 64)
+ *                - [1280 + T, +C)        instance chain table (4 bytes per slot, rounded to 64)
+ *                - [1280 + T + C, +N×64) ServiceIndexEntry table (hot fields, 1 line per slot)
+ *                - [..., +N×256)         ServiceSlot table (cold fields: endpoint, metadata)
+ * @copyright   Copyright (c) 2025
+ * @note        AUTOSAR R24-11 Compliance:
+ *              - SWS_CM_00110: Service Registry Management
+ * @reference   SERVICE_DISCOVERY_ARCHITECTURE.md §2.1 (Core Data Structures)
+ * sdk:
+ * platform:    Linux 5.10+
+ * project:     LightAP
+ * @version
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author          <th>Description
+ * <tr><td>2025/11/20  <td>1.0      <td>LightAP Team    <td>Versioned header + open-addressing tag table
+ * <tr><td>2025/11/20  <td>1.1      <td>LightAP Team    <td>Per-service instance chains + structure seqlock
+ * <tr><td>2025/11/20  <td>1.2      <td>LightAP Team    <td>Generation counter + futex change notification
+ * <tr><td>2025/11/20  <td>1.3      <td>LightAP Team    <td>Hot/cold split: 64-byte index table
+ * <tr><td>2025/11/20  <td>1.4      <td>LightAP Team    <td>Registry epoch + successor link for online resize
+ * <tr><td>2025/11/20  <td>1.5      <td>LightAP Team    <td>Sharded statistics region
+ * <tr><td>2025/11/25  <td>1.6      <td>LightAP Team    <td>Robust writer mutex + recovery of dead writers
+ * </table>
+ */
+#ifndef LAP_COM_REGISTRY_REGISTRY_LAYOUT_HPP
+#define LAP_COM_REGISTRY_REGISTRY_LAYOUT_HPP
+
+#include "ServiceSlot.hpp"
+
+#include "SeqLock.hpp"
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <linux/futex.h>
+#include <new>
+#include <pthread.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace lap
+{
+namespace com
+{
+namespace registry
+{
+    /**
+     * @brief Probe tag values stored in the per-slot tag table
+     * @details A tag is a one-byte fingerprint of the service ID hash. Lookups
+     *          compare tags first and only read a ServiceSlot on a tag match,
+     *          so a probe sequence costs one or two cache-line reads.
+     */
+    struct SlotTag
+    {
+        static constexpr uint8_t EMPTY     = 0;  ///< Never used: terminates a probe sequence
+        static constexpr uint8_t TOMBSTONE = 1;  ///< Previously used: probing continues past it
+        static constexpr uint8_t MIN_LIVE  = 2;  ///< Smallest tag value of an occupied slot
+    };
+
+    /**
+     * @brief Terminator of a per-service instance chain
+     * @note Slot 0 is reserved and never part of a chain
+     */
+    static constexpr uint32_t CHAIN_END = 0;
+
+    /**
+     * @brief Registry header at offset 0 of every registry memfd
+     * @details Lets clients that receive a memfd verify that they understand
+     *          its layout before touching any slot.
+     * 
+     *          structure_sequence is a registry-wide seqlock covering the tag
+     *          table, the instance chains and the identity fields of every slot
+     *          (service_id, instance_id, versions, status, owner_pid). All
+     *          register/unregister operations hold it; heartbeat updates are a
+     *          single atomic store into ServiceIndexEntry::last_heartbeat_ns.
+     *          Writers are serialized by writer_mutex, a process-shared robust
+     *          mutex on the second cache line (see RegistryWriteGuard).
+     * 
+     *          generation is incremented after every structural change and
+     *          doubles as a shared (non-private) futex word, so discovery clients
+     *          can sleep until the registry actually changes.
+     * 
+     *          Online resize: lap-registry-init formats a larger memfd (epoch + 1),
+     *          copies all active slots into it under this registry's structure
+     *          seqlock and then publishes successor_slot_count. From that point the
+     *          registry is retired: writers get kRegistryRetired and clients fetch
+     *          the successor from the daemon socket (SharedMemoryRegistry::Refresh()).
+     */
+    struct alignas(64) RegistryHeader final
+    {
+        /// Magic value identifying a LightAP registry ('LAPR')
+        static constexpr uint32_t MAGIC = 0x4C415052U;
+
+        /// Current layout version (1 = legacy headerless slot table, 2 = no instance
+        /// chains, 3 = no index table, 4 = seqlock-protected heartbeat in the index entry,
+        /// 5 = no statistics region, 6 = writer PID instead of a robust writer mutex)
+        static constexpr uint32_t LAYOUT_VERSION = 7U;
+
+        uint32_t magic;             ///< Must equal MAGIC
+        uint32_t layout_version;    ///< Must equal LAYOUT_VERSION
+        uint32_t slot_count;        ///< Number of ServiceSlots in the slot table
+        uint32_t max_probe_steps;   ///< Upper bound of a linear probe sequence
+        std::atomic<uint64_t> structure_sequence;  ///< Registry-wide seqlock (odd = writer active)
+        std::atomic<uint32_t> generation;          ///< Change counter, futex word for waiters
+        std::atomic<uint32_t> waiters;             ///< Number of processes blocked on generation
+        std::atomic<uint32_t> successor_slot_count;  ///< Slot count of the successor (0 = current registry)
+        uint32_t epoch;             ///< Resize generation of this memfd (0 = initial memfd)
+        uint8_t  _reserved[24];     ///< Reserved for future header fields (zero-filled)
+
+        /// Serializes structure writers across processes (PTHREAD_PROCESS_SHARED,
+        /// PTHREAD_MUTEX_ROBUST); kept off the line that readers poll
+        alignas(64) pthread_mutex_t writer_mutex;
+
+        /**
+         * @brief Check whether the header describes a compatible registry
+         * @return true if magic and layout version match this build
+         */
+        [[nodiscard]] bool IsValid() const noexcept
+        {
+            return magic == MAGIC && layout_version == LAYOUT_VERSION && slot_count > 1;
+        }
+    };
+
+    static_assert(offsetof(RegistryHeader, writer_mutex) == 64, "Reader fields must fit the first cache line");
+    static_assert(sizeof(RegistryHeader) == 128, "RegistryHeader must fit two cache lines");
+
+    /**
+     * @brief One cache line of registry statistics counters
+     * 
+     * @details The statistics region holds RegistryLayout::STATS_SHARDS shards.
+     *          Every process updates only the shard selected by its PID
+     *          (RegistryLayout::StatsShardOf()), with relaxed fetch_add, so
+     *          counting never waits for another process and processes rarely
+     *          share a cache line. Readers add up all shards.
+     * 
+     * @note Counters are monotonic and never reset; observers compute rates
+     *       from the difference of two reads.
+     */
+    struct alignas(64) RegistryStatsShard final
+    {
+        std::atomic<uint64_t> registrations;     ///< Successful RegisterService() calls
+        std::atomic<uint64_t> unregistrations;   ///< Slots released by their owner
+        std::atomic<uint64_t> reclaims;          ///< Slots of crashed owners released by the reaper
+        std::atomic<uint64_t> heartbeats;        ///< UpdateHeartbeat() stores
+        std::atomic<uint64_t> reader_retries;    ///< Seqlock read attempts repeated because of a writer
+        std::atomic<uint64_t> reader_failures;   ///< Seqlock reads abandoned by the backoff policy
+        std::atomic<uint64_t> max_retry_streak;  ///< Most retries needed by a single read
+        std::atomic<uint64_t> writer_waits;      ///< Structure seqlock acquisitions that found it held
+
+        /**
+         * @brief Account one (possibly repeated) seqlock read
+         * @param retries Repeated attempts (SeqLockReader::Read() retry count)
+         * @param failed The read was abandoned
+         * @note Free when retries == 0, i.e. on every uncontended read
+         */
+        void RecordRead(uint32_t retries, bool failed) noexcept
+        {
+            if (retries == 0) {
+                return;
+            }
+            reader_retries.fetch_add(retries, std::memory_order_relaxed);
+            if (failed) {
+                reader_failures.fetch_add(1, std::memory_order_relaxed);
+            }
+            uint64_t streak = max_retry_streak.load(std::memory_order_relaxed);
+            while (streak < retries &&
+                   !max_retry_streak.compare_exchange_weak(streak, retries, std::memory_order_relaxed)) {
+            }
+        }
+    };
+
+    static_assert(sizeof(RegistryStatsShard) == 64, "RegistryStatsShard must fit one cache line");
+
+    /**
+     * @brief Offset/size helpers for the registry memfd layout
+     */
+    struct RegistryLayout
+    {
+        /// Bytes reserved for the header (header may grow up to this size)
+        static constexpr size_t HEADER_REGION_SIZE = 256;
+
+        /// Counter shards in the statistics region
+        static constexpr uint32_t STATS_SHARDS = 16;
+
+        /// Offset of the statistics region
+        static constexpr size_t STATS_REGION_OFFSET = HEADER_REGION_SIZE;
+
+        /// Size of the statistics region
+        static constexpr size_t STATS_REGION_SIZE = STATS_SHARDS * sizeof(RegistryStatsShard);
+
+        /// Offset of the probe tag table
+        static constexpr size_t TAG_TABLE_OFFSET = STATS_REGION_OFFSET + STATS_REGION_SIZE;
+
+        /**
+         * @brief Size of the tag table, rounded up to whole cache lines
+         * @param slot_count Number of slots
+         */
+        static constexpr size_t TagTableSize(uint32_t slot_count) noexcept
+        {
+            return (static_cast<size_t>(slot_count) + 63U) & ~static_cast<size_t>(63U);
+        }
+
+        /**
+         * @brief Offset of the instance chain table (64-byte aligned)
+         * @param slot_count Number of slots
+         */
+        static constexpr size_t ChainTableOffset(uint32_t slot_count) noexcept
+        {
+            return TAG_TABLE_OFFSET + TagTableSize(slot_count);
+        }
+
+        /**
+         * @brief Size of the instance chain table, rounded up to whole cache lines
+         * @param slot_count Number of slots
+         */
+        static constexpr size_t ChainTableSize(uint32_t slot_count) noexcept
+        {
+            return (static_cast<size_t>(slot_count) * sizeof(uint32_t) + 63U) & ~static_cast<size_t>(63U);
+        }
+
+        /**
+         * @brief Offset of the ServiceIndexEntry table (64-byte aligned)
+         * @param slot_count Number of slots
+         */
+        static constexpr size_t IndexTableOffset(uint32_t slot_count) noexcept
+        {
+            return ChainTableOffset(slot_count) + ChainTableSize(slot_count);
+        }
+
+        /**
+         * @brief Offset of the ServiceSlot table (64-byte aligned)
+         * @param slot_count Number of slots
+         */
+        static constexpr size_t SlotTableOffset(uint32_t slot_count) noexcept
+        {
+            return IndexTableOffset(slot_count) + static_cast<size_t>(slot_count) * sizeof(ServiceIndexEntry);
+        }
+
+        /**
+         * @brief Total memfd size for a registry with slot_count slots
+         * @param slot_count Number of slots
+         */
+        static constexpr size_t TotalSize(uint32_t slot_count) noexcept
+        {
+            return SlotTableOffset(slot_count) + static_cast<size_t>(slot_count) * sizeof(ServiceSlot);
+        }
+
+        static RegistryHeader* Header(void* base) noexcept
+        {
+            return static_cast<RegistryHeader*>(base);
+        }
+
+        static RegistryStatsShard* Stats(void* base) noexcept
+        {
+            return reinterpret_cast<RegistryStatsShard*>(static_cast<uint8_t*>(base) + STATS_REGION_OFFSET);
+        }
+
+        /**
+         * @brief Statistics shard updated by the process pid
+         */
+        static constexpr uint32_t StatsShardOf(pid_t pid) noexcept
+        {
+            return static_cast<uint32_t>(pid) % STATS_SHARDS;
+        }
+
+        static std::atomic<uint8_t>* Tags(void* base) noexcept
+        {
+            return reinterpret_cast<std::atomic<uint8_t>*>(static_cast<uint8_t*>(base) + TAG_TABLE_OFFSET);
+        }
+
+        static std::atomic<uint32_t>* Chains(void* base, uint32_t slot_count) noexcept
+        {
+            return reinterpret_cast<std::atomic<uint32_t>*>(
+                static_cast<uint8_t*>(base) + ChainTableOffset(slot_count));
+        }
+
+        static ServiceIndexEntry* Index(void* base, uint32_t slot_count) noexcept
+        {
+            return reinterpret_cast<ServiceIndexEntry*>(
+                static_cast<uint8_t*>(base) + IndexTableOffset(slot_count));
+        }
+
+        static ServiceSlot* Slots(void* base, uint32_t slot_count) noexcept
+        {
+            return reinterpret_cast<ServiceSlot*>(static_cast<uint8_t*>(base) + SlotTableOffset(slot_count));
+        }
+
+        /**
+         * @brief Format a freshly mapped memfd (header, zeroed statistics, empty tags and
+         *        chains, IDLE index/slots)
+         * @param base Start of the mapping (at least TotalSize(slot_count) bytes)
+         * @param slot_count Number of slots
+         * @param max_probe_steps Probe sequence bound recorded in the header
+         * @param epoch Resize generation recorded in the header
+         * @note The header is written last so that a valid magic implies a formatted registry
+         */
+        static void Format(void* base, uint32_t slot_count, uint32_t max_probe_steps, uint32_t epoch = 0) noexcept
+        {
+            RegistryStatsShard* stats = Stats(base);
+            for (uint32_t i = 0; i < STATS_SHARDS; ++i)
+            {
+                new (&stats[i]) RegistryStatsShard{};
+            }
+
+            std::atomic<uint8_t>* tags = Tags(base);
+            for (uint32_t i = 0; i < slot_count; ++i)
+            {
+                new (&tags[i]) std::atomic<uint8_t>(SlotTag::EMPTY);
+            }
+
+            std::atomic<uint32_t>* chains = Chains(base, slot_count);
+            for (uint32_t i = 0; i < slot_count; ++i)
+            {
+                new (&chains[i]) std::atomic<uint32_t>(CHAIN_END);
+            }
+
+            ServiceIndexEntry* index = Index(base, slot_count);
+            for (uint32_t i = 0; i < slot_count; ++i)
+            {
+                new (&index[i]) ServiceIndexEntry();
+            }
+
+            ServiceSlot* slots = Slots(base, slot_count);
+            for (uint32_t i = 0; i < slot_count; ++i)
+            {
+                new (&slots[i]) ServiceSlot();
+            }
+
+            RegistryHeader* header = new (base) RegistryHeader{};
+
+            pthread_mutexattr_t attr;
+            pthread_mutexattr_init(&attr);
+            pthread_mutexattr_setpshared(&attr, PTHREAD_PROCESS_SHARED);
+            pthread_mutexattr_setrobust(&attr, PTHREAD_MUTEX_ROBUST);
+            pthread_mutex_init(&header->writer_mutex, &attr);
+            pthread_mutexattr_destroy(&attr);
+
+            header->slot_count = slot_count;
+            header->max_probe_steps = max_probe_steps;
+            header->epoch = epoch;
+            header->layout_version = RegistryHeader::LAYOUT_VERSION;
+            std::atomic_thread_fence(std::memory_order_release);
+            header->magic = RegistryHeader::MAGIC;
+        }
+    };
+
+    /**
+     * @brief Futex helpers for the registry generation word
+     * @note The word lives in a MAP_SHARED memfd mapping used by several
+     *       processes, so FUTEX_PRIVATE_FLAG must not be used.
+     */
+    struct RegistryFutex
+    {
+        /**
+         * @brief Sleep while word == expected, at most timeout
+         * @return true if woken or the value already differed, false on timeout
+         */
+        static bool Wait(std::atomic<uint32_t>& word, uint32_t expected,
+                         std::chrono::nanoseconds timeout) noexcept
+        {
+            struct timespec ts;
+            ts.tv_sec = static_cast<time_t>(timeout.count() / 1000000000LL);
+            ts.tv_nsec = static_cast<long>(timeout.count() % 1000000000LL);
+            long ret = syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT,
+                               expected, &ts, nullptr, 0);
+            return !(ret < 0 && errno == ETIMEDOUT);
+        }
+
+        /**
+         * @brief Wake all processes sleeping on word
+         */
+        static void WakeAll(std::atomic<uint32_t>& word) noexcept
+        {
+            syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAKE, INT_MAX,
+                    nullptr, nullptr, 0);
+        }
+    };
+
+    static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "Futex word must be a plain 32-bit integer");
+
+    /**
+     * @brief RAII writer of the registry-wide structure seqlock
+     * 
+     * @details Unlike SeqLockWriter, several processes may contend for the
+     *          structure seqlock. They are serialized by the header's robust
+     *          writer_mutex: ownership is recorded by the kernel in the same
+     *          atomic step as the acquisition, and a holder that dies (in any
+     *          PID namespace) hands the lock to the next writer with
+     *          EOWNERDEAD. That writer keeps or restores the odd sequence and
+     *          reports Recovered(); it must then repair the interrupted update
+     *          (SingleRegistry rebuilds torn slots and the instance chains)
+     *          before changing anything else. Releasing the lock bumps the
+     *          generation counter and wakes waiters (the futex syscall is
+     *          skipped when nobody waits).
+     * 
+     * @note Only registration paths take this lock; lookups never block on it.
+     * @note If the lock cannot be taken (ENOTRECOVERABLE, EINVAL on a foreign
+     *       or corrupted header) IsLocked() is false, the sequence is left
+     *       alone and the caller must not write.
+     * @note If stats is given, an acquisition that has to wait is counted in
+     *       RegistryStatsShard::writer_waits.
+     */
+    class RegistryWriteGuard final
+    {
+    public:
+        explicit RegistryWriteGuard(RegistryHeader& header, RegistryStatsShard* stats = nullptr) noexcept
+            : header_(header)
+        {
+            int result = pthread_mutex_trylock(&header_.writer_mutex);
+            if (result == EBUSY) {
+                if (stats != nullptr) {
+                    stats->writer_waits.fetch_add(1, std::memory_order_relaxed);
+                }
+                result = pthread_mutex_lock(&header_.writer_mutex);
+            }
+
+            if (result != 0 && result != EOWNERDEAD) {
+                return;  // Not locked: leave the sequence and the mutex alone
+            }
+            locked_ = true;
+
+            if (result == EOWNERDEAD) {
+                // Mark the mutex usable again first: if this writer dies while
+                // repairing, the next one recovers again
+                pthread_mutex_consistent(&header_.writer_mutex);
+                recovered_ = true;
+                modified_ = true;  // The repair may change the tables
+
+                // The dead writer may or may not have made the sequence odd
+                if ((header_.structure_sequence.load(std::memory_order_relaxed) & 1) != 0) {
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    return;
+                }
+            }
+
+            header_.structure_sequence.fetch_add(1, std::memory_order_acquire);
+        }
+
+        ~RegistryWriteGuard() noexcept
+        {
+            if (!locked_) {
+                return;
+            }
+
+            std::atomic_thread_fence(std::memory_order_release);
+            header_.structure_sequence.fetch_add(1, std::memory_order_release);
+
+            if (modified_) {
+                // seq_cst pairs with the waiter's increment of waiters before FUTEX_WAIT
+                header_.generation.fetch_add(1, std::memory_order_seq_cst);
+                if (header_.waiters.load(std::memory_order_seq_cst) != 0) {
+                    RegistryFutex::WakeAll(header_.generation);
+                }
+            }
+
+            pthread_mutex_unlock(&header_.writer_mutex);
+        }
+
+        /**
+         * @brief The writer lock was acquired
+         * @return false if the mutex is unusable; the registry must not be written
+         */
+        [[nodiscard]] bool IsLocked() const noexcept
+        {
+            return locked_;
+        }
+
+        /**
+         * @brief Record that the tables were changed under this lock
+         * @note Call after the change; the generation is bumped on release
+         */
+        void MarkModified() noexcept
+        {
+            modified_ = true;
+        }
+
+        /**
+         * @brief The previous writer died holding the lock
+         * @return true if its update may be half done and must be repaired
+         */
+        [[nodiscard]] bool Recovered() const noexcept
+        {
+            return recovered_;
+        }
+
+        // Disable copy and move
+        RegistryWriteGuard(const RegistryWriteGuard&) = delete;
+        RegistryWriteGuard& operator=(const RegistryWriteGuard&) = delete;
+        RegistryWriteGuard(RegistryWriteGuard&&) = delete;
+        RegistryWriteGuard& operator=(RegistryWriteGuard&&) = delete;
+
+    private:
+        RegistryHeader& header_;  ///< Header of the mapped registry
+        bool locked_{false};      ///< writer_mutex held by this guard
+        bool recovered_{false};   ///< Lock taken over from a dead writer
+        bool modified_{false};    ///< Tables changed: bump generation on release
+    };
+
+    static_assert(sizeof(std::atomic<uint8_t>) == 1, "Tag table requires 1-byte atomics");
+    static_assert(sizeof(std::atomic<uint32_t>) == 4, "Chain table requires 4-byte atomics");
+    static_assert(RegistryLayout::STATS_REGION_OFFSET % 64 == 0, "Statistics region must be cache-line aligned");
+    static_assert(RegistryLayout::TAG_TABLE_OFFSET % 64 == 0, "Tag table must be cache-line aligned");
+    static_assert(sizeof(RegistryHeader) <= RegistryLayout::HEADER_REGION_SIZE, "RegistryHeader exceeds its region");
+
+} // namespace registry
+} // namespace com
+} // namespace lap
+
+#endif // LAP_COM_REGISTRY_REGISTRY_LAYOUT_HPP
@@ -19,6 +19,12 @@
  * <table>
  * <tr><th>Date        <th>Version  <th>Author          <th>Description
  * <tr><td>2025/11/20  <td>1.0      <td>LightAP Team    <td>Initial lock-free implementation
+ * <tr><td>2025/11/20  <td>1.1      <td>LightAP Team    <td>Batched ReadRange for registry scans
+ * <tr><td>2025/11/20  <td>1.2      <td>LightAP Team    <td>Retry counts for registry statistics
+ * <tr><td>2025/11/20  <td>1.3      <td>LightAP Team    <td>Configurable reader backoff (spin, pause, yield, futex)
+ * <tr><td>2025/11/20  <td>1.4      <td>LightAP Team    <td>SeqLocked<T, N> multi-version value for shared state
+ * <tr><td>2025/11/20  <td>1.5      <td>LightAP Team    <td>Backoff policy stored in lap_com (SeqLock.cpp)
+ * <tr><td>2025/11/20  <td>1.6      <td>LightAP Team    <td>Wait phase sleeps (writers issue no wake-ups)
  * </table>
  */
 #ifndef LAP_COM_REGISTRY_SEQLOCK_HPP
@@ -26,8 +32,14 @@
 
 #include <atomic>
 #include <cstdint>
+#include <cstring>
+#include <ctime>
 #include <type_traits>
+#include <utility>
 
+#include <sched.h>
+
+#include <core/CMacroDefine.hpp>
 #include <lap/core/CTypedef.hpp>
 #include <lap/core/COptional.hpp>
 
@@ -113,6 +125,82 @@ namespace registry
         std::atomic<uint64_t>& sequence_;  ///< Reference to slot's sequence counter
     };
 
+    /**
+     * @brief Reader backoff policy while a seqlock writer is active
+     * 
+     * @details A contended read escalates through four phases, one retry per step:
+     *          1. spin:  spin_count single PAUSEs (writers normally finish in ns)
+     *          2. pause: pause_rounds rounds of 2, 4, 8, ... PAUSEs (exponential)
+     *          3. yield: yield_count sched_yield() calls (writer preempted on this CPU)
+     *          4. wait:  wait_count sleeps (nanosleep) of wait_timeout_us while the
+     *                    sequence word is odd (writer stalled)
+     *          The read gives up only after all phases (MaxRetries() retries).
+     * 
+     * @note Writers never wake readers (no syscall on the write path), so each
+     *       wait step sleeps for the full wait_timeout_us; the phase bounds how
+     *       long a reader outlasts a preempted writer, not how fast it notices.
+     * @note Real-time readers that must not sleep set yield_count = wait_count = 0.
+     */
+    struct SeqLockBackoff
+    {
+        uint32_t spin_count = 64;       ///< Phase 1: retries with a single PAUSE
+        uint32_t pause_rounds = 6;      ///< Phase 2: retries with 2^round PAUSEs
+        uint32_t yield_count = 8;       ///< Phase 3: retries after sched_yield()
+        uint32_t wait_count = 8;        ///< Phase 4: retries after a sleep
+        uint32_t wait_timeout_us = 50;  ///< Length of one sleep
+
+        /**
+         * @brief Retries before a read gives up
+         */
+        [[nodiscard]] uint32_t MaxRetries() const noexcept
+        {
+            return spin_count + pause_rounds + yield_count + wait_count;
+        }
+
+        /**
+         * @brief Back off before retry number `retry` (1-based)
+         * @param sequence Sequence word the reader is waiting on
+         * @param retry Retry about to be made
+         * @return false if the retry budget is exhausted (give up)
+         */
+        bool Wait(const std::atomic<uint64_t>& sequence, uint32_t retry) const noexcept
+        {
+            uint32_t step = retry - 1;
+            if (step < spin_count) {
+                LAP_CPU_PAUSE();
+                return true;
+            }
+            step -= spin_count;
+            if (step < pause_rounds) {
+                const uint32_t pauses = 2U << (step < 15U ? step : 15U);
+                for (uint32_t i = 0; i < pauses; ++i) {
+                    LAP_CPU_PAUSE();
+                }
+                return true;
+            }
+            step -= pause_rounds;
+            if (step < yield_count) {
+                sched_yield();
+                return true;
+            }
+            step -= yield_count;
+            if (step < wait_count) {
+                const uint64_t observed = sequence.load(std::memory_order_relaxed);
+                if (observed & 1) {
+                    // Writer stalled mid-update: give its CPU time back
+                    struct timespec ts;
+                    ts.tv_sec = static_cast<time_t>(wait_timeout_us / 1000000U);
+                    ts.tv_nsec = static_cast<long>(wait_timeout_us % 1000000U) * 1000L;
+                    nanosleep(&ts, nullptr);
+                } else {
+                    sched_yield();  // Writers keep overlapping the read: let them finish
+                }
+                return true;
+            }
+            return false;
+        }
+    };
+
     /**
      * @brief seqlock reader operations (lock-free reads with retry)
      */
@@ -120,10 +208,28 @@ namespace registry
     {
     public:
         /**
-         * @brief Maximum read retry attempts before giving up
-         * @note Prevents infinite loops under heavy write contention
+         * @brief Replace the process-wide reader backoff policy
+         * @param backoff New policy
+         * @note Not synchronized with concurrent reads: set it during
+         *       initialization, before reader threads start
+         * @note Defined in lap_com (SeqLock.cpp), so the policy is shared by the
+         *       application and the lookups made inside the library
          */
-        static constexpr uint32_t MAX_RETRY_COUNT = 1000;
+        LAP_COM_API static void SetBackoff(const SeqLockBackoff& backoff) noexcept;
+
+        /**
+         * @brief Get the process-wide reader backoff policy
+         */
+        LAP_COM_API static const SeqLockBackoff& GetBackoff() noexcept;
+
+        /**
+         * @brief Check whether a read with this retry count gave up on contention
+         * @param retry_count Retry count reported by Read()/ReadSlot()
+         */
+        static bool GaveUp(uint32_t retry_count) noexcept
+        {
+            return retry_count > GetBackoff().MaxRetries();
+        }
 
         /**
          * @brief Perform lock-free read with retry on write conflict
@@ -132,7 +238,8 @@ namespace registry
          * @tparam ReadFunc Callable that extracts data from slot
          * @param slot The slot to read from
          * @param read_func Lambda/function to extract desired data
-         * @return Optional<ReturnType> Value if read succeeds, empty if max retries exceeded
+         * @return Optional<ReturnType> Value if read succeeds, empty if the
+         *         backoff budget is exhausted (write contention)
          * 
          * @details Read algorithm:
          *          1. Read sequence (must be even)
@@ -140,7 +247,7 @@ namespace registry
          *          3. Read slot data via read_func
          *          4. Apply memory barrier
          *          5. Re-read sequence, verify it matches step 1
-         *          6. If mismatch or odd → retry from step 1
+         *          6. If mismatch or odd → back off (SeqLockBackoff), retry from step 1
          * 
          * @example Usage:
          *          auto endpoint = SeqLockReader::Read(slot, [](const auto& s) {
@@ -152,11 +259,29 @@ namespace registry
         template<typename SlotType, typename ReadFunc>
         static auto Read(const SlotType& slot, ReadFunc&& read_func) noexcept
             -> lap::core::Optional<decltype(read_func(slot))>
+        {
+            uint32_t retries = 0;
+            return Read(slot, std::forward<ReadFunc>(read_func), retries);
+        }
+
+        /**
+         * @brief Read() that also reports how often the read had to be repeated
+         * @param slot The slot to read from
+         * @param read_func Lambda/function to extract desired data
+         * @param retry_count Output: repeated attempts (0 = first attempt was
+         *        consistent, GaveUp(retry_count) = failed due to contention)
+         * @return Optional<ReturnType> Value if read succeeds, empty on contention
+         * 
+         * @note Feeds the registry statistics region (reader retries, retry streaks)
+         */
+        template<typename SlotType, typename ReadFunc>
+        static auto Read(const SlotType& slot, ReadFunc&& read_func, uint32_t& retry_count) noexcept
+            -> lap::core::Optional<decltype(read_func(slot))>
         {
             using ReturnType = decltype(read_func(slot));
             
             uint64_t seq1, seq2;
-            uint32_t retry_count = 0;
+            retry_count = 0;
 
             do {
                 // Step 1: Read sequence (must be even, indicating no active write)
@@ -164,11 +289,8 @@ namespace registry
                 
                 // Check if write is in progress (sequence is odd)
                 if (seq1 & 1) {
-                    // Writer is active, yield CPU and retry
-                    LAP_CPU_PAUSE();
-                    
-                    if (++retry_count > MAX_RETRY_COUNT) {
-                        // Max retries exceeded (write contention too high)
+                    // Writer is active: back off, give up once the budget is spent
+                    if (!GetBackoff().Wait(slot.sequence, ++retry_count)) {
                         return lap::core::Optional<ReturnType>{};
                     }
                     continue;
@@ -193,10 +315,7 @@ namespace registry
                 }
 
                 // Sequence mismatch: write occurred during read, retry
-                LAP_CPU_PAUSE();
-                
-                if (++retry_count > MAX_RETRY_COUNT) {
-                    // Max retries exceeded
+                if (!GetBackoff().Wait(slot.sequence, ++retry_count)) {
                     return lap::core::Optional<ReturnType>{};
                 }
 
@@ -219,6 +338,100 @@ namespace registry
             });
         }
 
+        /**
+         * @brief ReadSlot() that also reports the retry count (see Read())
+         */
+        template<typename SlotType>
+        static lap::core::Optional<SlotType> ReadSlot(const SlotType& slot, uint32_t& retry_count) noexcept
+        {
+            return Read(slot, [](const SlotType& s) -> SlotType {
+                return s;  // Full copy
+            }, retry_count);
+        }
+
+        /**
+         * @brief Number of slots validated by one fence pair in ReadRange()
+         */
+        static constexpr uint32_t RANGE_BATCH_SIZE = 32;
+
+        /**
+         * @brief Batched lock-free read of contiguous slots
+         * 
+         * @tparam SlotType Type of the slots being read (usually ServiceSlot)
+         * @tparam ReadFunc Callable returning Optional<T> (empty = skip this slot)
+         * @tparam Consumer Callable invoked as consumer(index, T&&) for each consistent result
+         * @param slots First slot of the range
+         * @param count Number of slots in the range
+         * @param read_func Extracts the wanted fields (e.g. only from active slots)
+         * @param consumer Receives results in slot order, index relative to slots
+         * @param retries Optional output, incremented by the repeated attempts of
+         *        slots that changed during their batch
+         * @return Number of slots that could not be read consistently
+         * 
+         * @details Read algorithm (per batch of RANGE_BATCH_SIZE slots):
+         *          1. Load all sequences, one acquire fence
+         *          2. Apply read_func to every slot with an even sequence
+         *          3. One acquire fence, re-load all sequences
+         *          4. Deliver unchanged slots; re-read only changed/odd slots
+         *             with Read() (bounded by the backoff policy)
+         * 
+         * @note Compared to calling ReadSlot() per slot this issues two fences per
+         *       batch instead of per slot and copies only what read_func returns.
+         */
+        template<typename SlotType, typename ReadFunc, typename Consumer>
+        static uint32_t ReadRange(
+            const SlotType* slots, uint32_t count, ReadFunc&& read_func, Consumer&& consumer,
+            uint32_t* retries = nullptr) noexcept
+        {
+            using ResultType = decltype(read_func(*slots));
+
+            uint64_t sequences[RANGE_BATCH_SIZE];
+            ResultType results[RANGE_BATCH_SIZE];
+            uint32_t failed = 0;
+
+            for (uint32_t base = 0; base < count; base += RANGE_BATCH_SIZE) {
+                const uint32_t batch = (count - base < RANGE_BATCH_SIZE) ? (count - base) : RANGE_BATCH_SIZE;
+
+                // Step 1: Snapshot sequences of the whole batch
+                for (uint32_t i = 0; i < batch; ++i) {
+                    sequences[i] = slots[base + i].sequence.load(std::memory_order_relaxed);
+                }
+                std::atomic_thread_fence(std::memory_order_acquire);
+
+                // Step 2: Read data of slots without an active writer
+                for (uint32_t i = 0; i < batch; ++i) {
+                    results[i] = (sequences[i] & 1) ? ResultType{} : read_func(slots[base + i]);
+                }
+
+                // Step 3: Validate the whole batch
+                std::atomic_thread_fence(std::memory_order_acquire);
+                for (uint32_t i = 0; i < batch; ++i) {
+                    const SlotType& slot = slots[base + i];
+                    if ((sequences[i] & 1) == 0 &&
+                        slot.sequence.load(std::memory_order_relaxed) == sequences[i]) {
+                        if (results[i].has_value()) {
+                            consumer(base + i, std::move(results[i].value()));
+                        }
+                        continue;
+                    }
+
+                    // Step 4: Slot changed during the batch, retry it alone
+                    uint32_t slot_retries = 0;
+                    auto retried = Read(slot, read_func, slot_retries);
+                    if (retries != nullptr) {
+                        *retries += 1 + slot_retries;
+                    }
+                    if (!retried.has_value()) {
+                        ++failed;
+                    } else if (retried.value().has_value()) {
+                        consumer(base + i, std::move(retried.value().value()));
+                    }
+                }
+            }
+
+            return failed;
+        }
+
         /**
          * @brief Check if slot sequence is currently stable (even value)
          * @param sequence Atomic sequence counter to check
@@ -233,6 +446,123 @@ namespace registry
         }
     };
 
+    /**
+     * @brief Single-writer seqlocked value with a ring of N versions
+     * 
+     * @tparam T Trivially copyable payload (must not point into process memory)
+     * @tparam N Buffers in the version ring (2 = double buffering)
+     * 
+     * @details Store() writes version v+1 into buffer (v+1) % N under that
+     *          buffer's sequence, then publishes v+1. Load() copies the buffer
+     *          of the newest published version. With N >= 2 the writer fills a
+     *          buffer readers are not directed to, so a reader only retries if
+     *          the writer laps the whole ring during one copy; a larger N
+     *          tolerates slower readers of large T at N × sizeof(T) memory.
+     *          Latest value wins: intermediate versions may be skipped.
+     * 
+     * @note Position independent and valid when zero-filled (= never written),
+     *       so it can live directly in a memfd/shm mapping shared by processes.
+     *       Exactly one writer at a time; any number of readers.
+     * 
+     * @example Writer:  state.Store(pose);
+     * @example Reader:  if (state.Load(pose) != 0) { ... }
+     */
+    template<typename T, uint32_t N = 2>
+    class SeqLocked final
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "SeqLocked<T> requires a trivially copyable T");
+        static_assert(N >= 1, "SeqLocked<T, N> requires at least one buffer");
+        static_assert(std::atomic<uint64_t>::is_always_lock_free,
+                      "SeqLocked<T> must be lock-free to be shared between processes");
+
+    public:
+        static constexpr uint32_t BUFFER_COUNT = N;
+
+        SeqLocked() noexcept = default;
+        SeqLocked(const SeqLocked&) = delete;
+        SeqLocked& operator=(const SeqLocked&) = delete;
+
+        /**
+         * @brief Publish a new value (single writer)
+         * @param value Value to publish
+         * @return Version assigned to value (1, 2, ...)
+         */
+        uint64_t Store(const T& value) noexcept
+        {
+            const uint64_t next = version_.load(std::memory_order_relaxed) + 1;
+            Buffer& buffer = buffers_[next % N];
+            {
+                SeqLockWriter writer(buffer.sequence);
+                std::memcpy(buffer.storage, &value, sizeof(T));
+                buffer.version = next;
+            }
+            version_.store(next, std::memory_order_release);
+            return next;
+        }
+
+        /**
+         * @brief Copy the newest value
+         * @param out Receives the value (unspecified if 0 is returned)
+         * @param retry_count Attempts repeated because the writer lapped the
+         *        ring (GaveUp(retry_count) = failed due to contention)
+         * @return Version of the copied value, 0 if never written or contended
+         */
+        uint64_t Load(T& out, uint32_t& retry_count) const noexcept
+        {
+            retry_count = 0;
+            for (;;) {
+                const uint64_t published = version_.load(std::memory_order_acquire);
+                if (published == 0) {
+                    return 0;
+                }
+
+                const Buffer& buffer = buffers_[published % N];
+                const uint64_t seq1 = buffer.sequence.load(std::memory_order_acquire);
+                if ((seq1 & 1) == 0) {
+                    std::memcpy(&out, buffer.storage, sizeof(T));
+                    const uint64_t version = buffer.version;
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    if (buffer.sequence.load(std::memory_order_relaxed) == seq1) {
+                        return version;
+                    }
+                }
+
+                // Writer lapped the ring: back off, then retry on the newest buffer
+                if (!SeqLockReader::GetBackoff().Wait(buffer.sequence, ++retry_count)) {
+                    return 0;
+                }
+            }
+        }
+
+        /**
+         * @brief Load() without retry reporting
+         */
+        uint64_t Load(T& out) const noexcept
+        {
+            uint32_t retry_count = 0;
+            return Load(out, retry_count);
+        }
+
+        /**
+         * @brief Newest published version (0 = never written)
+         */
+        [[nodiscard]] uint64_t Version() const noexcept
+        {
+            return version_.load(std::memory_order_acquire);
+        }
+
+    private:
+        struct alignas(64) Buffer
+        {
+            std::atomic<uint64_t> sequence{0};
+            uint64_t version{0};
+            alignas(T) unsigned char storage[sizeof(T)]{};
+        };
+
+        alignas(64) std::atomic<uint64_t> version_{0};  ///< Newest published version
+        Buffer buffers_[N];
+    };
+
 } // namespace registry
 } // namespace com
 } // namespace lap
@@ -25,12 +25,15 @@
 #define LAP_COM_REGISTRY_SERVICE_SLOT_HPP
 
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <unistd.h>  // for pid_t
 
 #include <lap/core/CTypedef.hpp>
 
+#include "EndpointAddress.hpp"
+
 namespace lap
 {
 namespace com
@@ -54,7 +57,8 @@ namespace registry
      * @details Design rationale (from SERVICE_DISCOVERY_ARCHITECTURE.md §2.1):
      *          - 256 bytes = 4 cache lines (64-byte alignment)
      *          - seqlock ensures lock-free reads with < 100ns latency
-     *          - Fixed slot mapping: SlotIndex = ServiceID & 1023
+     *          - Slot placement: bounded linear probing (see RegistryLayout.hpp)
+     *          - Hot fields are mirrored in ServiceIndexEntry for one-line lookups
      *          - Zero-daemon: no RouDi, no central server
      * 
      * Memory layout (total 256 bytes):
@@ -63,7 +67,7 @@ namespace registry
      *   - [40-135]  network endpoint (96 bytes)
      *   - [136-159] lifecycle control (24 bytes)
      *   - [160-223] metadata (64 bytes)
-     *   - [224-255] padding (32 bytes)
+     *   - [224-255] pre-parsed endpoint (32 bytes, EndpointAddress)
      * 
      * @note AUTOSAR Requirements:
      *       - SWS_CM_00302: Each slot uniquely identifies a service instance
@@ -152,9 +156,11 @@ namespace registry
         // ========================================================================
         
         /**
-         * @brief Last heartbeat timestamp (nanoseconds since epoch)
+         * @brief Last heartbeat timestamp (nanoseconds, steady clock)
          * @note SWS_CM_00311: Used for service liveness detection
-         *       Updated by service owner periodically
+         * @note In shared memory this holds the registration time only; periodic
+         *       refreshes go to the atomic ServiceIndexEntry::last_heartbeat_ns and
+         *       are copied into slots returned by FindService()/ReadSlot()
          */
         uint64_t last_heartbeat_ns;
         
@@ -189,14 +195,17 @@ namespace registry
         char metadata[64];
 
         // ========================================================================
-        // Padding to 256 bytes (32 bytes)
+        // Pre-parsed Endpoint (32 bytes)
         // ========================================================================
         
         /**
-         * @brief Reserved padding to ensure 256-byte total size
-         * @note Ensures 4× cache-line alignment (4 × 64 = 256 bytes)
+         * @brief Binary form of `endpoint` (transport, sockaddr address, port, name hash)
+         * @details Parsed once by the registering process (same seqlock write as
+         *          the string). Connection setup uses ToSockaddr(), discovery
+         *          filters compare it with memcmp.
+         * @note Transport NONE: unknown scheme or older writer, parse `endpoint`
          */
-        uint8_t _padding[32];
+        EndpointAddress endpoint_address;
 
         // ========================================================================
         // Constructors & Methods
@@ -218,7 +227,7 @@ namespace registry
             , status(static_cast<uint32_t>(SlotStatus::IDLE))
             , owner_pid(0)
             , metadata{}
-            , _padding{}
+            , endpoint_address{}
         {
             std::memset(binding_type, 0, sizeof(binding_type));
             std::memset(endpoint, 0, sizeof(endpoint));
@@ -242,7 +251,7 @@ namespace registry
             , status(other.status)
             , owner_pid(other.owner_pid)
             , metadata{}
-            , _padding{}
+            , endpoint_address(other.endpoint_address)
         {
             std::memcpy(binding_type, other.binding_type, sizeof(binding_type));
             std::memcpy(endpoint, other.endpoint, sizeof(endpoint));
@@ -268,6 +277,7 @@ namespace registry
                 status = other.status;
                 owner_pid = other.owner_pid;
                 std::memcpy(metadata, other.metadata, sizeof(metadata));
+                endpoint_address = other.endpoint_address;
             }
             return *this;
         }
@@ -306,9 +316,152 @@ namespace registry
             status = static_cast<uint32_t>(SlotStatus::IDLE);
             owner_pid = 0;
             std::memset(metadata, 0, sizeof(metadata));
+            endpoint_address = EndpointAddress{};
         }
     };
 
+    /**
+     * @brief Hot half of a ServiceSlot: one cache line per slot for lookups
+     * 
+     * @details Lives in a 64-byte index array parallel to the slot table (see
+     *          RegistryLayout.hpp). Probing, instance chains, snapshots and
+     *          liveness checks only read this entry; the 256-byte ServiceSlot is
+     *          touched only to resolve the endpoint of a found service.
+     * 
+     * Memory layout (total 64 bytes, layout version 5):
+     *   - [0-7]     seqlock control (atomic uint64_t)
+     *   - [8-23]    service_id, instance_id          (seqlock-protected)
+     *   - [24-43]   versions, heartbeat interval,    (seqlock-protected)
+     *               status, owner_pid
+     *   - [44-55]   padding
+     *   - [56-63]   last_heartbeat_ns (independent atomic, NOT seqlock-protected)
+     * 
+     * @note Written together with its ServiceSlot, each under its own seqlock
+     * @note Heartbeat refresh is a single atomic store, so it never makes a
+     *       concurrent SeqLockReader::Read() of the entry retry
+     */
+    struct alignas(64) ServiceIndexEntry final
+    {
+        std::atomic<uint64_t> sequence;   ///< seqlock counter (odd = write in progress)
+        uint64_t service_id;              ///< Service interface ID
+        uint64_t instance_id;             ///< Service instance ID
+        uint32_t major_version;           ///< Service major version
+        uint32_t minor_version;           ///< Service minor version
+        uint32_t heartbeat_interval_ms;   ///< Heartbeat interval
+        uint32_t status;                  ///< SlotStatus of the slot
+        pid_t    owner_pid;               ///< Process ID of the service owner
+        uint8_t  _padding[12];            ///< Keeps the heartbeat in the last 8 bytes
+        std::atomic<uint64_t> last_heartbeat_ns;  ///< Last heartbeat (outside the seqlock)
+
+        /**
+         * @brief Default constructor - initializes to IDLE state
+         */
+        ServiceIndexEntry() noexcept
+            : sequence(0)
+            , service_id(0)
+            , instance_id(0)
+            , major_version(0)
+            , minor_version(0)
+            , heartbeat_interval_ms(0)
+            , status(static_cast<uint32_t>(SlotStatus::IDLE))
+            , owner_pid(0)
+            , _padding{}
+            , last_heartbeat_ns(0)
+        {
+        }
+
+        /**
+         * @brief Copy constructor - atomics are copied via load
+         */
+        ServiceIndexEntry(const ServiceIndexEntry& other) noexcept
+            : sequence(other.sequence.load(std::memory_order_relaxed))
+            , service_id(other.service_id)
+            , instance_id(other.instance_id)
+            , major_version(other.major_version)
+            , minor_version(other.minor_version)
+            , heartbeat_interval_ms(other.heartbeat_interval_ms)
+            , status(other.status)
+            , owner_pid(other.owner_pid)
+            , _padding{}
+            , last_heartbeat_ns(other.last_heartbeat_ns.load(std::memory_order_relaxed))
+        {
+        }
+
+        /**
+         * @brief Copy assignment - atomics are copied via load/store
+         */
+        ServiceIndexEntry& operator=(const ServiceIndexEntry& other) noexcept
+        {
+            if (this != &other) {
+                sequence.store(other.sequence.load(std::memory_order_relaxed),
+                               std::memory_order_relaxed);
+                service_id = other.service_id;
+                instance_id = other.instance_id;
+                last_heartbeat_ns.store(other.last_heartbeat_ns.load(std::memory_order_relaxed),
+                                        std::memory_order_relaxed);
+                major_version = other.major_version;
+                minor_version = other.minor_version;
+                heartbeat_interval_ms = other.heartbeat_interval_ms;
+                status = other.status;
+                owner_pid = other.owner_pid;
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Check if the entry describes an active service
+         */
+        [[nodiscard]] bool IsActive() const noexcept
+        {
+            return status == static_cast<uint32_t>(SlotStatus::ACTIVE);
+        }
+
+        /**
+         * @brief Reset entry to IDLE state (non-atomic, use with seqlock)
+         */
+        void Reset() noexcept
+        {
+            service_id = 0;
+            instance_id = 0;
+            last_heartbeat_ns.store(0, std::memory_order_relaxed);
+            major_version = 0;
+            minor_version = 0;
+            heartbeat_interval_ms = 0;
+            status = static_cast<uint32_t>(SlotStatus::IDLE);
+            owner_pid = 0;
+        }
+    };
+
+    /**
+     * @brief Compact view of one service instance (returned by FindAllInstances)
+     * @details Carries only the fields needed to pick a replica; the full slot
+     *          (endpoint, metadata) can be fetched with ReadSlot(slot_index).
+     */
+    struct ServiceInstanceInfo final
+    {
+        uint64_t instance_id;     ///< Service instance ID (see ServiceSlot::instance_id)
+        uint32_t slot_index;      ///< Slot holding this instance
+        uint32_t major_version;   ///< Service major version
+        uint32_t minor_version;   ///< Service minor version
+        pid_t    owner_pid;       ///< Process ID of the instance owner
+    };
+
+    /**
+     * @brief Hot fields of one active slot (returned by SingleRegistry::Snapshot)
+     * @details Sized for periodic full-registry scans (monitoring, liveness);
+     *          endpoint and metadata are deliberately left out.
+     */
+    struct ServiceSlotSummary final
+    {
+        uint64_t service_id;             ///< Service interface ID
+        uint64_t instance_id;            ///< Service instance ID
+        uint64_t last_heartbeat_ns;      ///< Last heartbeat timestamp
+        uint32_t slot_index;             ///< Slot holding this service
+        uint32_t heartbeat_interval_ms;  ///< Heartbeat interval
+        uint32_t major_version;          ///< Service major version
+        pid_t    owner_pid;              ///< Process ID of the service owner
+    };
+
     // ========================================================================
     // Static Assertions (Design Validation)
     // ========================================================================
@@ -325,6 +478,20 @@ namespace registry
     static_assert(alignof(ServiceSlot) == 64, 
                   "ServiceSlot must be 64-byte aligned");
 
+    /**
+     * @brief Enforce one cache line per index entry
+     */
+    static_assert(sizeof(ServiceIndexEntry) == 64,
+                  "ServiceIndexEntry must be exactly 64 bytes (1 cache line)");
+
+    /**
+     * @brief Heartbeat must stay outside the seqlock-protected range (layout v5)
+     */
+    static_assert(offsetof(ServiceIndexEntry, last_heartbeat_ns) == 56,
+                  "ServiceIndexEntry::last_heartbeat_ns must occupy bytes [56-63]");
+    static_assert(std::atomic<uint64_t>::is_always_lock_free,
+                  "Heartbeat updates require lock-free 64-bit atomics (shared memory)");
+
 } // namespace registry
 } // namespace com
 } // namespace lap
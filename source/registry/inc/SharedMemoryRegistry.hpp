@@ -3,7 +3,7 @@
  * @author      LightAP Development Team
  * @brief       Dual registry implementation with QM/ASIL-D physical isolation
  * @date        2025-11-20
- * @details     Zero-daemon service registry using fixed-slot mapping in shared memory.
+ * @details     Zero-daemon service registry using open addressing with probe tags in shared memory.
  *              QM Registry: /dev/shm/lap_com_registry_qm (all processes read/write)
  *              ASIL-D Registry: /dev/shm/lap_com_registry_asil (controlled access)
  * @copyright   Copyright (c) 2025
@@ -28,15 +28,24 @@
 
 #include "ServiceSlot.hpp"
 #include "SeqLock.hpp"
+#include "RegistryLayout.hpp"
+#include "TagScan.hpp"
 
 #include <lap/core/CResult.hpp>
 #include <lap/core/COptional.hpp>
 #include <lap/core/CString.hpp>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <cstring>
+#include <memory>
+#include <mutex>
 #include <sys/mman.h>
 #include <sys/stat.h>
+#include <time.h>
 #include <fcntl.h>
 #include <unistd.h>
 
@@ -49,6 +58,7 @@ namespace registry
     using lap::core::Result;
     using lap::core::Optional;
     using lap::core::String;
+    using lap::core::Vector;
 
     /**
      * @brief Registry type enumeration (QM or ASIL)
@@ -63,6 +73,15 @@ namespace registry
         BOTH    = 2   ///< Broadcast service (written to both registries)
     };
 
+    /**
+     * @brief Liveness filter for service lookups
+     */
+    enum class Liveness : uint8_t
+    {
+        ANY       = 0,  ///< Accept any slot with status == ACTIVE
+        LIVE_ONLY = 1   ///< Also require a heartbeat within LIVENESS_TIMEOUT_FACTOR × interval
+    };
+
     /**
      * @brief Error codes for registry operations
      */
@@ -83,21 +102,27 @@ namespace registry
      */
     struct RegistryConfig
     {
-        /// Maximum number of service slots per registry
+        /// Default number of service slots per registry (initial memfd)
         static constexpr uint32_t MAX_SLOTS = 1024;
         
+        /// Upper bound of the slot count an online resize may grow to
+        static constexpr uint32_t MAX_SLOTS_LIMIT = 65536;
+        
+        /// lap-registry-init grows the registry once this percentage of slots is active
+        static constexpr uint32_t GROW_LOAD_PERCENT = 75;
+        
         /// Size of each slot (256 bytes)
         static constexpr size_t SLOT_SIZE = sizeof(ServiceSlot);
         
-        /// Total registry size (256KB = 1024 slots × 256 bytes)
-        static constexpr size_t REGISTRY_SIZE = MAX_SLOTS * SLOT_SIZE;
+        /// Total registry size (header + tag table + 1024 slots × 256 bytes)
+        static constexpr size_t REGISTRY_SIZE = RegistryLayout::TotalSize(MAX_SLOTS);
+        
+        /// Upper bound of a linear probe sequence (64 tag bytes span ≤ 2 cache lines)
+        static constexpr uint32_t MAX_PROBE_STEPS = 64;
         
         /// Reserved slot index (prohibited)
         static constexpr uint32_t RESERVED_SLOT = 0;
         
-        /// Broadcast slot index (slot 1023)
-        static constexpr uint32_t BROADCAST_SLOT = 1023;
-        
         /// QM registry memfd name (QM/ASIL-A/B services)
         static constexpr const char* QM_MEMFD_NAME = "lap_com_registry_qm";
         
@@ -127,15 +152,204 @@ namespace registry
         /// Broadcast service ID
         static constexpr uint16_t BROADCAST_SERVICE_ID = 0xFFFF;
         
-        /// Invalid service ID (slot 0 mapping)
+        /// Invalid service IDs (reserved, rejected by RegisterService)
         static constexpr uint16_t INVALID_SERVICE_ID_1 = 0x0000;
         static constexpr uint16_t INVALID_SERVICE_ID_2 = 0xF000;
+        
+        /// A slot is stale once its heartbeat is older than this many intervals
+        static constexpr uint32_t LIVENESS_TIMEOUT_FACTOR = 3;
+        
+        /// Heartbeat interval of QM registry slots registered without one
+        static constexpr uint32_t QM_HEARTBEAT_INTERVAL_MS = 100;
+        
+        /// Heartbeat interval of ASIL registry slots registered without one (ASIL-D: 50 ms)
+        static constexpr uint32_t ASIL_HEARTBEAT_INTERVAL_MS = 50;
+        
+        /// Entries of the process-local FindService() cache (direct-mapped, power of two)
+        static constexpr uint32_t LOOKUP_CACHE_SIZE = 128;
+    };
+
+    /**
+     * @brief Memory backing options for a registry mapping
+     * 
+     * @details Real-time readers must not take a TLB miss storm or a minor fault on
+     *          first touch inside FindService(). All options degrade gracefully:
+     *          - huge_pages: creator only; MFD_HUGETLB memfd, fully allocated with
+     *            fallocate(); falls back to 4 KiB pages if no huge pages are free
+     *          - populate:   MAP_POPULATE pre-faults the page tables of this process
+     *          - lock:       mlock() the mapping; failure (RLIMIT_MEMLOCK) is tolerated
+     *            and reported through SingleRegistry::IsMemoryLocked()
+     * 
+     * @note Page tables are per process: clients need populate/lock themselves
+     */
+    struct RegistryMemoryOptions
+    {
+        bool huge_pages = false;  ///< Back the memfd with huge pages (creator only)
+        bool populate   = false;  ///< Pre-fault the mapping (MAP_POPULATE)
+        bool lock       = false;  ///< Lock the mapping in RAM (mlock)
+
+        /// Environment variable read by Runtime::Initialize() (same syntax as Parse())
+        static constexpr const char* ENV_VAR = "LAP_COM_REGISTRY_MEMORY";
+
+        /**
+         * @brief Parse a comma-separated option list ("hugepages,populate,mlock")
+         * @param text Option list ("none" or empty = all off)
+         * @param options Output
+         * @return false on an unknown option (options are left unchanged)
+         */
+        static bool Parse(const char* text, RegistryMemoryOptions& options) noexcept;
+    };
+
+    /**
+     * @brief Lookup scope of SharedMemoryRegistry for a service ID
+     */
+    enum class RegistrySearch : uint8_t
+    {
+        ROUTED   = 0,  ///< Only the registry the routing table selects
+        COMBINED = 1   ///< A miss in the routed registry also searches the other one
+    };
+
+    /**
+     * @brief service_id → registry routing, expanded into a flat lookup array
+     * 
+     * @details One RegistryType per 16-bit service ID (64 KiB): routing is a
+     *          single indexed load, independent of how many ranges are
+     *          configured. Ranges are applied in order, later ranges override
+     *          earlier ones, IDs outside every range use the default registry.
+     *          A default-constructed table reproduces the built-in v3.0 ranges
+     *          (RegistryConfig); Load() replaces them from slot_mapping.yaml:
+     * 
+     *          slot_mapping:
+     *            registry_routing:
+     *              default: QM
+     *              search: combined
+     *              ranges:
+     *                - { first: 0xF001, last: 0xF3FE, registry: ASIL }
+     * 
+     * @note Registering processes and looking-up processes must agree on the
+     *       table; COMBINED search tolerates lookups with an outdated table
+     *       (e.g. after a service was reclassified) at the cost of a second
+     *       registry probe on a miss.
+     */
+    class RegistryRoutingTable final
+    {
+    public:
+        /// Number of routed service IDs (16-bit service_id space)
+        static constexpr uint32_t TABLE_SIZE = 0x10000;
+
+        /// Environment variable read by Runtime::Initialize() (path of a slot_mapping.yaml)
+        static constexpr const char* ENV_VAR = "LAP_COM_REGISTRY_ROUTING";
+
+        /// Configuration loaded by Runtime::Initialize() if present and ENV_VAR is unset
+        static constexpr const char* DEFAULT_CONFIG_PATH = "/etc/lap/com/slot_mapping.yaml";
+
+        /**
+         * @brief Built-in routing (RegistryConfig ranges, ROUTED search)
+         */
+        RegistryRoutingTable() noexcept
+        {
+            Reset(RegistryType::QM);
+            AddRange(RegistryConfig::ASIL_SERVICE_ID_MIN, RegistryConfig::ASIL_SERVICE_ID_MAX, RegistryType::ASIL);
+            AddRange(RegistryConfig::BROADCAST_SERVICE_ID, RegistryConfig::BROADCAST_SERVICE_ID, RegistryType::BOTH);
+        }
+
+        /**
+         * @brief Route every service ID to one registry
+         * @param fallback Registry of IDs outside every range
+         */
+        void Reset(RegistryType fallback) noexcept
+        {
+            routes_.fill(fallback);
+            search_ = RegistrySearch::ROUTED;
+        }
+
+        /**
+         * @brief Route an inclusive service ID range
+         * @return false if first > last (table unchanged)
+         */
+        bool AddRange(uint16_t first, uint16_t last, RegistryType type) noexcept
+        {
+            if (first > last) {
+                return false;
+            }
+            std::fill(routes_.begin() + first, routes_.begin() + last + 1, type);
+            return true;
+        }
+
+        /**
+         * @brief Registry of a service ID (QM, ASIL or BOTH)
+         */
+        [[nodiscard]] RegistryType Route(uint64_t service_id) const noexcept
+        {
+            return routes_[static_cast<uint16_t>(service_id & 0xFFFF)];
+        }
+
+        [[nodiscard]] RegistrySearch GetSearch() const noexcept
+        {
+            return search_;
+        }
+
+        void SetSearch(RegistrySearch search) noexcept
+        {
+            search_ = search;
+        }
+
+        /**
+         * @brief Replace the table with slot_mapping.registry_routing of a YAML file
+         * @param path Path of a slot_mapping.yaml
+         * @return kInvalidArgument if the file cannot be parsed or a range is
+         *         invalid (table unchanged); a file without a registry_routing
+         *         section keeps the current table
+         */
+        Result<void> Load(const String& path) noexcept;
+
+    private:
+        std::array<RegistryType, TABLE_SIZE> routes_;
+        RegistrySearch search_{RegistrySearch::ROUTED};
+    };
+
+    /**
+     * @brief Slot refreshed by the heartbeat publisher of its owning process
+     * @note Produced by SharedMemoryRegistry::GetHeartbeatTargets(),
+     *       scheduled by HeartbeatTimerWheel
+     */
+    struct HeartbeatTarget
+    {
+        uint64_t service_id;     ///< Service ID (cancellation key)
+        uint64_t instance_id;    ///< Instance ID
+        uint64_t due_ms;         ///< Next refresh (steady clock, milliseconds)
+        uint32_t slot_index;     ///< Slot index inside `registry`
+        uint32_t interval_ms;    ///< Heartbeat interval of the slot
+        RegistryType registry;   ///< QM or ASIL (never BOTH)
+    };
+
+    /**
+     * @brief Aggregated statistics of one registry memfd
+     * @details Sum of all RegistryStatsShard counters (max_retry_streak is the
+     *          maximum), plus a few header values to correlate them with.
+     *          Counters cover every process that mapped the registry and carry
+     *          over into the successor of an online resize.
+     */
+    struct RegistryStats
+    {
+        uint64_t registrations;     ///< Successful RegisterService() calls
+        uint64_t unregistrations;   ///< Slots released by their owner
+        uint64_t reclaims;          ///< Slots of crashed owners released by the reaper
+        uint64_t heartbeats;        ///< UpdateHeartbeat() stores
+        uint64_t reader_retries;    ///< Seqlock read attempts repeated because of a writer
+        uint64_t reader_failures;   ///< Seqlock reads abandoned by the backoff policy
+        uint64_t max_retry_streak;  ///< Most retries needed by a single read
+        uint64_t writer_waits;      ///< Structure seqlock acquisitions that found it held
+        uint32_t generation;        ///< Registry generation when the counters were read
+        uint32_t epoch;             ///< Resize generation of the memfd
+        uint32_t slot_count;        ///< Slots in the registry
+        uint32_t live_slots;        ///< Slots holding a registered instance
     };
 
     /**
      * @brief Single registry manager (QM or ASIL)
      * 
-     * @details Manages one shared memory registry with 1024 fixed slots.
+     * @details Manages one shared memory registry with 1024 slots.
      *          Each slot is 256 bytes, cache-line aligned.
      *          Uses seqlock for lock-free concurrent access.
      * 
@@ -143,11 +357,13 @@ namespace registry
      *       - Anonymous shared memory: memfd_create (no /dev/shm files)
      *       - File descriptor passing: Unix Domain Socket + SCM_RIGHTS
      *       - Memory sealing: F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL
-     *       - Fixed slot mapping: SlotIndex = ServiceID & 1023
+     *       - Open addressing: home = 1 + FNV1A(ServiceID) % (N - 1), bounded
+     *         linear probing (MAX_PROBE_STEPS) filtered by a 1-byte tag per slot
+     *       - Multi-instance: instances of one service share its probe sequence
+     *         and are linked in probe order through the instance chain table
      *       - Zero-daemon: processes self-register on startup
      *       - Physical isolation: separate memfd for QM and ASIL registries
      *       - Slot 0: reserved (prohibited, error detection)
-     *       - Slot 1023: broadcast slot (bidirectional cross-registry)
      * 
      * @note Safety level mapping:
      *       - QM Registry: QM + ASIL-A/B (security enhanced, shared)
@@ -163,7 +379,19 @@ namespace registry
         explicit SingleRegistry(RegistryType type) noexcept
             : type_(type)
             , memfd_(-1)
+            , base_(nullptr)
+            , mapped_size_(0)
+            , header_(nullptr)
+            , tags_(nullptr)
+            , chains_(nullptr)
+            , index_(nullptr)
             , slots_(nullptr)
+            , slot_count_(0)
+            , max_probe_steps_(0)
+            , stats_(nullptr)
+            , stale_count_(0)
+            , memory_options_()
+            , memory_locked_(false)
         {
         }
 
@@ -181,8 +409,54 @@ namespace registry
         SingleRegistry(SingleRegistry&&) = delete;
         SingleRegistry& operator=(SingleRegistry&&) = delete;
 
+        /**
+         * @brief Select huge page / populate / mlock backing for the next Initialize*()
+         * @param options Memory options (huge_pages only applies to Initialize())
+         */
+        void SetMemoryOptions(const RegistryMemoryOptions& options) noexcept
+        {
+            memory_options_ = options;
+        }
+
+        /**
+         * @brief Check whether the registry memfd is backed by huge pages
+         */
+        [[nodiscard]] bool IsHugePageBacked() const noexcept;
+
+        /**
+         * @brief Check whether this process' mapping is locked in RAM
+         */
+        [[nodiscard]] bool IsMemoryLocked() const noexcept
+        {
+            return memory_locked_;
+        }
+
+        /**
+         * @brief Create a registry memfd of at least size bytes
+         * @param name Memfd name
+         * @param size Required size in bytes
+         * @param huge_pages Try MFD_HUGETLB first (size rounded up to the huge page size)
+         * @param actual_size Output - size of the created file
+         * @return Result<int> memfd, or error
+         * 
+         * @note Shared with RegistryInitializer; huge page allocation failure
+         *       silently falls back to a regular memfd
+         */
+        static Result<int> CreateMemfd(const char* name, size_t size, bool huge_pages, size_t& actual_size) noexcept;
+
+        /**
+         * @brief mmap a registry memfd applying populate/lock options
+         * @param fd Registry memfd
+         * @param size Mapping size
+         * @param options Memory options
+         * @param locked Output - true if mlock() succeeded
+         * @return Result<void*> Mapping address, or error
+         */
+        static Result<void*> MapMemfd(int fd, size_t size, const RegistryMemoryOptions& options, bool& locked) noexcept;
+
         /**
          * @brief Initialize registry (create anonymous shared memory with memfd_create)
+         * @param slot_count Number of slots (2 ~ RegistryConfig::MAX_SLOTS_LIMIT)
          * @return Result<void> Success or error code
          * 
          * @note This creates anonymous shared memory using memfd_create():
@@ -195,7 +469,7 @@ namespace registry
          * 
          * @reference SERVICE_DISCOVERY_ARCHITECTURE.md §2.2.2
          */
-        Result<void> Initialize() noexcept;
+        Result<void> Initialize(uint32_t slot_count = RegistryConfig::MAX_SLOTS) noexcept;
 
         /**
          * @brief Initialize registry by receiving memfd from server (Phase 2)
@@ -214,18 +488,67 @@ namespace registry
         Result<void> InitializeFromSocket(const String& socket_path) noexcept;
 
         /**
-         * @brief Register a service in a specific slot
-         * @param slot_index Target slot index (1~1022, or 1023 for broadcast)
+         * @brief Initialize registry from an already formatted memfd
+         * @param memfd Registry memfd (duplicated; the caller keeps ownership)
+         * @return Result<void> Success or error code
+         * 
+         * @note Used by RegistryInitializer to operate on the registry it serves
+         *       through the regular SingleRegistry API (e.g. reaping dead owners)
+         */
+        Result<void> InitializeFromFd(int memfd) noexcept;
+
+        /**
+         * @brief Copy all active slots into a larger registry and retire this one
+         * @param successor Freshly formatted registry with at least as many slots
+         * @return Result<uint32_t> Number of migrated instances, or error
+         * 
+         * @details Holds this registry's structure seqlock for the whole copy, so
+         *          no registration is lost: writers that acquire it afterwards see
+         *          the registry retired and fail with kRegistryRetired. Instances
+         *          are re-hashed (slot indices change); owner PID, heartbeat and
+         *          interval are carried over. Releasing the seqlock bumps the
+         *          generation, which wakes WaitForChange() sleepers.
+         * 
+         * @note Server-side (lap-registry-init); successor must not be served yet
+         */
+        Result<uint32_t> MigrateTo(SingleRegistry& successor) noexcept;
+
+        /**
+         * @brief Check whether a resized successor has replaced this registry
+         * @return true once MigrateTo() completed (lookups still see the frozen contents)
+         */
+        [[nodiscard]] bool IsRetired() const noexcept
+        {
+            return header_ != nullptr && header_->successor_slot_count.load(std::memory_order_acquire) != 0;
+        }
+
+        /**
+         * @brief Get the resize generation of the mapped memfd
+         * @return 0 for the initial memfd, incremented by every online resize
+         */
+        [[nodiscard]] uint32_t GetEpoch() const noexcept
+        {
+            return (header_ != nullptr) ? header_->epoch : 0;
+        }
+
+        /**
+         * @brief Register a service in a specific slot (explicit placement)
+         * @param slot_index Target slot index (1~1023)
          * @param service_id Service interface ID
          * @param instance_id Service instance ID
          * @param major_version Service major version
          * @param minor_version Service minor version
          * @param binding_type Transport binding type ("iceoryx2", "dds", etc.)
          * @param endpoint Transport-specific endpoint address
+         * @param heartbeat_interval_ms Heartbeat interval of the instance
+         *        (0 = registry default, see GetDefaultHeartbeatIntervalMs())
          * @return Result<void> Success or error code
          * 
          * @note AUTOSAR SWS_CM_00002 (OfferService) implementation
-         * @note Slot 0 is reserved and will return SLOT_INDEX_INVALID
+         * @note Slot 0 is reserved and will return kInvalidArgument
+         * @note Fails with kSlotIndexInvalid if slot_index lies outside the probe
+         *       window of service_id (FindService() could never reach it) and with
+         *       kSlotAlreadyReserved if (service_id, instance_id) is already active
          */
         Result<void> RegisterService(
             uint32_t slot_index,
@@ -234,7 +557,35 @@ namespace registry
             uint32_t major_version,
             uint32_t minor_version,
             const char* binding_type,
-            const char* endpoint) noexcept;
+            const char* endpoint,
+            uint32_t heartbeat_interval_ms = 0) noexcept;
+
+        /**
+         * @brief Register a service in the first free slot of its probe sequence
+         * @param service_id Service interface ID
+         * @param instance_id Service instance ID
+         * @param major_version Service major version
+         * @param minor_version Service minor version
+         * @param binding_type Transport binding type ("iceoryx2", "dds", etc.)
+         * @param endpoint Transport-specific endpoint address
+         * @param heartbeat_interval_ms Heartbeat interval of the instance
+         *        (0 = registry default, see GetDefaultHeartbeatIntervalMs())
+         * @return Result<uint32_t> Slot index the service was placed in
+         * 
+         * @note Several instances of one service_id may be registered; they are
+         *       linked into the service's instance chain (see FindAllInstances)
+         * @note Fails with kSlotAlreadyReserved if (service_id, instance_id) is
+         *       already active and with kSlotConflict if no free slot exists
+         *       within MAX_PROBE_STEPS
+         */
+        Result<uint32_t> RegisterService(
+            uint64_t service_id,
+            uint64_t instance_id,
+            uint32_t major_version,
+            uint32_t minor_version,
+            const char* binding_type,
+            const char* endpoint,
+            uint32_t heartbeat_interval_ms = 0) noexcept;
 
         /**
          * @brief Unregister a service from a slot
@@ -246,14 +597,137 @@ namespace registry
         Result<void> UnregisterService(uint32_t slot_index) noexcept;
 
         /**
-         * @brief Find a service by service ID (O(1) lookup)
+         * @brief Release a slot on behalf of an owner that no longer exists
+         * @param slot_index Slot index to clear
+         * @param owner_pid PID the slot is expected to belong to
+         * @return Result<void> Success, or kServiceNotAvailable if the slot is no
+         *         longer active or has been re-registered by another process
+         * 
+         * @note Check and release happen under the structure seqlock, so a slot
+         *       re-registered by a restarted process is never reclaimed
+         */
+        Result<void> ReclaimSlot(uint32_t slot_index, pid_t owner_pid) noexcept;
+
+        /**
+         * @brief Find a service by service ID (bounded probe lookup)
          * @param service_id Service ID to search for
-         * @return Optional<ServiceSlot> Service info if found
+         * @param liveness LIVE_ONLY skips instances whose heartbeat is stale
+         * @return Optional<ServiceSlot> First (live) instance in probe order if found
          * 
          * @note AUTOSAR SWS_CM_00001 (FindService) implementation
-         * @note Uses fixed slot mapping: slot = service_id & 1023
+         * @note Probing reads tags and 64-byte index entries only; the full slot
+         *       is read once, for the instance that was found
+         * @note LIVE_ONLY reads CLOCK_MONOTONIC once per call; every skipped
+         *       instance is counted in GetStaleCount()
+         */
+        Optional<ServiceSlot> FindService(uint64_t service_id, Liveness liveness = Liveness::ANY) const noexcept;
+
+        /**
+         * @brief Find a service and report the slot it was read from
+         * @param service_id Service ID to search for
+         * @param liveness LIVE_ONLY skips instances whose heartbeat is stale
+         * @param slot_index Output - slot of the instance (RESERVED_SLOT if not found)
+         * @return Optional<ServiceSlot> First (live) instance in probe order if found
+         */
+        Optional<ServiceSlot> FindService(
+            uint64_t service_id, Liveness liveness, uint32_t& slot_index) const noexcept;
+
+        /**
+         * @brief Find a service and tell "not registered" apart from contention
+         * @param service_id Service ID to search for
+         * @param liveness LIVE_ONLY skips instances whose heartbeat is stale
+         * @param slot_index Output - slot of the instance (RESERVED_SLOT if not found)
+         * @return Result<ServiceSlot> First (live) instance in probe order, or
+         *         - kServiceNotAvailable: no matching instance is registered
+         *         - kRegistryContended: a candidate slot stayed write-locked for the
+         *           whole reader backoff (SeqLockBackoff); retry later instead of
+         *           treating the service as gone
+         *         - kNotInitialized
+         */
+        Result<ServiceSlot> LookupService(
+            uint64_t service_id, Liveness liveness, uint32_t& slot_index) const noexcept;
+
+        /**
+         * @brief Load the heartbeat of a slot (independent atomic, no seqlock)
+         * @param slot_index Slot index (must be valid)
+         * @return Last heartbeat timestamp in nanoseconds
+         */
+        [[nodiscard]] uint64_t LoadHeartbeat(uint32_t slot_index) const noexcept
+        {
+            return index_[slot_index].last_heartbeat_ns.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief Find the hot fields of a service (no endpoint/metadata)
+         * @param service_id Service ID to search for
+         * @return Optional<ServiceIndexEntry> Index entry of the first instance if found
+         * 
+         * @note Touches the tag line and one index cache line per probe hit;
+         *       use it for availability/liveness checks that need no endpoint
+         */
+        Optional<ServiceIndexEntry> FindServiceIndex(uint64_t service_id) const noexcept;
+
+        /**
+         * @brief Find all active instances of a service
+         * @param service_id Service ID to search for
+         * @return Vector<ServiceInstanceInfo> Instances in probe order (empty if none)
+         * 
+         * @details Walks the service's instance chain in a single pass validated
+         *          by the registry structure seqlock; only the compact identity
+         *          fields of each slot are copied.
+         * @note Returns an empty vector if the structure seqlock cannot be read
+         *       consistently within the reader backoff (SeqLockBackoff)
+         * @note LIVE_ONLY drops stale instances (counted in GetStaleCount())
+         */
+        Vector<ServiceInstanceInfo> FindAllInstances(
+            uint64_t service_id, Liveness liveness = Liveness::ANY) const;
+
+        /**
+         * @brief Collect the hot fields of all active slots in one batched pass
+         * @param entries Output, active slots are appended in slot order
+         *        (clear it between scans to reuse its capacity)
+         * @return Result<uint32_t> Number of slots skipped because they could not
+         *         be read consistently (normally 0)
+         * 
+         * @details Only slots with a live probe tag are read. Runs of live slots
+         *          are read with SeqLockReader::ReadRange(), so each batch costs
+         *          one fence pair and only changed slots are re-read.
+         * @note Intended for periodic scans (monitoring agents, liveness checks)
+         * @note Live slots are located 64 tags at a time (TagScan::LiveMask())
+         */
+        Result<uint32_t> Snapshot(Vector<ServiceSlotSummary>& entries) const;
+
+        /**
+         * @brief Collect every active instance of a service by scanning the whole registry
+         * @param service_id Service ID to search for
+         * @param entries Output, matching slots are appended in slot order
+         * @param liveness LIVE_ONLY drops instances whose heartbeat is stale
+         * @return Result<uint32_t> Number of candidate slots skipped because they
+         *         could not be read consistently (normally 0)
+         * 
+         * @details Compares the service's probe tag against 64 tags per step
+         *          (TagScan::MatchMask(), SIMD where available) and reads only
+         *          the index entries of tag matches. Unlike FindAllInstances()
+         *          the result does not depend on the probe sequence, so it also
+         *          finds instances placed by an older/foreign writer.
+         */
+        Result<uint32_t> ScanService(
+            uint64_t service_id, Vector<ServiceSlotSummary>& entries, Liveness liveness = Liveness::ANY) const;
+
+        /**
+         * @brief Locate the slot index of an active service
+         * @param service_id Service ID to search for
+         * @return Optional<uint32_t> Slot index of the first instance if found
          */
-        Optional<ServiceSlot> FindService(uint64_t service_id) const noexcept;
+        Optional<uint32_t> FindSlot(uint64_t service_id) const noexcept;
+
+        /**
+         * @brief Locate the slot index of one instance of an active service
+         * @param service_id Service ID to search for
+         * @param instance_id Instance ID to search for
+         * @return Optional<uint32_t> Slot index if found
+         */
+        Optional<uint32_t> FindSlot(uint64_t service_id, uint64_t instance_id) const noexcept;
 
         /**
          * @brief Read a specific slot atomically
@@ -267,9 +741,35 @@ namespace registry
          * @param slot_index Slot index
          * @param timestamp_ns Current timestamp in nanoseconds
          * @return Result<void> Success or error code
+         * 
+         * @note Lock-free: one atomic store to the index entry, no seqlock write,
+         *       so concurrent readers of the slot are never forced to retry
          */
         Result<void> UpdateHeartbeat(uint32_t slot_index, uint64_t timestamp_ns) noexcept;
 
+        /**
+         * @brief Get the registry generation (changes on every register/unregister)
+         * @return Current generation (0 if not initialized)
+         */
+        [[nodiscard]] uint32_t GetGeneration() const noexcept
+        {
+            return (header_ != nullptr) ? header_->generation.load(std::memory_order_acquire) : 0;
+        }
+
+        /**
+         * @brief Block until the registry generation differs from known_generation
+         * @param known_generation Generation observed by the caller (GetGeneration())
+         * @param timeout Maximum time to wait
+         * @return Result<uint32_t> New generation, or kTimeout if nothing changed
+         * 
+         * @details Sleeps on the header's generation word with FUTEX_WAIT, so an
+         *          idle waiter costs no CPU and is woken within microseconds of
+         *          a RegisterService()/UnregisterService() in any process.
+         * @note Heartbeat updates do not change the generation
+         * @note Returns kRegistryRetired once the registry has been resized
+         */
+        Result<uint32_t> WaitForChange(uint32_t known_generation, std::chrono::milliseconds timeout) const noexcept;
+
         /**
          * @brief Check if registry is initialized
          * @return true if shared memory is mapped
@@ -279,6 +779,58 @@ namespace registry
             return (slots_ != nullptr);
         }
 
+        /**
+         * @brief Get number of slots in the mapped registry
+         * @return Slot count (0 if not initialized)
+         */
+        [[nodiscard]] uint32_t GetSlotCount() const noexcept
+        {
+            return slot_count_;
+        }
+
+        /**
+         * @brief Read the statistics region of the registry
+         * @return Result<RegistryStats> Counters summed over all shards
+         * 
+         * @note Wait-free: 16 cache-line reads plus one tag table scan; the
+         *       counters of different shards are not read atomically together
+         */
+        Result<RegistryStats> GetStats() const noexcept;
+
+        /**
+         * @brief Get number of stale instances skipped by LIVE_ONLY lookups
+         * @return Process-local counter since construction
+         */
+        [[nodiscard]] uint64_t GetStaleCount() const noexcept
+        {
+            return stale_count_.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Check a heartbeat against the liveness timeout
+         * @param last_heartbeat_ns Last heartbeat (steady clock, nanoseconds)
+         * @param heartbeat_interval_ms Heartbeat interval (0 = never stale)
+         * @param now_ns Current CLOCK_MONOTONIC time in nanoseconds
+         * @return true if the heartbeat is within LIVENESS_TIMEOUT_FACTOR × interval
+         */
+        static bool IsLive(uint64_t last_heartbeat_ns, uint32_t heartbeat_interval_ms, uint64_t now_ns) noexcept
+        {
+            const uint64_t timeout_ns = static_cast<uint64_t>(heartbeat_interval_ms) *
+                                        RegistryConfig::LIVENESS_TIMEOUT_FACTOR * 1000000ULL;
+            return timeout_ns == 0 || now_ns <= last_heartbeat_ns || now_ns - last_heartbeat_ns <= timeout_ns;
+        }
+
+        /**
+         * @brief Read CLOCK_MONOTONIC (same clock as std::chrono::steady_clock)
+         * @return Current time in nanoseconds
+         */
+        static uint64_t MonotonicNowNs() noexcept
+        {
+            struct timespec ts;
+            clock_gettime(CLOCK_MONOTONIC, &ts);
+            return static_cast<uint64_t>(ts.tv_sec) * 1000000000ULL + static_cast<uint64_t>(ts.tv_nsec);
+        }
+
         /**
          * @brief Get registry type
          * @return RegistryType (QM or ASIL)
@@ -298,6 +850,16 @@ namespace registry
         }
 
     private:
+        /**
+         * @brief Neighbours of a slot within a service's instance chain
+         */
+        struct ChainPosition
+        {
+            uint32_t prev;        ///< Preceding instance (CHAIN_END if the slot becomes head)
+            uint32_t next;        ///< Following instance (CHAIN_END if the slot becomes tail)
+            bool     duplicate;   ///< The same (service_id, instance_id) is already active
+        };
+
         /**
          * @brief Cleanup shared memory resources
          */
@@ -310,14 +872,168 @@ namespace registry
          */
         Result<int> receiveMemfdFromSocket(const String& socket_path) noexcept;
 
+        /**
+         * @brief Take ownership of a registry memfd and map it
+         * @param fd Registry memfd (closed on failure)
+         * @return Result<void> Success or error code
+         */
+        Result<void> attachMemfd(int fd) noexcept;
+
+        /**
+         * @brief Map memfd_, validate its header and bind tag/slot pointers
+         * @param size Mapping size in bytes
+         * @param format_slots Format a fresh registry with this many slots before
+         *        validation (creator only, 0 = attach to a formatted registry)
+         * @return Result<void> Success or error code
+         */
+        Result<void> mapRegistry(size_t size, uint32_t format_slots) noexcept;
+
+        /**
+         * @brief Re-hash an instance of a retired registry into this one
+         * @param entry Index entry of the instance in the retired registry
+         * @param slot Slot of the instance in the retired registry
+         * @return false if the probe window of the service is full
+         * @note Caller must hold the structure seqlock of both registries
+         */
+        bool importSlot(const ServiceIndexEntry& entry, const ServiceSlot& slot) noexcept;
+
+        /**
+         * @brief Fill a claimed slot under its seqlock and mark it ACTIVE
+         * @note Caller must own the slot's tag (claimed via compare-exchange)
+         */
+        void writeSlot(
+            uint32_t slot_index,
+            uint64_t service_id,
+            uint64_t instance_id,
+            uint32_t major_version,
+            uint32_t minor_version,
+            const char* binding_type,
+            const char* endpoint,
+            uint32_t heartbeat_interval_ms) noexcept;
+
+        /**
+         * @brief Find where a slot at probe step target_step joins the instance chain
+         * @note Caller must hold the structure seqlock (RegistryWriteGuard)
+         */
+        ChainPosition locateChainPosition(
+            uint64_t hash,
+            uint64_t service_id,
+            uint64_t instance_id,
+            uint32_t target_step) const noexcept;
+
+        /**
+         * @brief Link a claimed slot into its instance chain, fill it and publish its tag
+         * @note Caller must hold the structure seqlock (RegistryWriteGuard)
+         */
+        void publishSlot(
+            uint32_t slot_index,
+            uint8_t tag,
+            const ChainPosition& position,
+            uint64_t service_id,
+            uint64_t instance_id,
+            uint32_t major_version,
+            uint32_t minor_version,
+            const char* binding_type,
+            const char* endpoint,
+            uint32_t heartbeat_interval_ms) noexcept;
+
+        /**
+         * @brief Unlink, reset and tombstone a slot
+         * @return false if the slot was already free (nothing changed)
+         * @note Caller must hold the structure seqlock (RegistryWriteGuard)
+         */
+        bool releaseSlot(uint32_t slot_index) noexcept;
+
+        /**
+         * @brief Remove a slot from the instance chain of service_id
+         * @note Caller must hold the structure seqlock (RegistryWriteGuard)
+         */
+        void unlinkSlot(uint32_t slot_index, uint64_t service_id) noexcept;
+
+        /**
+         * @brief Repair the update of a writer that died holding the structure seqlock
+         * @details Restores even parity of torn slot/index seqlocks, clears slots
+         *          whose tag, index entry and slot disagree, and relinks every
+         *          instance chain in probe order.
+         * @note Caller must hold the structure seqlock (RegistryWriteGuard::Recovered())
+         */
+        void recoverStructure() noexcept;
+
+        /**
+         * @brief Probe for the slot of an active service
+         * @param service_id Service ID to search for
+         * @param instance_id Instance ID to search for (ignored if any_instance)
+         * @param any_instance Accept the first active instance of service_id
+         * @param now_ns Skip instances that are stale at this time (0 = no liveness check)
+         * @param contended Optional output, set if a candidate could not be read
+         *        consistently (a miss may then be a false negative)
+         * @return Slot index, or RegistryConfig::RESERVED_SLOT if not found
+         */
+        uint32_t probeActiveSlot(
+            uint64_t service_id, uint64_t instance_id, bool any_instance, uint64_t now_ns = 0,
+            bool* contended = nullptr) const noexcept;
+
+        /**
+         * @brief Account a seqlock read in this process' statistics shard
+         * @param retries Repeated attempts of the read
+         * @param failed The read was abandoned
+         */
+        void recordRead(uint32_t retries, bool failed) const noexcept
+        {
+            if (retries != 0) {
+                stats_->RecordRead(retries, failed);
+            }
+        }
+
         /**
          * @brief Validate slot index
          * @param slot_index Slot index to validate
-         * @return true if valid (1~1023)
+         * @return true if valid (1~slot_count-1)
          */
         [[nodiscard]] bool IsValidSlotIndex(uint32_t slot_index) const noexcept
         {
-            return (slot_index > 0 && slot_index < RegistryConfig::MAX_SLOTS);
+            return (slot_index > 0 && slot_index < slot_count_);
+        }
+
+        /**
+         * @brief 64-bit FNV-1a hash of a service ID
+         * @note Matches hash_algorithm "FNV1A" in slot_mapping.yaml
+         */
+        static uint64_t HashServiceId(uint64_t service_id) noexcept
+        {
+            uint64_t hash = 0xCBF29CE484222325ULL;
+            for (uint32_t i = 0; i < 8; ++i) {
+                hash ^= (service_id >> (i * 8)) & 0xFF;
+                hash *= 0x100000001B3ULL;
+            }
+            return hash;
+        }
+
+        /**
+         * @brief Derive the probe tag of a hash (never EMPTY or TOMBSTONE)
+         */
+        static uint8_t TagOf(uint64_t hash) noexcept
+        {
+            return static_cast<uint8_t>(SlotTag::MIN_LIVE + (hash >> 56) % (256 - SlotTag::MIN_LIVE));
+        }
+
+        /**
+         * @brief Slot index of the step-th probe (slot 0 is skipped)
+         */
+        [[nodiscard]] uint32_t ProbeIndex(uint64_t hash, uint32_t step) const noexcept
+        {
+            const uint32_t usable = slot_count_ - 1;
+            return 1 + static_cast<uint32_t>((hash % usable + step) % usable);
+        }
+
+        /**
+         * @brief Probe step at which slot_index is visited (inverse of ProbeIndex)
+         */
+        [[nodiscard]] uint32_t ProbeStep(uint64_t hash, uint32_t slot_index) const noexcept
+        {
+            const uint32_t usable = slot_count_ - 1;
+            const uint32_t home = static_cast<uint32_t>(hash % usable);
+            return (slot_index - 1 + usable - home) % usable;
         }
 
         /**
@@ -342,20 +1058,45 @@ namespace registry
                    : RegistryConfig::ASIL_PERMISSIONS;
         }
 
+        /**
+         * @brief Get the heartbeat interval of slots registered without one
+         * @return Interval in milliseconds for the registry type
+         */
+        [[nodiscard]] uint32_t GetDefaultHeartbeatIntervalMs() const noexcept
+        {
+            return (type_ == RegistryType::QM) 
+                   ? RegistryConfig::QM_HEARTBEAT_INTERVAL_MS 
+                   : RegistryConfig::ASIL_HEARTBEAT_INTERVAL_MS;
+        }
+
     private:
-        RegistryType type_;      ///< Registry type (QM or ASIL)
-        int memfd_;              ///< Anonymous shared memory file descriptor (memfd_create)
-        ServiceSlot* slots_;     ///< Pointer to mapped slot array
+        RegistryType type_;              ///< Registry type (QM or ASIL)
+        int memfd_;                      ///< Anonymous shared memory file descriptor (memfd_create)
+        void* base_;                     ///< Start of the mapping (RegistryHeader)
+        size_t mapped_size_;             ///< Size of the mapping in bytes
+        RegistryHeader* header_;         ///< Pointer to mapped registry header
+        std::atomic<uint8_t>* tags_;     ///< Pointer to mapped probe tag table
+        std::atomic<uint32_t>* chains_;  ///< Pointer to mapped instance chain table
+        ServiceIndexEntry* index_;       ///< Pointer to mapped index table (hot fields)
+        ServiceSlot* slots_;             ///< Pointer to mapped slot array
+        uint32_t slot_count_;            ///< Number of slots (from RegistryHeader)
+        uint32_t max_probe_steps_;       ///< Probe bound (from RegistryHeader)
+        RegistryStatsShard* stats_;      ///< Statistics shard of this process
+        mutable std::atomic<uint64_t> stale_count_;  ///< Stale instances skipped (process-local)
+        RegistryMemoryOptions memory_options_;       ///< Backing options for the next mapping
+        bool memory_locked_;             ///< Mapping is mlock()ed
     };
 
     /**
      * @brief Dual registry manager (QM + ASIL)
      * 
      * @details Manages both QM and ASIL registries with automatic routing.
-     *          Service ID determines which registry to use:
+     *          The RegistryRoutingTable maps each service ID to a registry;
+     *          built-in ranges:
      *          - 0x0001~0x0417: QM registry (QM + ASIL-A/B services)
      *          - 0xF001~0xF3FE: ASIL registry (ASIL-C/D services only)
      *          - 0xFFFF: Both registries (broadcast, bidirectional)
+     *          - other IDs: QM registry
      * 
      * @note Physical isolation ensures QM services cannot corrupt ASIL services
      * @note Safety level mapping:
@@ -365,12 +1106,26 @@ namespace registry
     class SharedMemoryRegistry final
     {
     public:
+        /**
+         * @brief Counters of the process-local FindService() cache
+         */
+        struct LookupCacheStats
+        {
+            uint64_t hits;    ///< Lookups answered from the cache
+            uint64_t misses;  ///< Lookups that read the shared registry
+        };
+
         /**
          * @brief Constructor
          */
         SharedMemoryRegistry() noexcept
             : qm_registry_(RegistryType::QM)
             , asil_registry_(RegistryType::ASIL)
+            , qm_active_(&qm_registry_)
+            , asil_active_(&asil_registry_)
+            , refresh_count_(0)
+            , lookup_cache_{}
+            , lookup_cache_counters_{}
         {
         }
 
@@ -385,6 +1140,32 @@ namespace registry
         SharedMemoryRegistry(SharedMemoryRegistry&&) = delete;
         SharedMemoryRegistry& operator=(SharedMemoryRegistry&&) = delete;
 
+        /**
+         * @brief Select memory backing for both registries (call before Initialize*())
+         * @param options Huge page / populate / mlock options
+         */
+        void SetMemoryOptions(const RegistryMemoryOptions& options) noexcept
+        {
+            memory_options_ = options;
+            qm_registry_.SetMemoryOptions(options);
+            asil_registry_.SetMemoryOptions(options);
+        }
+
+        /**
+         * @brief Replace the service_id → registry routing (call before Initialize*())
+         * @param routing Routing table, e.g. loaded from slot_mapping.yaml
+         * @note Not synchronized with concurrent lookups
+         */
+        void SetRoutingTable(const RegistryRoutingTable& routing) noexcept
+        {
+            routing_ = routing;
+        }
+
+        [[nodiscard]] const RegistryRoutingTable& GetRoutingTable() const noexcept
+        {
+            return routing_;
+        }
+
         /**
          * @brief Initialize both QM and ASIL registries
          * @return Result<void> Success or error code
@@ -405,6 +1186,41 @@ namespace registry
             const String& qm_socket_path,
             const String& asil_socket_path) noexcept;
 
+        /**
+         * @brief Check whether lap-registry-init has resized one of the registries
+         * @return true if Refresh() would switch to a successor memfd
+         * 
+         * @note Two acquire loads; cheap enough to poll before lookups
+         */
+        [[nodiscard]] bool NeedsRefresh() const noexcept
+        {
+            return Active(RegistryType::QM).IsRetired() || Active(RegistryType::ASIL).IsRetired();
+        }
+
+        /**
+         * @brief Switch retired registries to their resized successors
+         * @return Result<bool> true if a registry was switched, kNotSupported if the
+         *         registry was not initialized from a socket
+         * 
+         * @details The successor memfd is fetched again from the daemon socket.
+         *          Retired registries stay mapped until destruction, so lookups
+         *          running concurrently in other threads remain valid (they see
+         *          the frozen pre-resize contents). Writes and WaitForChange()
+         *          refresh on their own; lookups do not, call this when
+         *          NeedsRefresh() reports true (Runtime does so).
+         * @note Slot indices change: re-resolve heartbeat targets when
+         *       GetRefreshCount() changes (ResolveHeartbeatTarget())
+         */
+        Result<bool> Refresh() noexcept;
+
+        /**
+         * @brief Get the number of registry switches performed by Refresh()
+         */
+        [[nodiscard]] uint32_t GetRefreshCount() const noexcept
+        {
+            return refresh_count_.load(std::memory_order_acquire);
+        }
+
         /**
          * @brief Register a service (automatically routes to correct registry)
          * @param service_id Service ID (determines registry selection)
@@ -413,9 +1229,11 @@ namespace registry
          * @param minor_version Minor version
          * @param binding_type Binding type string
          * @param endpoint Endpoint address
+         * @param heartbeat_interval_ms Heartbeat interval (0 = default of the
+         *        target registry: 100 ms QM, 50 ms ASIL)
          * @return Result<void> Success or error code
          * 
-         * @note Routing logic (v3.0 updated ranges):
+         * @note Routed by the RegistryRoutingTable (built-in ranges):
          *       - 0x0001~0x0417 → QM+AB registry (QM/ASIL-A/B)
          *       - 0xF001~0xF3FE → ASIL-CD registry (ASIL-C/D)
          *       - 0xFFFF → Both registries (broadcast, bidirectional)
@@ -426,7 +1244,8 @@ namespace registry
             uint32_t major_version,
             uint32_t minor_version,
             const char* binding_type,
-            const char* endpoint) noexcept;
+            const char* endpoint,
+            uint32_t heartbeat_interval_ms = 0) noexcept;
 
         /**
          * @brief Unregister a service
@@ -435,12 +1254,134 @@ namespace registry
          */
         Result<void> UnregisterService(uint64_t service_id) noexcept;
 
+        /**
+         * @brief Unregister one instance of a service
+         * @param service_id Service ID
+         * @param instance_id Instance ID
+         * @return Result<void> Success or error code
+         */
+        Result<void> UnregisterService(uint64_t service_id, uint64_t instance_id) noexcept;
+
         /**
          * @brief Find a service by service ID
          * @param service_id Service ID to find
+         * @param liveness LIVE_ONLY skips instances whose heartbeat is stale
          * @return Optional<ServiceSlot> Service info if found
+         * 
+         * @details Read-through process-local cache: results (including "not
+         *          found") are kept per service_id together with the registry
+         *          generation they were read at. While the generation is
+         *          unchanged (no register/unregister in that registry) a lookup
+         *          costs one generation load plus, if found, one heartbeat load;
+         *          the slot is not re-read under the seqlock.
+         * @note The generation is global per registry, so any registration
+         *       change invalidates all entries of that registry at once
+         * @note LIVE_ONLY hits are checked against the current heartbeat; a
+         *       stale cached instance falls back to the full lookup
+         * @note RegistrySearch::COMBINED: a miss in the routed registry is
+         *       looked up (and cached) in the other registry as well
+         */
+        Optional<ServiceSlot> FindService(uint64_t service_id, Liveness liveness = Liveness::ANY) const noexcept;
+
+        /**
+         * @brief FindService() that reports why nothing was returned
+         * @param service_id Service ID to search for
+         * @param liveness LIVE_ONLY skips instances whose heartbeat is stale
+         * @return Result<ServiceSlot> Service info, or kServiceNotAvailable (not
+         *         registered / not live), kRegistryContended (writer held the entry
+         *         beyond the reader backoff), kNotInitialized
+         * 
+         * @note Same cache as FindService(); contended lookups are never cached
+         */
+        Result<ServiceSlot> LookupService(uint64_t service_id, Liveness liveness = Liveness::ANY) const noexcept;
+
+        /**
+         * @brief Get hit/miss counters of the FindService() cache
+         */
+        [[nodiscard]] LookupCacheStats GetLookupCacheStats() const noexcept
+        {
+            LookupCacheStats stats{0, 0};
+            for (const auto& counters : lookup_cache_counters_) {
+                stats.hits += counters.hits.load(std::memory_order_relaxed);
+                stats.misses += counters.misses.load(std::memory_order_relaxed);
+            }
+            return stats;
+        }
+
+        /**
+         * @brief Find all active instances of a service (e.g. redundant replicas)
+         * @param service_id Service ID to find
+         * @param liveness LIVE_ONLY drops instances whose heartbeat is stale
+         * @return Vector<ServiceInstanceInfo> Instances in probe order (empty if none)
+         * @note RegistrySearch::COMBINED appends the instances of the other
+         *       registry (after those of the routed one)
          */
-        Optional<ServiceSlot> FindService(uint64_t service_id) const noexcept;
+        Vector<ServiceInstanceInfo> FindAllInstances(
+            uint64_t service_id, Liveness liveness = Liveness::ANY) const;
+
+        /**
+         * @brief Get number of stale instances skipped by LIVE_ONLY lookups (both registries)
+         * @return Process-local counter
+         */
+        [[nodiscard]] uint64_t GetStaleCount() const noexcept
+        {
+            std::lock_guard<std::mutex> lock(refresh_mutex_);
+            uint64_t stale = qm_registry_.GetStaleCount() + asil_registry_.GetStaleCount();
+            for (const auto& successor : successors_) {
+                stale += successor->GetStaleCount();
+            }
+            return stale;
+        }
+
+        /**
+         * @brief Read the shared statistics of the current QM or ASIL registry
+         * @param type RegistryType::QM or RegistryType::ASIL
+         * @return Result<RegistryStats> Counters of all processes using the registry
+         * 
+         * @note Meant for observability (lap-registry-stats); correlate changes of
+         *       reader_retries / writer_waits with discovery latency spikes
+         */
+        Result<RegistryStats> GetStats(RegistryType type) const noexcept;
+
+        /**
+         * @brief Get the generation of the registry responsible for service_id
+         * @param service_id Service ID (selects QM or ASIL registry)
+         * @return Current generation
+         */
+        [[nodiscard]] uint32_t GetGeneration(uint64_t service_id) const noexcept;
+
+        /**
+         * @brief Block until the registry responsible for service_id changes
+         * @param service_id Service ID (selects QM or ASIL registry)
+         * @param known_generation Generation observed via GetGeneration()
+         * @param timeout Maximum time to wait
+         * @return Result<uint32_t> New generation, or kTimeout if nothing changed
+         * 
+         * @note If the registry was resized meanwhile, switches to the successor
+         *       (Refresh()) and returns its generation
+         */
+        Result<uint32_t> WaitForChange(
+            uint64_t service_id, uint32_t known_generation, std::chrono::milliseconds timeout) noexcept;
+
+        /**
+         * @brief Snapshot all active slots of both registries (QM first, then ASIL)
+         * @param entries Output (cleared first; capacity is reused across calls)
+         * @return Result<uint32_t> Number of slots skipped due to write contention
+         */
+        Result<uint32_t> Snapshot(Vector<ServiceSlotSummary>& entries) const;
+
+        /**
+         * @brief Collect every active instance of a service from both registries
+         * @param service_id Service ID to search for
+         * @param entries Output (cleared first), QM matches before ASIL matches
+         * @param liveness LIVE_ONLY drops instances whose heartbeat is stale
+         * @return Result<uint32_t> Number of slots skipped due to write contention
+         * 
+         * @note Broadcast instances are mirrored; only the QM copy is returned
+         * @see SingleRegistry::ScanService()
+         */
+        Result<uint32_t> ScanService(
+            uint64_t service_id, Vector<ServiceSlotSummary>& entries, Liveness liveness = Liveness::ANY) const;
 
         /**
          * @brief Update heartbeat for a service
@@ -450,54 +1391,175 @@ namespace registry
          */
         Result<void> UpdateHeartbeat(uint64_t service_id, uint64_t timestamp_ns) noexcept;
 
+        /**
+         * @brief Resolve the slots of an instance for heartbeat publishing
+         * @param service_id Service ID
+         * @param instance_id Instance ID
+         * @param targets Output (appended) - one target per registry holding the
+         *        instance (two for broadcast services)
+         * @return Result<void> kServiceNotAvailable if the instance is not registered
+         * 
+         * @note Resolve once after RegisterService(); refreshes then go straight
+         *       to the slot without probing
+         */
+        Result<void> GetHeartbeatTargets(
+            uint64_t service_id, uint64_t instance_id, Vector<HeartbeatTarget>& targets) const;
+
+        /**
+         * @brief Refresh heartbeats of a batch of slots with one timestamp
+         * @param targets Slots resolved by GetHeartbeatTargets()
+         * @param timestamp_ns Current timestamp (steady clock, nanoseconds)
+         * @return Number of targets that could not be updated
+         */
+        uint32_t UpdateHeartbeats(const Vector<HeartbeatTarget>& targets, uint64_t timestamp_ns) noexcept;
+
+        /**
+         * @brief Re-resolve the slot of a heartbeat target (after Refresh())
+         * @param target Target to update in place
+         * @return false if the instance is no longer registered
+         */
+        bool ResolveHeartbeatTarget(HeartbeatTarget& target) const noexcept;
+
     private:
         /**
-         * @brief Calculate slot index from service ID (zero-collision design)
+         * @brief Check whether a service ID may be registered
          * @param service_id Service ID
-         * @return Slot index (1~1023, or 0 if invalid)
+         * @return false for the reserved IDs 0x0000 and 0xF000
          * 
-         * @note Algorithm: slot = service_id & 1023 (low 10 bits)
-         * @note Slot 0 is reserved (0x0000 and 0xF000 are invalid)
+         * @note Slot placement is done by SingleRegistry (hashed open addressing),
+         *       so any other ID is accepted regardless of its low bits
          */
-        static uint32_t CalculateSlot(uint64_t service_id) noexcept
+        static bool IsValidServiceId(uint64_t service_id) noexcept
         {
-            uint32_t slot = static_cast<uint32_t>(service_id & 1023);
-            
-            // Slot 0 is reserved (invalid service IDs)
-            if (slot == 0) {
-                return 0;  // Invalid
-            }
-            
-            return slot;
+            uint16_t sid = static_cast<uint16_t>(service_id & 0xFFFF);
+            return sid != RegistryConfig::INVALID_SERVICE_ID_1 &&
+                   sid != RegistryConfig::INVALID_SERVICE_ID_2;
         }
 
         /**
          * @brief Select registry based on service ID
          * @param service_id Service ID
-         * @return RegistryType (QM_AB, ASIL_CD, or BOTH)
-         * @note v3.0 design: Updated service ID ranges
+         * @return RegistryType (QM, ASIL, or BOTH) from the routing table
          */
-        static RegistryType SelectRegistry(uint64_t service_id) noexcept
+        RegistryType SelectRegistry(uint64_t service_id) const noexcept
         {
-            uint16_t sid = static_cast<uint16_t>(service_id & 0xFFFF);
-            
-            if (sid == RegistryConfig::BROADCAST_SERVICE_ID) {
-                return RegistryType::BOTH;  // Broadcast to both registries (bidirectional)
-            } else if (sid >= RegistryConfig::ASIL_SERVICE_ID_MIN && 
-                       sid <= RegistryConfig::ASIL_SERVICE_ID_MAX) {
-                return RegistryType::ASIL;  // ASIL-C/D services
-            } else if (sid >= RegistryConfig::QM_SERVICE_ID_MIN && 
-                       sid <= RegistryConfig::QM_SERVICE_ID_MAX) {
-                return RegistryType::QM;  // QM + ASIL-A/B services
-            } else {
-                // Invalid service ID (out of range or reserved)
-                return RegistryType::QM;  // Fallback to QM
-            }
+            return routing_.Route(service_id);
+        }
+
+        /**
+         * @brief Registry searched first for service_id (BOTH: QM copy is authoritative)
+         */
+        RegistryType PrimaryRegistry(uint64_t service_id) const noexcept
+        {
+            return (SelectRegistry(service_id) == RegistryType::ASIL) ? RegistryType::ASIL : RegistryType::QM;
+        }
+
+        /**
+         * @brief Current (non-retired unless Refresh() is pending) registry of a type
+         * @param type QM or ASIL
+         */
+        SingleRegistry& Active(RegistryType type) const noexcept
+        {
+            return *((type == RegistryType::ASIL) ? asil_active_ : qm_active_).load(std::memory_order_acquire);
         }
 
+        /**
+         * @brief Switch one registry to its successor if it is retired
+         * @param type QM or ASIL
+         * @return Result<bool> true if switched
+         * @note Caller must hold refresh_mutex_
+         */
+        Result<bool> refreshRegistry(RegistryType type) noexcept;
+
+        /**
+         * @brief Cached LookupService() in one registry
+         * @note Entries are per (service_id, registry), so a COMBINED lookup
+         *       keeps the miss of one registry and the hit of the other
+         */
+        Result<ServiceSlot> lookupIn(
+            RegistryType type, uint64_t service_id, Liveness liveness, uint64_t now_ns) const noexcept;
+
+        /**
+         * @brief Cached FindService() result of one service
+         *
+         * @details Read and filled under the per-entry seqlock, so concurrent
+         *          FindService() calls share no lock. A reader that meets a fill
+         *          in progress (odd or changed sequence) treats it as a miss; a
+         *          filler that finds the entry being filled leaves it alone.
+         */
+        struct alignas(64) LookupCacheEntry
+        {
+            std::atomic<uint64_t> sequence{0};  ///< Entry seqlock (odd = being filled)
+            const SingleRegistry* registry;  ///< Registry the result was read from (nullptr = unused)
+            uint64_t service_id;             ///< Cached service ID
+            uint32_t generation;             ///< Registry generation before the read
+            uint32_t slot_index;             ///< Slot of the instance (RESERVED_SLOT = not found)
+            ServiceSlot slot;                ///< Decoded slot (endpoint, binding type, versions)
+        };
+
+        /**
+         * @brief Cache hit/miss counters of the threads mapped to one shard
+         * @note Same sharding as RegistryStatsShard, keyed by thread instead of PID
+         */
+        struct alignas(64) LookupCacheCounters
+        {
+            std::atomic<uint64_t> hits{0};    ///< Lookups answered from the cache
+            std::atomic<uint64_t> misses{0};  ///< Lookups that read the shared registry
+        };
+
+        /**
+         * @brief Counter shard of the calling thread
+         */
+        LookupCacheCounters& countersOfThisThread() const noexcept;
+
+        /**
+         * @brief Register an instance in one registry, following an online resize once
+         */
+        Result<void> RegisterIn(
+            RegistryType type,
+            uint64_t service_id,
+            uint64_t instance_id,
+            uint32_t major_version,
+            uint32_t minor_version,
+            const char* binding_type,
+            const char* endpoint,
+            uint32_t heartbeat_interval_ms) noexcept;
+
+        /**
+         * @brief Unregister an instance (any instance if instance_id is empty) from
+         *        one registry, following an online resize once
+         */
+        Result<void> UnregisterFrom(
+            RegistryType type, uint64_t service_id, const Optional<uint64_t>& instance_id) noexcept;
+
+        /**
+         * @brief Update heartbeat of the active slot of service_id in one registry
+         */
+        static Result<void> UpdateHeartbeatIn(
+            SingleRegistry& registry, uint64_t service_id, uint64_t timestamp_ns) noexcept;
+
+        /**
+         * @brief Append the heartbeat target of (service_id, instance_id) in one registry
+         * @return true if the instance is registered there
+         */
+        static bool AppendHeartbeatTarget(
+            const SingleRegistry& registry, RegistryType type,
+            uint64_t service_id, uint64_t instance_id, Vector<HeartbeatTarget>& targets);
+
     private:
-        SingleRegistry qm_registry_;    ///< QM registry (QM + ASIL-A/B)
-        SingleRegistry asil_registry_;  ///< ASIL registry (ASIL-C/D only)
+        SingleRegistry qm_registry_;    ///< QM registry (QM + ASIL-A/B), initial memfd
+        SingleRegistry asil_registry_;  ///< ASIL registry (ASIL-C/D only), initial memfd
+        std::atomic<SingleRegistry*> qm_active_;    ///< Current QM registry
+        std::atomic<SingleRegistry*> asil_active_;  ///< Current ASIL registry
+        Vector<std::unique_ptr<SingleRegistry>> successors_;  ///< Resized registries (kept until destruction)
+        mutable std::mutex refresh_mutex_;  ///< Serializes Refresh(), guards successors_
+        std::atomic<uint32_t> refresh_count_;  ///< Number of registry switches
+        String qm_socket_path_;         ///< Daemon socket of the QM registry (empty = standalone)
+        String asil_socket_path_;       ///< Daemon socket of the ASIL registry (empty = standalone)
+        RegistryMemoryOptions memory_options_;  ///< Applied to successor mappings
+        RegistryRoutingTable routing_;  ///< service_id → registry (set before use)
+        mutable std::array<LookupCacheEntry, RegistryConfig::LOOKUP_CACHE_SIZE> lookup_cache_;  ///< FindService() cache
+        mutable std::array<LookupCacheCounters, RegistryLayout::STATS_SHARDS> lookup_cache_counters_;  ///< Per-thread-shard hit/miss counters
     };
 
 } // namespace registry
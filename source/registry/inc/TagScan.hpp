@@ -0,0 +1,230 @@
+/**
+ * @file        TagScan.hpp
+ * @author      LightAP Development Team
+ * @brief       Vectorized scan of the registry probe tag table
+ * @date        2025-11-20
+ * @details     Compares 64 one-byte probe tags per call and returns a bitmask of
+ *              matching slots, so full-registry scans (all instances of a
+ *              service, snapshots of all live slots) only touch the index entries
+ *              of candidate slots. Implementations, selected at compile time:
+ *              - AVX2:   2 × 32-byte compares + movemask
+ *              - SSE2:   4 × 16-byte compares + movemask (x86-64 baseline)
+ *              - NEON:   4 × 16-byte compares, bit-weighted horizontal add (AArch64)
+ *              - scalar: byte loop (other targets; always available for comparison)
+ * @copyright   Copyright (c) 2025
+ * @note        AUTOSAR R24-11 Compliance:
+ *              - SWS_CM_00001: FindService implementation
+ * @reference   SERVICE_DISCOVERY_ARCHITECTURE.md §2.1 (Core Data Structures)
+ * sdk:
+ * platform:    Linux 5.10+ (x86_64, ARM64)
+ * project:     LightAP
+ * @version
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author          <th>Description
+ * <tr><td>2025/11/20  <td>1.0      <td>LightAP Team    <td>Initial implementation
+ * </table>
+ */
+#ifndef LAP_COM_REGISTRY_TAG_SCAN_HPP
+#define LAP_COM_REGISTRY_TAG_SCAN_HPP
+
+#include "RegistryLayout.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+    #define LAP_TAG_SCAN_AVX2 1
+#elif defined(__SSE2__)
+    #include <emmintrin.h>
+    #define LAP_TAG_SCAN_SSE2 1
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+    #include <arm_neon.h>
+    #define LAP_TAG_SCAN_NEON 1
+#endif
+
+namespace lap
+{
+namespace com
+{
+namespace registry
+{
+    /**
+     * @brief Bitmask scans over 64-tag blocks of the probe tag table
+     *
+     * @details Bit i of a result refers to tag block[i]. Blocks must be readable
+     *          for 64 bytes: the tag table is cache-line aligned and rounded up
+     *          to whole cache lines (RegistryLayout::TagTableSize()), so every
+     *          block starting at a multiple of 64 is in bounds; callers mask off
+     *          bits at or beyond the slot count.
+     *
+     * @note Tags are read with plain (vector) loads. Callers issue
+     *       std::atomic_thread_fence(acquire) before reading the slots of a
+     *       match and validate them under their seqlock, like a tag load.
+     */
+    class TagScan final
+    {
+    public:
+        /// Tags compared per call
+        static constexpr uint32_t BLOCK_SIZE = 64;
+
+        /**
+         * @brief Slots of a block whose tag equals `tag`
+         * @param block First tag of the block (64 readable bytes)
+         * @param tag Probe tag to look for
+         * @return Bitmask of matching slots
+         */
+        static uint64_t MatchMask(const std::atomic<uint8_t>* block, uint8_t tag) noexcept
+        {
+            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(block);
+#if defined(LAP_TAG_SCAN_AVX2)
+            const __m256i needle = _mm256_set1_epi8(static_cast<char>(tag));
+            const __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes));
+            const __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes + 32));
+            return Combine32(_mm256_movemask_epi8(_mm256_cmpeq_epi8(lo, needle)),
+                             _mm256_movemask_epi8(_mm256_cmpeq_epi8(hi, needle)));
+#elif defined(LAP_TAG_SCAN_SSE2)
+            const __m128i needle = _mm_set1_epi8(static_cast<char>(tag));
+            uint64_t mask = 0;
+            for (uint32_t i = 0; i < 4; ++i) {
+                const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i * 16));
+                mask |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, needle))))
+                        << (i * 16);
+            }
+            return mask;
+#elif defined(LAP_TAG_SCAN_NEON)
+            const uint8x16_t needle = vdupq_n_u8(tag);
+            uint64_t mask = 0;
+            for (uint32_t i = 0; i < 4; ++i) {
+                mask |= static_cast<uint64_t>(MoveMask(vceqq_u8(vld1q_u8(bytes + i * 16), needle))) << (i * 16);
+            }
+            return mask;
+#else
+            return MatchMaskScalar(block, tag);
+#endif
+        }
+
+        /**
+         * @brief Slots of a block holding a live tag (>= SlotTag::MIN_LIVE)
+         * @param block First tag of the block (64 readable bytes)
+         * @return Bitmask of occupied slots (EMPTY and TOMBSTONE excluded)
+         */
+        static uint64_t LiveMask(const std::atomic<uint8_t>* block) noexcept
+        {
+            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(block);
+#if defined(LAP_TAG_SCAN_AVX2)
+            // Unsigned v >= MIN_LIVE  <=>  max(v, MIN_LIVE) == v
+            const __m256i floor = _mm256_set1_epi8(static_cast<char>(SlotTag::MIN_LIVE));
+            const __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes));
+            const __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes + 32));
+            return Combine32(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_max_epu8(lo, floor), lo)),
+                             _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_max_epu8(hi, floor), hi)));
+#elif defined(LAP_TAG_SCAN_SSE2)
+            const __m128i floor = _mm_set1_epi8(static_cast<char>(SlotTag::MIN_LIVE));
+            uint64_t mask = 0;
+            for (uint32_t i = 0; i < 4; ++i) {
+                const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i * 16));
+                mask |= static_cast<uint64_t>(
+                            static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(v, floor), v))))
+                        << (i * 16);
+            }
+            return mask;
+#elif defined(LAP_TAG_SCAN_NEON)
+            const uint8x16_t floor = vdupq_n_u8(SlotTag::MIN_LIVE);
+            uint64_t mask = 0;
+            for (uint32_t i = 0; i < 4; ++i) {
+                mask |= static_cast<uint64_t>(MoveMask(vcgeq_u8(vld1q_u8(bytes + i * 16), floor))) << (i * 16);
+            }
+            return mask;
+#else
+            return LiveMaskScalar(block);
+#endif
+        }
+
+        /**
+         * @brief Portable reference implementation of MatchMask()
+         */
+        static uint64_t MatchMaskScalar(const std::atomic<uint8_t>* block, uint8_t tag) noexcept
+        {
+            uint64_t mask = 0;
+            for (uint32_t i = 0; i < BLOCK_SIZE; ++i) {
+                if (block[i].load(std::memory_order_relaxed) == tag) {
+                    mask |= 1ULL << i;
+                }
+            }
+            return mask;
+        }
+
+        /**
+         * @brief Portable reference implementation of LiveMask()
+         */
+        static uint64_t LiveMaskScalar(const std::atomic<uint8_t>* block) noexcept
+        {
+            uint64_t mask = 0;
+            for (uint32_t i = 0; i < BLOCK_SIZE; ++i) {
+                if (block[i].load(std::memory_order_relaxed) >= SlotTag::MIN_LIVE) {
+                    mask |= 1ULL << i;
+                }
+            }
+            return mask;
+        }
+
+        /**
+         * @brief Mask of the valid slots of the block starting at `first_slot`
+         * @param first_slot Slot index of the block's first tag
+         * @param slot_count Slots in the registry
+         * @return Bitmask without slot 0 (reserved) and slots >= slot_count
+         */
+        static uint64_t ValidMask(uint32_t first_slot, uint32_t slot_count) noexcept
+        {
+            const uint32_t remaining = slot_count - first_slot;
+            uint64_t mask = (remaining >= BLOCK_SIZE) ? ~0ULL : ((1ULL << remaining) - 1U);
+            if (first_slot == 0) {
+                mask &= ~1ULL;
+            }
+            return mask;
+        }
+
+        /**
+         * @brief Name of the compiled-in implementation ("avx2", "sse2", "neon", "scalar")
+         */
+        static constexpr const char* Isa() noexcept
+        {
+#if defined(LAP_TAG_SCAN_AVX2)
+            return "avx2";
+#elif defined(LAP_TAG_SCAN_SSE2)
+            return "sse2";
+#elif defined(LAP_TAG_SCAN_NEON)
+            return "neon";
+#else
+            return "scalar";
+#endif
+        }
+
+    private:
+#if defined(LAP_TAG_SCAN_AVX2)
+        static uint64_t Combine32(int lo, int hi) noexcept
+        {
+            return static_cast<uint64_t>(static_cast<uint32_t>(lo)) |
+                   (static_cast<uint64_t>(static_cast<uint32_t>(hi)) << 32);
+        }
+#endif
+
+#if defined(LAP_TAG_SCAN_NEON)
+        /// 16 compare lanes (0x00/0xFF) → 16-bit mask
+        static uint16_t MoveMask(uint8x16_t lanes) noexcept
+        {
+            static const uint8_t BIT_WEIGHTS[16] = {1, 2, 4, 8, 16, 32, 64, 128,
+                                                    1, 2, 4, 8, 16, 32, 64, 128};
+            const uint8x16_t bits = vandq_u8(lanes, vld1q_u8(BIT_WEIGHTS));
+            return static_cast<uint16_t>(vaddv_u8(vget_low_u8(bits)) |
+                                         (static_cast<uint16_t>(vaddv_u8(vget_high_u8(bits))) << 8));
+        }
+#endif
+    };
+
+} // namespace registry
+} // namespace com
+} // namespace lap
+
+#endif // LAP_COM_REGISTRY_TAG_SCAN_HPP
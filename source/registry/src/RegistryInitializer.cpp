@@ -5,27 +5,34 @@
  * @date        2025-11-20
  * @details     Implements Phase 2 of SERVICE_DISCOVERY_ARCHITECTURE.md §2.2.2:
  *              - Creates anonymous memfd via memfd_create()
- *              - Initializes 1024 service slots (256 bytes each)
- *              - Listens on Unix Domain Socket
+ *              - Formats registry header, probe tag table and 1024 service slots
+ *              - Listens on Unix Domain Socket (epoll accept loop)
  *              - Distributes memfd FD to clients via SCM_RIGHTS
+ *              - Reclaims slots of crashed owners (pidfd_open + epoll)
  * @copyright   Copyright (c) 2025
  * @note        AUTOSAR R24-11 Compliance:
  *              - SWS_CM_00001: Service discovery infrastructure
  *              - SWS_CM_00110: Registry lifecycle management
  * @reference   SERVICE_DISCOVERY_ARCHITECTURE.md §2.2.2
- *              memfd_create(2), unix(7), cmsg(3)
+ *              memfd_create(2), unix(7), cmsg(3), pidfd_open(2), epoll(7), eventfd(2)
  * @version     1.0
  */
 #include "RegistryInitializer.hpp"
 #include "ComTypes.hpp"
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
 #include <sys/mman.h>
 #include <sys/socket.h>
+#include <sys/syscall.h>
 #include <sys/un.h>
 #include <sys/stat.h>
 #include <fcntl.h>
 #include <unistd.h>
 #include <cerrno>
+#include <csignal>
 #include <cstring>
+#include <map>
+#include <set>
 
 // memfd_create support (Linux 3.17+)
 // System header should provide this, but define constants if missing
@@ -39,7 +46,6 @@
 // Ensure memfd_create is available
 // Most modern systems provide it via <sys/mman.h>, otherwise use syscall
 #if !defined(__GLIBC__) || __GLIBC__ < 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ < 27)
-    #include <sys/syscall.h>
     #ifndef __NR_memfd_create
         #if defined(__x86_64__)
             #define __NR_memfd_create 319
@@ -66,6 +72,11 @@
     }
 #endif
 
+// pidfd_open support (Linux 5.3+), same number on all architectures
+#ifndef SYS_pidfd_open
+    #define SYS_pidfd_open 434
+#endif
+
 namespace lap
 {
 namespace com
@@ -80,7 +91,10 @@ namespace registry
         , socket_path_(socket_path)
         , memfd_(-1)
         , socket_fd_(-1)
+        , wake_fd_(eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK))
+        , base_(nullptr)
         , slots_(nullptr)
+        , registry_view_(std::make_unique<SingleRegistry>(registry_type))
         , running_(false)
     {
     }
@@ -90,19 +104,33 @@ namespace registry
         Shutdown();
         
         // Cleanup mapped memory
-        if (slots_ != nullptr)
+        if (base_ != nullptr)
         {
-            munmap(slots_, RegistryConfig::REGISTRY_SIZE);
+            munmap(base_, mapped_size_);
+            base_ = nullptr;
+            mapped_size_ = 0;
             slots_ = nullptr;
         }
         
         // Close memfd
-        if (memfd_ >= 0)
+        int memfd = memfd_.exchange(-1);
+        if (memfd >= 0)
         {
-            close(memfd_);
-            memfd_ = -1;
+            close(memfd);
         }
         
+        // Release registries replaced by online resizes
+        for (const auto& mapping : retired_mappings_)
+        {
+            munmap(mapping.first, mapping.second);
+        }
+        retired_mappings_.clear();
+        for (int fd : retired_memfds_)
+        {
+            close(fd);
+        }
+        retired_memfds_.clear();
+        
         // Close and cleanup socket
         if (socket_fd_ >= 0)
         {
@@ -110,69 +138,98 @@ namespace registry
             socket_fd_ = -1;
             unlink(socket_path_.c_str());  // Remove socket file
         }
+
+        if (wake_fd_ >= 0)
+        {
+            close(wake_fd_);
+            wake_fd_ = -1;
+        }
     }
 
     Result<void> RegistryInitializer::Initialize() noexcept
     {
         // Create and initialize memfd
-        auto memfd_result = createMemfd();
+        const uint32_t slot_count = slot_count_.load(std::memory_order_relaxed);
+        int memfd = -1;
+        auto memfd_result = createMemfd(slot_count, memfd, base_, mapped_size_);
         if (!memfd_result.HasValue())
         {
             return memfd_result;
         }
+        slots_ = RegistryLayout::Slots(base_, slot_count);
+        memfd_.store(memfd, std::memory_order_release);
+
+        // Registry API view for the reaper (shares the same mapping pages)
+        registry_view_->SetMemoryOptions(memory_options_);
+        auto view_result = registry_view_->InitializeFromFd(memfd);
+        if (!view_result.HasValue())
+        {
+            LAP_COM_LOG_WARN << "Registry view unavailable, owner reaping disabled: "
+                             << view_result.Error().Message();
+        }
         
         const char* registry_type_str = (registry_type_ == RegistryType::QM) ? "QM" : "ASIL";
         LAP_COM_LOG_INFO << "RegistryInitializer: Initialized " << registry_type_str 
-                         << " registry, memfd=" << memfd_ 
-                         << ", size=" << RegistryConfig::REGISTRY_SIZE << " bytes";
+                         << " registry, memfd=" << memfd 
+                         << ", slots=" << slot_count << " (max " << max_slot_count_ << ")"
+                         << ", size=" << mapped_size_ << " bytes"
+                         << (registry_view_->IsHugePageBacked() ? " (huge pages)" : "");
         
         return Result<void>();
     }
 
-    Result<void> RegistryInitializer::createMemfd() noexcept
+    Result<void> RegistryInitializer::createMemfd(uint32_t slot_count, int& fd, void*& base, size_t& size) noexcept
     {
         // Step 1: Create anonymous memfd
         const char* memfd_name = (registry_type_ == RegistryType::QM) 
                                  ? RegistryConfig::QM_MEMFD_NAME 
                                  : RegistryConfig::ASIL_MEMFD_NAME;
         
-        memfd_ = memfd_create(memfd_name, MFD_CLOEXEC | MFD_ALLOW_SEALING);
-        if (memfd_ < 0)
+        // Step 2: Resize to header + tag table + slot_count slots × 256 bytes
+        //         (rounded up to the huge page size when backed by huge pages)
+        const size_t registry_size = RegistryLayout::TotalSize(slot_count);
+        size_t memfd_size = 0;
+        auto fd_result = SingleRegistry::CreateMemfd(memfd_name, registry_size,
+                                                     memory_options_.huge_pages, memfd_size);
+        if (!fd_result.HasValue())
         {
-            LAP_COM_LOG_ERROR << "memfd_create(\"" << memfd_name << "\") failed: " << strerror(errno);
-            return Result<void>::FromError(MakeErrorCode(ComErrc::kMemfdCreateFailed));
+            LAP_COM_LOG_ERROR << "memfd_create(\"" << memfd_name << "\") failed: " << fd_result.Error().Message();
+            return Result<void>::FromError(fd_result.Error());
         }
+        fd = fd_result.Value();
         
-        // Step 2: Resize to 256KB (1024 slots × 256 bytes)
-        if (ftruncate(memfd_, RegistryConfig::REGISTRY_SIZE) != 0)
+        if (memory_options_.huge_pages && memfd_size == registry_size)
         {
-            LAP_COM_LOG_ERROR << "ftruncate(" << RegistryConfig::REGISTRY_SIZE << ") failed: " << strerror(errno);
-            close(memfd_);
-            memfd_ = -1;
-            return Result<void>::FromError(MakeErrorCode(ComErrc::kSharedMemoryResizeFailed));
+            LAP_COM_LOG_WARN << "Huge pages unavailable for \"" << memfd_name 
+                             << "\", falling back to regular pages";
         }
         
-        // Step 3: Map to process address space
-        void* addr = mmap(nullptr, RegistryConfig::REGISTRY_SIZE, 
-                         PROT_READ | PROT_WRITE, MAP_SHARED, memfd_, 0);
-        if (addr == MAP_FAILED)
+        // Step 3: Map to process address space (optionally pre-faulted and locked)
+        bool locked = false;
+        auto addr_result = SingleRegistry::MapMemfd(fd, memfd_size, memory_options_, locked);
+        if (!addr_result.HasValue())
         {
-            LAP_COM_LOG_ERROR << "mmap(" << RegistryConfig::REGISTRY_SIZE << ") failed: " << strerror(errno);
-            close(memfd_);
-            memfd_ = -1;
-            return Result<void>::FromError(MakeErrorCode(ComErrc::kSharedMemoryMappingFailed));
+            LAP_COM_LOG_ERROR << "mmap(" << memfd_size << ") failed: " << addr_result.Error().Message();
+            close(fd);
+            fd = -1;
+            return Result<void>::FromError(addr_result.Error());
         }
         
-        slots_ = static_cast<ServiceSlot*>(addr);
-        
-        // Step 4: Initialize all slots to IDLE state
-        for (uint32_t i = 0; i < RegistryConfig::MAX_SLOTS; ++i)
+        if (memory_options_.lock && !locked)
         {
-            new (&slots_[i]) ServiceSlot();
+            LAP_COM_LOG_WARN << "mlock(" << memfd_size << ") failed: " << strerror(errno)
+                             << " (check RLIMIT_MEMLOCK, continuing unlocked)";
         }
         
-        // Step 5: Seal memfd for security (prevents resize/modification)
-        if (fcntl(memfd_, F_ADD_SEALS, RegistryConfig::SEALING_FLAGS) != 0)
+        base = addr_result.Value();
+        size = memfd_size;
+        
+        // Step 4: Format header, probe tags and slots (all slots IDLE)
+        RegistryLayout::Format(base, slot_count, RegistryConfig::MAX_PROBE_STEPS);
+        
+        // Step 5: Seal memfd for security (prevents resize/modification;
+        //         online growth publishes a new memfd instead)
+        if (fcntl(fd, F_ADD_SEALS, RegistryConfig::SEALING_FLAGS) != 0)
         {
             LAP_COM_LOG_WARN << "fcntl(F_ADD_SEALS) failed: " << strerror(errno) 
                              << " (non-critical, continuing)";
@@ -187,7 +244,7 @@ namespace registry
         (void)use_systemd_socket;  // Unused for now
         
         // Step 1: Create Unix Domain Socket
-        socket_fd_ = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        socket_fd_ = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC | SOCK_NONBLOCK, 0);
         if (socket_fd_ < 0)
         {
             LAP_COM_LOG_ERROR << "socket(AF_UNIX) failed: " << strerror(errno);
@@ -220,8 +277,8 @@ namespace registry
             LAP_COM_LOG_WARN << "chmod() failed: " << strerror(errno) << " (non-critical)";
         }
         
-        // Step 5: Listen for client connections (backlog=128)
-        if (listen(socket_fd_, 128) != 0)
+        // Step 5: Listen for client connections (a boot storm queues here)
+        if (listen(socket_fd_, LISTEN_BACKLOG) != 0)
         {
             LAP_COM_LOG_ERROR << "listen() failed: " << strerror(errno);
             close(socket_fd_);
@@ -246,42 +303,358 @@ namespace registry
         // Start accept loop
         running_.store(true, std::memory_order_release);
         LAP_COM_LOG_INFO << "Registry server started, waiting for client connections...";
+
+        // Start crash-owner reaper (also grows the registry, so it runs even
+        // with reaping disabled)
+        if (registry_view_->IsInitialized())
+        {
+            reaper_thread_ = std::thread(&RegistryInitializer::reaperLoop, this);
+        }
         
-        uint64_t client_count = 0;
+        int epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+        if (epoll_fd < 0)
+        {
+            LAP_COM_LOG_ERROR << "epoll_create1() failed: " << strerror(errno);
+            running_.store(false, std::memory_order_release);
+        }
+        else
+        {
+            struct epoll_event ev{};
+            ev.events = EPOLLIN;
+            ev.data.fd = socket_fd_;
+            epoll_ctl(epoll_fd, EPOLL_CTL_ADD, socket_fd_, &ev);
+            if (wake_fd_ >= 0)
+            {
+                ev.data.fd = wake_fd_;
+                epoll_ctl(epoll_fd, EPOLL_CTL_ADD, wake_fd_, &ev);
+            }
+        }
+
+        Vector<int> pending;  // Clients waiting for EPOLLOUT
+        struct epoll_event events[MAX_ACCEPT_EVENTS];
         
         while (running_.load(std::memory_order_acquire))
         {
-            struct sockaddr_un client_addr{};
-            socklen_t client_len = sizeof(client_addr);
-            
-            int client_fd = accept(socket_fd_, 
-                                  reinterpret_cast<struct sockaddr*>(&client_addr), 
-                                  &client_len);
-            
-            if (client_fd < 0)
+            int ready = epoll_wait(epoll_fd, events, MAX_ACCEPT_EVENTS, -1);
+            if (ready < 0)
             {
-                if (errno == EINTR || errno == EBADF)
+                if (errno == EINTR)
                 {
-                    // Interrupted or socket closed (shutdown triggered)
                     continue;
                 }
-                LAP_COM_LOG_ERROR << "accept() failed: " << strerror(errno);
-                continue;
+                LAP_COM_LOG_ERROR << "epoll_wait() failed: " << strerror(errno);
+                break;
+            }
+
+            for (int i = 0; i < ready; ++i)
+            {
+                const int fd = events[i].data.fd;
+                if (fd == wake_fd_)
+                {
+                    continue;  // Shutdown(), running_ is already false
+                }
+                if (fd == socket_fd_)
+                {
+                    if (!acceptClients(epoll_fd, pending))
+                    {
+                        running_.store(false, std::memory_order_release);
+                    }
+                    continue;
+                }
+
+                // Parked client became writable (or hung up)
+                bool would_block = false;
+                if ((events[i].events & (EPOLLERR | EPOLLHUP)) == 0)
+                {
+                    handleClient(fd, would_block);
+                }
+                if (!would_block)
+                {
+                    epoll_ctl(epoll_fd, EPOLL_CTL_DEL, fd, nullptr);
+                    pending.erase(std::remove(pending.begin(), pending.end(), fd), pending.end());
+                    close(fd);
+                }
+            }
+        }
+
+        for (int fd : pending)
+        {
+            close(fd);
+        }
+        if (epoll_fd >= 0)
+        {
+            close(epoll_fd);
+        }
+        
+        if (reaper_thread_.joinable())
+        {
+            reaper_thread_.join();
+        }
+        
+        LAP_COM_LOG_INFO << "Registry server stopped, served " << served_count_.load(std::memory_order_relaxed) << " clients"
+                         << ", reaped " << reaped_count_.load(std::memory_order_relaxed) << " slots";
+        return Result<void>();
+    }
+
+    bool RegistryInitializer::acceptClients(int epoll_fd, Vector<int>& pending) noexcept
+    {
+        // Level-triggered: stop at EAGAIN, the next epoll_wait() reports new arrivals
+        while (running_.load(std::memory_order_acquire))
+        {
+            int client_fd = accept4(socket_fd_, nullptr, nullptr, SOCK_CLOEXEC | SOCK_NONBLOCK);
+            if (client_fd < 0)
+            {
+                if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR ||
+                    errno == ECONNABORTED)
+                {
+                    return true;
+                }
+                if (errno == EMFILE || errno == ENFILE || errno == ENOBUFS || errno == ENOMEM)
+                {
+                    // Leave the rest queued; retried on the next wakeup
+                    LAP_COM_LOG_WARN << "accept4() failed: " << strerror(errno);
+                    return true;
+                }
+                if (errno != EINVAL && errno != EBADF)
+                {
+                    LAP_COM_LOG_ERROR << "accept4() failed: " << strerror(errno);
+                }
+                return false;  // Socket shut down
             }
             
-            ++client_count;
-            LAP_COM_LOG_DEBUG << "Client #" << client_count << " connected, fd=" << client_fd;
+            LAP_COM_LOG_DEBUG << "Client connected, fd=" << client_fd;
             
             // Handle client request (send memfd)
-            handleClient(client_fd);
-            
+            bool would_block = false;
+            handleClient(client_fd, would_block);
+            if (would_block)
+            {
+                struct epoll_event ev{};
+                ev.events = EPOLLOUT;
+                ev.data.fd = client_fd;
+                if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, client_fd, &ev) == 0)
+                {
+                    pending.push_back(client_fd);
+                    continue;
+                }
+            }
             close(client_fd);
         }
+        return true;
+    }
+
+    void RegistryInitializer::reaperLoop() noexcept
+    {
+        int epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+        if (epoll_fd < 0)
+        {
+            LAP_COM_LOG_ERROR << "epoll_create1() failed: " << strerror(errno) << " (reaper disabled)";
+            return;
+        }
+        
+        std::map<pid_t, int> watched;          // owner PID -> pidfd
+        Vector<ServiceSlotSummary> entries;
+        entries.reserve(registry_view_->GetSlotCount());
+        
+        bool pidfd_supported = true;
+        bool first_scan = true;
+        uint32_t scanned_generation = 0;
+        
+        // SetReapInterval(0): owners are not watched, only growth is handled
+        const bool reaping = reap_interval_ms_ > 0;
+        const int wait_ms = static_cast<int>(reaping ? reap_interval_ms_ : DEFAULT_REAP_INTERVAL_MS);
+        
+        while (running_.load(std::memory_order_acquire))
+        {
+            // Step 1: Watch owners that appeared since the last scan
+            uint32_t generation = registry_view_->GetGeneration();
+            if (first_scan || generation != scanned_generation || !pidfd_supported ||
+                resize_request_.load(std::memory_order_acquire) != 0)
+            {
+                first_scan = false;
+                scanned_generation = generation;
+                
+                entries.clear();
+                registry_view_->Snapshot(entries);
+                
+                // Grow on request or once the load factor exceeds GROW_LOAD_PERCENT
+                const uint32_t slot_count = registry_view_->GetSlotCount();
+                uint32_t target = resize_request_.exchange(0, std::memory_order_acq_rel);
+                if (target == 0 &&
+                    static_cast<uint64_t>(entries.size()) * 100 >=
+                        static_cast<uint64_t>(slot_count) * RegistryConfig::GROW_LOAD_PERCENT)
+                {
+                    target = slot_count * 2;
+                }
+                target = std::min(target, max_slot_count_);
+                if (target > slot_count && growRegistry(target).HasValue())
+                {
+                    scanned_generation = registry_view_->GetGeneration();
+                    entries.reserve(target);
+                }
+                
+                std::set<pid_t> owners;
+                for (const auto& entry : entries)
+                {
+                    if (reaping && entry.owner_pid > 0)
+                    {
+                        owners.insert(entry.owner_pid);
+                    }
+                }
+                
+                // Stop watching owners that unregistered cleanly
+                for (auto it = watched.begin(); it != watched.end();)
+                {
+                    if (owners.count(it->first) == 0)
+                    {
+                        epoll_ctl(epoll_fd, EPOLL_CTL_DEL, it->second, nullptr);
+                        close(it->second);
+                        it = watched.erase(it);
+                    }
+                    else
+                    {
+                        ++it;
+                    }
+                }
+                
+                for (pid_t owner : owners)
+                {
+                    if (watched.count(owner) != 0)
+                    {
+                        continue;
+                    }
+                    
+                    int pidfd = pidfd_supported
+                                ? static_cast<int>(syscall(SYS_pidfd_open, owner, 0))
+                                : -1;
+                    if (pidfd < 0)
+                    {
+                        if (pidfd_supported && errno == ENOSYS)
+                        {
+                            LAP_COM_LOG_WARN << "pidfd_open() not supported, falling back to kill(pid, 0)";
+                            pidfd_supported = false;
+                        }
+                        // Owner already gone (or no pidfd support): check directly
+                        if (kill(owner, 0) < 0 && errno == ESRCH)
+                        {
+                            reapOwner(owner, entries);
+                        }
+                        continue;
+                    }
+                    
+                    struct epoll_event ev{};
+                    ev.events = EPOLLIN;
+                    ev.data.u64 = static_cast<uint64_t>(owner);
+                    if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, pidfd, &ev) != 0)
+                    {
+                        close(pidfd);
+                        continue;
+                    }
+                    watched[owner] = pidfd;
+                }
+            }
+            
+            // Step 2: Sleep until an owner exits (or the interval elapses)
+            struct epoll_event events[16];
+            int ready = epoll_wait(epoll_fd, events, 16, wait_ms);
+            
+            // Step 3: Reclaim slots of exited owners
+            for (int i = 0; i < ready; ++i)
+            {
+                pid_t owner = static_cast<pid_t>(events[i].data.u64);
+                auto it = watched.find(owner);
+                if (it != watched.end())
+                {
+                    epoll_ctl(epoll_fd, EPOLL_CTL_DEL, it->second, nullptr);
+                    close(it->second);
+                    watched.erase(it);
+                }
+                reapOwner(owner, entries);
+            }
+        }
+        
+        for (const auto& item : watched)
+        {
+            close(item.second);
+        }
+        close(epoll_fd);
+    }
+
+    Result<void> RegistryInitializer::growRegistry(uint32_t slot_count) noexcept
+    {
+        if (slot_count > RegistryConfig::MAX_SLOTS_LIMIT)
+        {
+            return Result<void>::FromError(MakeErrorCode(ComErrc::kInvalidArgument));
+        }
+        
+        // Step 1: Format the successor (not served yet, so nobody else sees it)
+        int fd = -1;
+        void* base = nullptr;
+        size_t size = 0;
+        auto memfd_result = createMemfd(slot_count, fd, base, size);
+        if (!memfd_result.HasValue())
+        {
+            return memfd_result;
+        }
+        
+        auto successor = std::make_unique<SingleRegistry>(registry_type_);
+        successor->SetMemoryOptions(memory_options_);
+        auto view_result = successor->InitializeFromFd(fd);
+        
+        // Step 2: Copy all instances and retire the served registry
+        auto migrate_result = view_result.HasValue()
+                              ? registry_view_->MigrateTo(*successor)
+                              : Result<uint32_t>::FromError(view_result.Error());
+        if (!migrate_result.HasValue())
+        {
+            LAP_COM_LOG_ERROR << "Registry resize to " << slot_count << " slots failed: "
+                              << migrate_result.Error().Message();
+            munmap(base, size);
+            close(fd);
+            return Result<void>::FromError(migrate_result.Error());
+        }
+        
+        // Step 3: Serve the successor; clients of the retired memfd reconnect.
+        // The old memfd stays open: a concurrent sendMemfdToClient() may pass it
+        // (such a client sees it retired and simply asks again)
+        retired_memfds_.push_back(memfd_.exchange(fd, std::memory_order_acq_rel));
+        retired_mappings_.emplace_back(base_, mapped_size_);
+        base_ = base;
+        mapped_size_ = size;
+        slots_ = RegistryLayout::Slots(base, slot_count);
+        registry_view_ = std::move(successor);
+        slot_count_.store(slot_count, std::memory_order_release);
+        
+        LAP_COM_LOG_INFO << "Registry resized to " << slot_count << " slots (epoch "
+                         << registry_view_->GetEpoch() << ", " << migrate_result.Value()
+                         << " instances migrated, memfd=" << fd << ")";
         
-        LAP_COM_LOG_INFO << "Registry server stopped, served " << client_count << " clients";
         return Result<void>();
     }
 
+    void RegistryInitializer::reapOwner(pid_t owner_pid, Vector<ServiceSlotSummary>& entries) noexcept
+    {
+        entries.clear();
+        registry_view_->Snapshot(entries);
+        
+        for (const auto& entry : entries)
+        {
+            if (entry.owner_pid != owner_pid)
+            {
+                continue;
+            }
+            
+            // ReclaimSlot re-checks the owner under the structure seqlock
+            if (registry_view_->ReclaimSlot(entry.slot_index, owner_pid).HasValue())
+            {
+                reaped_count_.fetch_add(1, std::memory_order_relaxed);
+                LAP_COM_LOG_INFO << "Reaped slot " << entry.slot_index 
+                                 << " (service_id=0x" << std::hex << entry.service_id << std::dec
+                                 << ", dead owner pid=" << owner_pid << ")";
+            }
+        }
+    }
+
     void RegistryInitializer::Shutdown() noexcept
     {
         // Set shutdown flag (thread-safe)
@@ -294,22 +667,29 @@ namespace registry
         
         LAP_COM_LOG_INFO << "Shutting down registry server...";
         
-        // Close socket to unblock accept()
+        // Wake the accept loop (epoll_wait) and make further accepts fail
+        if (wake_fd_ >= 0)
+        {
+            uint64_t one = 1;
+            ssize_t written = write(wake_fd_, &one, sizeof(one));
+            (void)written;
+        }
         if (socket_fd_ >= 0)
         {
             shutdown(socket_fd_, SHUT_RDWR);
         }
     }
 
-    Result<void> RegistryInitializer::handleClient(int client_fd) noexcept
+    Result<void> RegistryInitializer::handleClient(int client_fd, bool& would_block) noexcept
     {
-        auto result = sendMemfdToClient(client_fd);
+        auto result = sendMemfdToClient(client_fd, would_block);
         
         if (result.HasValue())
         {
+            served_count_.fetch_add(1, std::memory_order_relaxed);
             LAP_COM_LOG_DEBUG << "Successfully sent memfd to client, fd=" << client_fd;
         }
-        else
+        else if (!would_block)
         {
             LAP_COM_LOG_ERROR << "Failed to send memfd to client: " << result.Error().Message();
         }
@@ -317,8 +697,10 @@ namespace registry
         return result;
     }
 
-    Result<void> RegistryInitializer::sendMemfdToClient(int client_fd) noexcept
+    Result<void> RegistryInitializer::sendMemfdToClient(int client_fd, bool& would_block) noexcept
     {
+        would_block = false;
+
         // Prepare message with file descriptor passing (SCM_RIGHTS)
         struct msghdr msg{};
         struct iovec iov{};
@@ -345,10 +727,16 @@ namespace registry
         cmsg->cmsg_level = SOL_SOCKET;
         cmsg->cmsg_type = SCM_RIGHTS;
         cmsg->cmsg_len = CMSG_LEN(sizeof(int));
-        memcpy(CMSG_DATA(cmsg), &memfd_, sizeof(int));
+        const int memfd = memfd_.load(std::memory_order_acquire);
+        memcpy(CMSG_DATA(cmsg), &memfd, sizeof(int));
         
-        // Send message with file descriptor
-        ssize_t sent = sendmsg(client_fd, &msg, 0);
+        // Send message with file descriptor (never block the accept loop)
+        ssize_t sent = sendmsg(client_fd, &msg, MSG_DONTWAIT | MSG_NOSIGNAL);
+        if (sent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        {
+            would_block = true;
+            return Result<void>::FromError(MakeErrorCode(ComErrc::kFdPassingFailed));
+        }
         if (sent <= 0)
         {
             LAP_COM_LOG_ERROR << "sendmsg() failed: " << strerror(errno) 
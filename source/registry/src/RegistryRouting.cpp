@@ -0,0 +1,119 @@
+/**
+ * @file        RegistryRouting.cpp
+ * @author      LightAP Development Team
+ * @brief       Registry routing table loader (slot_mapping.yaml → flat service_id table)
+ * @date        2025-11-20
+ * @copyright   Copyright (c) 2025
+ * @note        Kept out of SharedMemoryRegistry.cpp so that only users of Load()
+ *              (lap_com, Runtime::Initialize()) depend on yaml-cpp
+ * @reference   source/config/slot_mapping.yaml (slot_mapping.registry_routing)
+ */
+
+#include "ComTypes.hpp"
+#include "SharedMemoryRegistry.hpp"
+
+#include <cstdlib>
+#include <memory>
+#include <string>
+
+#include <yaml-cpp/yaml.h>
+
+namespace lap
+{
+namespace com
+{
+namespace registry
+{
+    namespace
+    {
+        /**
+         * @brief Parse a 16-bit service ID ("0xF001" or "61441")
+         */
+        bool ParseServiceId(const YAML::Node& node, uint16_t& service_id)
+        {
+            if (!node) {
+                return false;
+            }
+            const std::string text = node.as<std::string>("");
+            char* end = nullptr;
+            const unsigned long value = std::strtoul(text.c_str(), &end, 0);
+            if (text.empty() || *end != '\0' || value > 0xFFFFUL) {
+                return false;
+            }
+            service_id = static_cast<uint16_t>(value);
+            return true;
+        }
+
+        /**
+         * @brief Parse "QM" / "ASIL" / "BOTH" (case-sensitive, as in slot_mapping.yaml)
+         */
+        bool ParseRegistryType(const YAML::Node& node, RegistryType& type)
+        {
+            const std::string text = node ? node.as<std::string>("") : std::string();
+            if (text == "QM") {
+                type = RegistryType::QM;
+            } else if (text == "ASIL") {
+                type = RegistryType::ASIL;
+            } else if (text == "BOTH") {
+                type = RegistryType::BOTH;
+            } else {
+                return false;
+            }
+            return true;
+        }
+    }  // namespace
+
+    Result<void> RegistryRoutingTable::Load(const String& path) noexcept
+    {
+        try {
+            const YAML::Node root = YAML::LoadFile(path);
+            // Indexing a missing (invalid) node throws: check each level first
+            const YAML::Node mapping = root.IsMap() ? root["slot_mapping"] : YAML::Node(YAML::NodeType::Undefined);
+            if (!mapping || !mapping.IsMap() || !mapping["registry_routing"]) {
+                return Result<void>::FromValue();  // Keep the current (built-in) routing
+            }
+            const YAML::Node routing = mapping["registry_routing"];
+
+            // Built on a copy: the table is only replaced if the whole section is valid
+            auto parsed = std::make_unique<RegistryRoutingTable>();
+
+            RegistryType fallback = RegistryType::QM;
+            if (routing["default"] && !ParseRegistryType(routing["default"], fallback)) {
+                return Result<void>::FromError(MakeErrorCode(ComErrc::kInvalidArgument, 0));
+            }
+            parsed->Reset(fallback);
+
+            const std::string search = routing["search"].as<std::string>("routed");
+            if (search == "combined") {
+                parsed->SetSearch(RegistrySearch::COMBINED);
+            } else if (search != "routed") {
+                return Result<void>::FromError(MakeErrorCode(ComErrc::kInvalidArgument, 0));
+            }
+
+            const YAML::Node ranges = routing["ranges"];
+            if (ranges && !ranges.IsSequence()) {
+                return Result<void>::FromError(MakeErrorCode(ComErrc::kInvalidArgument, 0));
+            }
+            for (const auto& range : ranges) {
+                uint16_t first = 0;
+                uint16_t last = 0;
+                RegistryType type = RegistryType::QM;
+                if (!ParseServiceId(range["first"], first) ||
+                    !ParseServiceId(range["last"], last) ||
+                    !ParseRegistryType(range["registry"], type) ||
+                    !parsed->AddRange(first, last, type)) {
+                    return Result<void>::FromError(MakeErrorCode(ComErrc::kInvalidArgument, 0));
+                }
+            }
+
+            *this = *parsed;
+            return Result<void>::FromValue();
+        } catch (const std::exception&) {
+            // YAML::Exception (missing file, syntax error) and allocation failure
+            return Result<void>::FromError(MakeErrorCode(ComErrc::kInvalidArgument, 0));
+        }
+    }
+
+} // namespace registry
+} // namespace com
+} // namespace lap
@@ -0,0 +1,37 @@
+/**
+ * @file        SeqLock.cpp
+ * @author      LightAP Development Team
+ * @brief       Process-wide seqlock reader backoff policy
+ * @date        2025-11-20
+ * @copyright   Copyright (c) 2025
+ * @note        Kept out of SeqLock.hpp: lap_com hides inline symbols, so a
+ *              function-local static in the header would give the library and
+ *              the application separate copies of the policy
+ */
+
+#include "SeqLock.hpp"
+
+namespace lap
+{
+namespace com
+{
+namespace registry
+{
+    namespace
+    {
+        SeqLockBackoff g_reader_backoff;  ///< Constant-initialized (no init order issue)
+    }
+
+    void SeqLockReader::SetBackoff(const SeqLockBackoff& backoff) noexcept
+    {
+        g_reader_backoff = backoff;
+    }
+
+    const SeqLockBackoff& SeqLockReader::GetBackoff() noexcept
+    {
+        return g_reader_backoff;
+    }
+
+} // namespace registry
+} // namespace com
+} // namespace lap
@@ -13,13 +13,17 @@
 
 #include "ComTypes.hpp"
 #include "SharedMemoryRegistry.hpp"
+#include <algorithm>
 #include <chrono>
 #include <cerrno>
 #include <cstring>
 #include <iostream>
+#include <thread>
+#include <linux/magic.h>
 #include <sys/syscall.h>
 #include <sys/socket.h>
 #include <sys/un.h>
+#include <sys/vfs.h>
 #include <unistd.h>
 
 // memfd_create support (Linux 3.17+)
@@ -30,6 +34,9 @@
 #ifndef MFD_ALLOW_SEALING
     #define MFD_ALLOW_SEALING 0x0002U
 #endif
+#ifndef MFD_HUGETLB
+    #define MFD_HUGETLB 0x0004U
+#endif
 
 // Fallback for old glibc (< 2.27) that lacks memfd_create()
 #if !defined(__GLIBC__) || __GLIBC__ < 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ < 27)
@@ -70,60 +77,145 @@ namespace registry
     using lap::com::ComErrc;
 
     // ========================================================================
-    // SingleRegistry Implementation
+    // RegistryMemoryOptions Implementation
     // ========================================================================
 
-    Result<void> SingleRegistry::Initialize() noexcept
+    bool RegistryMemoryOptions::Parse(const char* text, RegistryMemoryOptions& options) noexcept
     {
-        if (IsInitialized()) {
-            // Already initialized
-            return Result<void>::FromValue();  // Success
+        RegistryMemoryOptions parsed;
+        if (text == nullptr) {
+            options = parsed;
+            return true;
         }
 
-        const char* memfd_name = GetMemfdName();
+        const char* token = text;
+        while (*token != '\0') {
+            const char* end = std::strchr(token, ',');
+            const size_t len = (end != nullptr) ? static_cast<size_t>(end - token) : std::strlen(token);
+
+            auto is = [token, len](const char* name) noexcept {
+                return std::strlen(name) == len && std::strncmp(token, name, len) == 0;
+            };
+
+            if (is("hugepages")) {
+                parsed.huge_pages = true;
+            } else if (is("populate")) {
+                parsed.populate = true;
+            } else if (is("mlock")) {
+                parsed.lock = true;
+            } else if (!is("none") && len != 0) {
+                return false;
+            }
+
+            token += len;
+            if (*token == ',') {
+                ++token;
+            }
+        }
+
+        options = parsed;
+        return true;
+    }
+
+    // ========================================================================
+    // SingleRegistry Implementation
+    // ========================================================================
 
-        // Step 1: Create anonymous shared memory with memfd_create
+    Result<int> SingleRegistry::CreateMemfd(const char* name, size_t size, bool huge_pages, size_t& actual_size) noexcept
+    {
         // MFD_CLOEXEC: Close-on-exec (prevent FD leaks to child processes)
         // MFD_ALLOW_SEALING: Allow sealing to prevent resizing
-        memfd_ = memfd_create(memfd_name, MFD_CLOEXEC | MFD_ALLOW_SEALING);
-        if (memfd_ < 0) {
-            return Result<void>::FromError(MakeErrorCode(ComErrc::kInternal, 0));
+        if (huge_pages) {
+            int fd = memfd_create(name, MFD_CLOEXEC | MFD_ALLOW_SEALING | MFD_HUGETLB);
+            if (fd >= 0) {
+                // hugetlbfs reports the huge page size as block size
+                struct stat st{};
+                const size_t page = (fstat(fd, &st) == 0 && st.st_blksize > 0)
+                                        ? static_cast<size_t>(st.st_blksize) : 0;
+                const size_t rounded = (page != 0) ? (size + page - 1) / page * page : 0;
+
+                // fallocate() reserves the huge pages now: an exhausted pool fails
+                // here instead of SIGBUS on first touch
+                if (rounded != 0 &&
+                    ftruncate(fd, static_cast<off_t>(rounded)) == 0 &&
+                    fallocate(fd, 0, 0, static_cast<off_t>(rounded)) == 0) {
+                    actual_size = rounded;
+                    return Result<int>::FromValue(fd);
+                }
+                close(fd);
+            }
+            // No huge pages available - fall back to regular pages
         }
 
-        // Step 2: Set shared memory size (256KB = 1024 slots × 256 bytes)
-        if (ftruncate(memfd_, RegistryConfig::REGISTRY_SIZE) < 0) {
-            close(memfd_);
-            memfd_ = -1;
-            return Result<void>::FromError(MakeErrorCode(ComErrc::kInternal, 0));
+        int fd = memfd_create(name, MFD_CLOEXEC | MFD_ALLOW_SEALING);
+        if (fd < 0) {
+            return Result<int>::FromError(MakeErrorCode(ComErrc::kMemfdCreateFailed, errno));
         }
 
-        // Step 3: Map shared memory to process address space
-        void* addr = mmap(nullptr,
-                          RegistryConfig::REGISTRY_SIZE,
-                          PROT_READ | PROT_WRITE,
-                          MAP_SHARED,
-                          memfd_,
-                          0);
-        
+        if (ftruncate(fd, static_cast<off_t>(size)) < 0) {
+            const int err = errno;
+            close(fd);
+            return Result<int>::FromError(MakeErrorCode(ComErrc::kSharedMemoryResizeFailed, err));
+        }
+
+        actual_size = size;
+        return Result<int>::FromValue(fd);
+    }
+
+    Result<void*> SingleRegistry::MapMemfd(int fd, size_t size, const RegistryMemoryOptions& options, bool& locked) noexcept
+    {
+        const int flags = MAP_SHARED | (options.populate ? MAP_POPULATE : 0);
+        void* addr = mmap(nullptr, size, PROT_READ | PROT_WRITE, flags, fd, 0);
         if (addr == MAP_FAILED) {
-            close(memfd_);
-            memfd_ = -1;
-            return Result<void>::FromError(MakeErrorCode(ComErrc::kInternal, 0));
+            return Result<void*>::FromError(MakeErrorCode(ComErrc::kSharedMemoryMappingFailed, errno));
         }
 
-        slots_ = static_cast<ServiceSlot*>(addr);
+        // mlock() failure (RLIMIT_MEMLOCK, missing CAP_IPC_LOCK) is not fatal
+        locked = options.lock && mlock(addr, size) == 0;
 
-        // Step 4: Initialize all slots to IDLE state (first-time initialization only)
-        // Check if slot 1 is already initialized (as a sentinel)
-        if (slots_[1].sequence.load(std::memory_order_relaxed) == 0 &&
-            slots_[1].service_id == 0) {
-            // First-time initialization
-            for (uint32_t i = 0; i < RegistryConfig::MAX_SLOTS; ++i) {
-                slots_[i] = ServiceSlot();  // Reset to default state
-            }
+        return Result<void*>::FromValue(addr);
+    }
+
+    bool SingleRegistry::IsHugePageBacked() const noexcept
+    {
+        struct statfs fs{};
+        return memfd_ >= 0 &&
+               fstatfs(memfd_, &fs) == 0 &&
+               static_cast<unsigned long>(fs.f_type) == HUGETLBFS_MAGIC;
+    }
+
+    Result<void> SingleRegistry::Initialize(uint32_t slot_count) noexcept
+    {
+        if (IsInitialized()) {
+            // Already initialized
+            return Result<void>::FromValue();  // Success
+        }
+
+        if (slot_count < 2 || slot_count > RegistryConfig::MAX_SLOTS_LIMIT) {
+            return Result<void>::FromError(MakeErrorCode(ComErrc::kInvalidArgument, 0));
+        }
+
+        const char* memfd_name = GetMemfdName();
+
+        // Step 1-2: Create anonymous shared memory with memfd_create and size it
+        // (header + tag table + slot_count × 256 bytes, rounded up for huge pages)
+        size_t memfd_size = 0;
+        auto fd_result = CreateMemfd(memfd_name, RegistryLayout::TotalSize(slot_count),
+                                     memory_options_.huge_pages, memfd_size);
+        if (!fd_result.HasValue()) {
+            return Result<void>::FromError(MakeErrorCode(ComErrc::kInternal, 0));
+        }
+        memfd_ = fd_result.Value();
+
+        // Step 3: Map shared memory and format header, tag table and slots
+        auto map_result = mapRegistry(memfd_size, slot_count);
+        if (!map_result.HasValue()) {
+            close(memfd_);
+            memfd_ = -1;
+            return map_result;
         }
 
-        // Step 5: Seal the memory to prevent resizing (security hardening)
+        // Step 4: Seal the memory to prevent resizing (security hardening)
         // F_SEAL_SHRINK: Prevent shrinking
         // F_SEAL_GROW: Prevent growing
         // F_SEAL_SEAL: Prevent removing seals
@@ -147,26 +239,85 @@ namespace registry
             return Result<void>::FromError(fd_result.Error());
         }
 
-        memfd_ = fd_result.Value();
+        // Step 2: Map the whole memfd (size is defined by the server)
+        // Note: No slot initialization needed - server already initialized
+        // Note: No sealing needed - server already sealed
+        return attachMemfd(fd_result.Value());
+    }
 
-        // Step 2: Map shared memory to process address space
-        void* addr = mmap(nullptr,
-                          RegistryConfig::REGISTRY_SIZE,
-                          PROT_READ | PROT_WRITE,
-                          MAP_SHARED,
-                          memfd_,
-                          0);
-        
-        if (addr == MAP_FAILED) {
+    Result<void> SingleRegistry::InitializeFromFd(int memfd) noexcept
+    {
+        if (IsInitialized()) {
+            return Result<void>::FromValue();
+        }
+
+        int fd = fcntl(memfd, F_DUPFD_CLOEXEC, 0);
+        if (fd < 0) {
+            return Result<void>::FromError(MakeErrorCode(ComErrc::kInvalidArgument, errno));
+        }
+
+        return attachMemfd(fd);
+    }
+
+    Result<void> SingleRegistry::attachMemfd(int fd) noexcept
+    {
+        memfd_ = fd;
+
+        struct stat st{};
+        if (fstat(memfd_, &st) != 0) {
             close(memfd_);
             memfd_ = -1;
-            return Result<void>::FromError(MakeErrorCode(ComErrc::kSharedMemoryMappingFailed, 0));
+            return Result<void>::FromError(MakeErrorCode(ComErrc::kSharedMemoryMappingFailed, errno));
         }
 
-        slots_ = static_cast<ServiceSlot*>(addr);
+        auto map_result = mapRegistry(static_cast<size_t>(st.st_size), 0);
+        if (!map_result.HasValue()) {
+            close(memfd_);
+            memfd_ = -1;
+            return map_result;
+        }
+
+        return Result<void>::FromValue();
+    }
+
+    Result<void> SingleRegistry::mapRegistry(size_t size, uint32_t format_slots) noexcept
+    {
+        if (size < RegistryLayout::HEADER_REGION_SIZE) {
+            return Result<void>::FromError(MakeErrorCode(ComErrc::kRegistryLayoutMismatch, 0));
+        }
+
+        bool locked = false;
+        auto addr_result = MapMemfd(memfd_, size, memory_options_, locked);
+        if (!addr_result.HasValue()) {
+            return Result<void>::FromError(addr_result.Error());
+        }
+        void* addr = addr_result.Value();
+
+        if (format_slots != 0) {
+            RegistryLayout::Format(addr, format_slots, RegistryConfig::MAX_PROBE_STEPS);
+        }
+
+        // Reject registries formatted by an incompatible (or no) layout
+        const RegistryHeader* header = RegistryLayout::Header(addr);
+        if (!header->IsValid() ||
+            header->max_probe_steps == 0 ||
+            RegistryLayout::TotalSize(header->slot_count) > size) {
+            munmap(addr, size);
+            return Result<void>::FromError(MakeErrorCode(ComErrc::kRegistryLayoutMismatch, 0));
+        }
+
+        base_ = addr;
+        mapped_size_ = size;
+        memory_locked_ = locked;
+        slot_count_ = header->slot_count;
+        max_probe_steps_ = std::min(header->max_probe_steps, slot_count_ - 1);
+        header_ = RegistryLayout::Header(addr);
+        stats_ = &RegistryLayout::Stats(addr)[RegistryLayout::StatsShardOf(getpid())];
+        tags_ = RegistryLayout::Tags(addr);
+        chains_ = RegistryLayout::Chains(addr, slot_count_);
+        index_ = RegistryLayout::Index(addr, slot_count_);
+        slots_ = RegistryLayout::Slots(addr, slot_count_);
 
-        // Note: No slot initialization needed - server already initialized
-        // Note: No sealing needed - server already sealed
         return Result<void>::FromValue();
     }
 
@@ -225,9 +376,19 @@ namespace registry
 
     void SingleRegistry::Cleanup() noexcept
     {
-        if (slots_ != nullptr) {
-            munmap(slots_, RegistryConfig::REGISTRY_SIZE);
+        if (base_ != nullptr) {
+            munmap(base_, mapped_size_);
+            base_ = nullptr;
+            mapped_size_ = 0;
+            header_ = nullptr;
+            stats_ = nullptr;
+            tags_ = nullptr;
+            chains_ = nullptr;
+            index_ = nullptr;
             slots_ = nullptr;
+            slot_count_ = 0;
+            max_probe_steps_ = 0;
+            memory_locked_ = false;
         }
 
         if (memfd_ >= 0) {
@@ -244,7 +405,8 @@ namespace registry
         uint32_t major_version,
         uint32_t minor_version,
         const char* binding_type,
-        const char* endpoint) noexcept
+        const char* endpoint,
+        uint32_t heartbeat_interval_ms) noexcept
     {
         if (!IsInitialized()) {
             return Result<void>::FromError(MakeErrorCode(ComErrc::kNotInitialized, 0));
@@ -254,260 +416,1464 @@ namespace registry
             return Result<void>::FromError(MakeErrorCode(ComErrc::kInvalidArgument, 0));
         }
 
-        ServiceSlot& slot = slots_[slot_index];
+        const uint64_t hash = HashServiceId(service_id);
+        RegistryWriteGuard guard(*header_, stats_);
+        if (!guard.IsLocked()) {
+            return Result<void>::FromError(MakeErrorCode(ComErrc::kRegistryLayoutMismatch, 0));
+        }
+        if (guard.Recovered()) {
+            recoverStructure();
+        }
+        if (IsRetired()) {
+            return Result<void>::FromError(MakeErrorCode(ComErrc::kRegistryRetired, 0));
+        }
 
-        // Check if slot is already occupied
-        if (slot.IsActive()) {
+        // Claim the slot through its tag (fails if another service holds it)
+        if (tags_[slot_index].load(std::memory_order_relaxed) >= SlotTag::MIN_LIVE) {
             return Result<void>::FromError(MakeErrorCode(ComErrc::kServiceNotOffered, 0));
         }
 
-        // Write service information with seqlock protection
-        {
-            SeqLockWriter writer(slot.sequence);
-            
-            slot.service_id = service_id;
-            slot.instance_id = instance_id;
-            slot.major_version = major_version;
-            slot.minor_version = minor_version;
-            
-            // Copy binding type (max 15 chars + null terminator)
-            std::strncpy(slot.binding_type, binding_type, sizeof(slot.binding_type) - 1);
-            slot.binding_type[sizeof(slot.binding_type) - 1] = '\0';
-            
-            // Copy endpoint (max 79 chars + null terminator)
-            std::strncpy(slot.endpoint, endpoint, sizeof(slot.endpoint) - 1);
-            slot.endpoint[sizeof(slot.endpoint) - 1] = '\0';
-            
-            // Set initial heartbeat
-            auto now = steady_clock::now();
-            slot.last_heartbeat_ns = duration_cast<nanoseconds>(now.time_since_epoch()).count();
-            slot.heartbeat_interval_ms = 100;  // Default: 100ms
-            
-            slot.owner_pid = getpid();
-            slot.status = static_cast<uint32_t>(SlotStatus::ACTIVE);
+        // Lookups only probe max_probe_steps_ slots from the home slot
+        const uint32_t step = ProbeStep(hash, slot_index);
+        if (step >= max_probe_steps_) {
+            return Result<void>::FromError(MakeErrorCode(ComErrc::kSlotIndexInvalid, 0));
         }
 
-        return Result<void>::FromValue();
-    }
-
-    Result<void> SingleRegistry::UnregisterService(uint32_t slot_index) noexcept
-    {
-        if (!IsInitialized()) {
-            return Result<void>::FromError(MakeErrorCode(ComErrc::kNotInitialized, 0));
+        ChainPosition position = locateChainPosition(hash, service_id, instance_id, step);
+        if (position.duplicate) {
+            return Result<void>::FromError(MakeErrorCode(ComErrc::kSlotAlreadyReserved, 0));
         }
 
-        if (!IsValidSlotIndex(slot_index)) {
-            return Result<void>::FromError(MakeErrorCode(ComErrc::kInvalidArgument, 0));
+        // An EMPTY slot in front of slot_index would end the probe sequence
+        // before it: turn the gap into tombstones (never reverted to EMPTY)
+        guard.MarkModified();
+        for (uint32_t gap = 0; gap < step; ++gap) {
+            std::atomic<uint8_t>& tag = tags_[ProbeIndex(hash, gap)];
+            if (tag.load(std::memory_order_relaxed) == SlotTag::EMPTY) {
+                tag.store(SlotTag::TOMBSTONE, std::memory_order_release);
+            }
         }
+        position = locateChainPosition(hash, service_id, instance_id, step);
 
-        ServiceSlot& slot = slots_[slot_index];
-
-        // Reset slot with seqlock protection
-        {
-            SeqLockWriter writer(slot.sequence);
-            slot.Reset();
-        }
+        publishSlot(slot_index, TagOf(hash), position, service_id, instance_id,
+                    major_version, minor_version, binding_type, endpoint,
+                    heartbeat_interval_ms != 0 ? heartbeat_interval_ms : GetDefaultHeartbeatIntervalMs());
+        stats_->registrations.fetch_add(1, std::memory_order_relaxed);
 
         return Result<void>::FromValue();
     }
 
-    Optional<ServiceSlot> SingleRegistry::FindService(uint64_t service_id) const noexcept
+    Result<uint32_t> SingleRegistry::RegisterService(
+        uint64_t service_id,
+        uint64_t instance_id,
+        uint32_t major_version,
+        uint32_t minor_version,
+        const char* binding_type,
+        const char* endpoint,
+        uint32_t heartbeat_interval_ms) noexcept
     {
         if (!IsInitialized()) {
-            return Optional<ServiceSlot>{};
+            return Result<uint32_t>::FromError(MakeErrorCode(ComErrc::kNotInitialized, 0));
         }
 
-        // Calculate slot index using fixed mapping
-        uint32_t slot_index = static_cast<uint32_t>(service_id & 1023);
-        
-        if (!IsValidSlotIndex(slot_index)) {
-            return Optional<ServiceSlot>{};
+        const uint64_t hash = HashServiceId(service_id);
+        RegistryWriteGuard guard(*header_, stats_);
+        if (!guard.IsLocked()) {
+            return Result<uint32_t>::FromError(MakeErrorCode(ComErrc::kRegistryLayoutMismatch, 0));
+        }
+        if (guard.Recovered()) {
+            recoverStructure();
+        }
+        if (IsRetired()) {
+            return Result<uint32_t>::FromError(MakeErrorCode(ComErrc::kRegistryRetired, 0));
         }
 
-        const ServiceSlot& slot = slots_[slot_index];
-
-        // Use seqlock to read slot atomically
-        auto opt_slot = SeqLockReader::Read(slot, [service_id](const ServiceSlot& s) {
-            // Verify service ID matches and slot is active
-            if (s.service_id == service_id && s.IsActive()) {
-                return s;  // Return the slot
+        // First EMPTY or TOMBSTONE slot of the probe sequence
+        uint32_t candidate_step = max_probe_steps_;
+        for (uint32_t step = 0; step < max_probe_steps_; ++step) {
+            if (tags_[ProbeIndex(hash, step)].load(std::memory_order_relaxed) < SlotTag::MIN_LIVE) {
+                candidate_step = step;
+                break;
             }
-            return ServiceSlot{};  // Return empty slot (service_id == 0)
-        });
+        }
 
-        // Filter out empty slots (service_id == 0 means not found)
-        if (opt_slot.has_value() && opt_slot.value().service_id == 0) {
-            return Optional<ServiceSlot>{};
+        if (candidate_step == max_probe_steps_) {
+            // Probe window exhausted
+            return Result<uint32_t>::FromError(MakeErrorCode(ComErrc::kSlotConflict, 0));
         }
 
-        return opt_slot;
+        ChainPosition position = locateChainPosition(hash, service_id, instance_id, candidate_step);
+        if (position.duplicate) {
+            return Result<uint32_t>::FromError(MakeErrorCode(ComErrc::kSlotAlreadyReserved, 0));
+        }
+
+        const uint32_t candidate = ProbeIndex(hash, candidate_step);
+        publishSlot(candidate, TagOf(hash), position, service_id, instance_id,
+                    major_version, minor_version, binding_type, endpoint,
+                    heartbeat_interval_ms != 0 ? heartbeat_interval_ms : GetDefaultHeartbeatIntervalMs());
+        guard.MarkModified();
+        stats_->registrations.fetch_add(1, std::memory_order_relaxed);
+
+        return Result<uint32_t>::FromValue(candidate);
     }
 
-    Optional<ServiceSlot> SingleRegistry::ReadSlot(uint32_t slot_index) const noexcept
+    SingleRegistry::ChainPosition SingleRegistry::locateChainPosition(
+        uint64_t hash,
+        uint64_t service_id,
+        uint64_t instance_id,
+        uint32_t target_step) const noexcept
     {
-        if (!IsInitialized() || !IsValidSlotIndex(slot_index)) {
-            return Optional<ServiceSlot>{};
+        const uint8_t tag = TagOf(hash);
+        ChainPosition position{CHAIN_END, CHAIN_END, false};
+
+        // Chains are kept in probe order, so the neighbours are the closest
+        // instances before and after target_step
+        for (uint32_t step = 0; step < max_probe_steps_; ++step) {
+            uint32_t index = ProbeIndex(hash, step);
+            uint8_t current = tags_[index].load(std::memory_order_relaxed);
+
+            if (current == SlotTag::EMPTY) {
+                break;  // End of probe sequence
+            }
+            if (current != tag) {
+                continue;
+            }
+
+            const ServiceIndexEntry& entry = index_[index];
+            if (entry.service_id != service_id || !entry.IsActive()) {
+                continue;
+            }
+
+            if (entry.instance_id == instance_id) {
+                position.duplicate = true;
+            }
+            if (step < target_step) {
+                position.prev = index;
+            } else if (step > target_step && position.next == CHAIN_END) {
+                position.next = index;
+            }
         }
 
-        const ServiceSlot& slot = slots_[slot_index];
-        return SeqLockReader::ReadSlot(slot);
+        return position;
     }
 
-    Result<void> SingleRegistry::UpdateHeartbeat(uint32_t slot_index, uint64_t timestamp_ns) noexcept
+    void SingleRegistry::publishSlot(
+        uint32_t slot_index,
+        uint8_t tag,
+        const ChainPosition& position,
+        uint64_t service_id,
+        uint64_t instance_id,
+        uint32_t major_version,
+        uint32_t minor_version,
+        const char* binding_type,
+        const char* endpoint,
+        uint32_t heartbeat_interval_ms) noexcept
     {
-        if (!IsInitialized()) {
-            return Result<void>::FromError(MakeErrorCode(ComErrc::kNotInitialized, 0));
-        }
+        chains_[slot_index].store(position.next, std::memory_order_relaxed);
 
-        if (!IsValidSlotIndex(slot_index)) {
-            return Result<void>::FromError(MakeErrorCode(ComErrc::kInvalidArgument, 0));
-        }
+        writeSlot(slot_index, service_id, instance_id, major_version, minor_version,
+                  binding_type, endpoint, heartbeat_interval_ms);
 
-        ServiceSlot& slot = slots_[slot_index];
+        tags_[slot_index].store(tag, std::memory_order_release);
 
-        // Update heartbeat with seqlock protection
-        {
-            SeqLockWriter writer(slot.sequence);
-            slot.last_heartbeat_ns = timestamp_ns;
+        if (position.prev != CHAIN_END) {
+            chains_[position.prev].store(slot_index, std::memory_order_release);
         }
-
-        return Result<void>::FromValue();
     }
 
-    // ========================================================================
-    // SharedMemoryRegistry Implementation
-    // ========================================================================
-
-    Result<void> SharedMemoryRegistry::Initialize() noexcept
+    void SingleRegistry::unlinkSlot(uint32_t slot_index, uint64_t service_id) noexcept
     {
-        // Initialize QM registry (QM + ASIL-A/B services)
-        auto qm_result = qm_registry_.Initialize();
-        if (qm_result.HasValue() == false) {
-            return qm_result;
-        }
+        const uint64_t hash = HashServiceId(service_id);
+        const uint8_t tag = TagOf(hash);
 
-        // Initialize ASIL registry (ASIL-C/D services)
-        auto asil_result = asil_registry_.Initialize();
-        if (asil_result.HasValue() == false) {
-            return asil_result;
+        for (uint32_t step = 0; step < max_probe_steps_; ++step) {
+            uint32_t index = ProbeIndex(hash, step);
+            uint8_t current = tags_[index].load(std::memory_order_relaxed);
+
+            if (current == SlotTag::EMPTY) {
+                break;  // End of probe sequence
+            }
+            if (current == tag && index != slot_index &&
+                chains_[index].load(std::memory_order_relaxed) == slot_index) {
+                chains_[index].store(chains_[slot_index].load(std::memory_order_relaxed),
+                                     std::memory_order_release);
+                break;
+            }
         }
 
-        return Result<void>::FromValue();
+        chains_[slot_index].store(CHAIN_END, std::memory_order_release);
     }
 
-    Result<void> SharedMemoryRegistry::InitializeFromSocket(
-        const String& qm_socket_path,
-        const String& asil_socket_path) noexcept
+    void SingleRegistry::recoverStructure() noexcept
     {
-        // Initialize QM registry from systemd socket
-        auto qm_result = qm_registry_.InitializeFromSocket(qm_socket_path);
-        if (!qm_result.HasValue()) {
-            return qm_result;
-        }
+        // Slots the dead writer was filling or clearing: its SeqLockWriter left
+        // a sequence odd, or the tag, index entry and slot disagree
+        for (uint32_t index = 1; index < slot_count_; ++index) {
+            ServiceSlot& slot = slots_[index];
+            ServiceIndexEntry& entry = index_[index];
+            bool torn = false;
+            if ((slot.sequence.load(std::memory_order_relaxed) & 1) != 0) {
+                slot.sequence.fetch_add(1, std::memory_order_release);
+                torn = true;
+            }
+            if ((entry.sequence.load(std::memory_order_relaxed) & 1) != 0) {
+                entry.sequence.fetch_add(1, std::memory_order_release);
+                torn = true;
+            }
 
-        // Initialize ASIL registry from systemd socket
-        auto asil_result = asil_registry_.InitializeFromSocket(asil_socket_path);
-        if (!asil_result.HasValue()) {
-            return asil_result;
+            const uint8_t tag = tags_[index].load(std::memory_order_relaxed);
+            const bool live = tag >= SlotTag::MIN_LIVE;
+            if (!torn && live == entry.IsActive() && entry.IsActive() == slot.IsActive() &&
+                (!live || tag == TagOf(HashServiceId(entry.service_id)))) {
+                continue;
+            }
+
+            {
+                SeqLockWriter writer(entry.sequence);
+                entry.Reset();
+            }
+            {
+                SeqLockWriter writer(slot.sequence);
+                slot.Reset();
+            }
+            if (live) {
+                tags_[index].store(SlotTag::TOMBSTONE, std::memory_order_release);
+            }
         }
 
-        return Result<void>::FromValue();
+        // Chains may be half linked: rebuild them, each instance pointing at the
+        // next active instance of its service in probe order
+        for (uint32_t index = 0; index < slot_count_; ++index) {
+            chains_[index].store(CHAIN_END, std::memory_order_relaxed);
+        }
+        for (uint32_t index = 1; index < slot_count_; ++index) {
+            const uint8_t tag = tags_[index].load(std::memory_order_relaxed);
+            if (tag < SlotTag::MIN_LIVE) {
+                continue;
+            }
+            const uint64_t service_id = index_[index].service_id;
+            const uint64_t hash = HashServiceId(service_id);
+            for (uint32_t step = ProbeStep(hash, index) + 1; step < max_probe_steps_; ++step) {
+                const uint32_t next = ProbeIndex(hash, step);
+                const uint8_t current = tags_[next].load(std::memory_order_relaxed);
+                if (current == SlotTag::EMPTY) {
+                    break;
+                }
+                if (current == tag && index_[next].service_id == service_id && index_[next].IsActive()) {
+                    chains_[index].store(next, std::memory_order_release);
+                    break;
+                }
+            }
+        }
     }
 
-
-    Result<void> SharedMemoryRegistry::RegisterService(
+    void SingleRegistry::writeSlot(
+        uint32_t slot_index,
         uint64_t service_id,
         uint64_t instance_id,
         uint32_t major_version,
         uint32_t minor_version,
         const char* binding_type,
-        const char* endpoint) noexcept
+        const char* endpoint,
+        uint32_t heartbeat_interval_ms) noexcept
     {
-        // Calculate slot index
-        uint32_t slot_index = CalculateSlot(service_id);
-        if (slot_index == 0) {
-            return Result<void>::FromError(MakeErrorCode(ComErrc::kInvalidArgument, 0));
-        }
-
-        // Select registry based on service ID
-        RegistryType reg_type = SelectRegistry(service_id);
+        ServiceSlot& slot = slots_[slot_index];
 
-        if (reg_type == RegistryType::BOTH) {
-            // Broadcast service: register in both QM and ASIL registries
-            auto qm_result = qm_registry_.RegisterService(
-                slot_index, service_id, instance_id, 
-                major_version, minor_version, binding_type, endpoint);
-            
-            auto asil_result = asil_registry_.RegisterService(
-                slot_index, service_id, instance_id, 
-                major_version, minor_version, binding_type, endpoint);
-            
-            // Return first error if any
-            if (qm_result.HasValue() == false) {
-                return qm_result;
-            }
-            return asil_result;
-        } else if (reg_type == RegistryType::ASIL) {
-            // ASIL-C/D service
-            return asil_registry_.RegisterService(
-                slot_index, service_id, instance_id, 
-                major_version, minor_version, binding_type, endpoint);
-        } else {
-            // QM + ASIL-A/B service
-            return qm_registry_.RegisterService(
-                slot_index, service_id, instance_id, 
-                major_version, minor_version, binding_type, endpoint);
-        }
+        // Write service information with seqlock protection
+        SeqLockWriter writer(slot.sequence);
+        
+        slot.service_id = service_id;
+        slot.instance_id = instance_id;
+        slot.major_version = major_version;
+        slot.minor_version = minor_version;
+        
+        // Copy binding type (max 15 chars + null terminator)
+        std::strncpy(slot.binding_type, binding_type, sizeof(slot.binding_type) - 1);
+        slot.binding_type[sizeof(slot.binding_type) - 1] = '\0';
+        
+        // Copy endpoint (max 79 chars + null terminator)
+        std::strncpy(slot.endpoint, endpoint, sizeof(slot.endpoint) - 1);
+        slot.endpoint[sizeof(slot.endpoint) - 1] = '\0';
+        EndpointAddress::Parse(slot.endpoint, slot.endpoint_address);  // NONE if unknown scheme
+        
+        // Set initial heartbeat
+        auto now = steady_clock::now();
+        slot.last_heartbeat_ns = duration_cast<nanoseconds>(now.time_since_epoch()).count();
+        slot.heartbeat_interval_ms = heartbeat_interval_ms;
+        
+        slot.owner_pid = getpid();
+        slot.status = static_cast<uint32_t>(SlotStatus::ACTIVE);
+
+        // Mirror hot fields into the index entry (one cache line for lookups)
+        ServiceIndexEntry& entry = index_[slot_index];
+        SeqLockWriter index_writer(entry.sequence);
+
+        entry.service_id = service_id;
+        entry.instance_id = instance_id;
+        entry.last_heartbeat_ns.store(slot.last_heartbeat_ns, std::memory_order_relaxed);
+        entry.major_version = major_version;
+        entry.minor_version = minor_version;
+        entry.heartbeat_interval_ms = slot.heartbeat_interval_ms;
+        entry.owner_pid = slot.owner_pid;
+        entry.status = slot.status;
     }
 
-    Result<void> SharedMemoryRegistry::UnregisterService(uint64_t service_id) noexcept
+    Result<void> SingleRegistry::UnregisterService(uint32_t slot_index) noexcept
     {
-        uint32_t slot_index = CalculateSlot(service_id);
-        if (slot_index == 0) {
-            return Result<void>::FromError(MakeErrorCode(ComErrc::kInvalidArgument, 0));
+        if (!IsInitialized()) {
+            return Result<void>::FromError(MakeErrorCode(ComErrc::kNotInitialized, 0));
         }
 
-        RegistryType reg_type = SelectRegistry(service_id);
+        if (!IsValidSlotIndex(slot_index)) {
+            return Result<void>::FromError(MakeErrorCode(ComErrc::kInvalidArgument, 0));
+        }
 
-        if (reg_type == RegistryType::BOTH) {
-            qm_registry_.UnregisterService(slot_index);
-            return asil_registry_.UnregisterService(slot_index);
-        } else if (reg_type == RegistryType::ASIL) {
-            return asil_registry_.UnregisterService(slot_index);
-        } else {
-            return qm_registry_.UnregisterService(slot_index);
+        RegistryWriteGuard guard(*header_, stats_);
+        if (!guard.IsLocked()) {
+            return Result<void>::FromError(MakeErrorCode(ComErrc::kRegistryLayoutMismatch, 0));
+        }
+        if (guard.Recovered()) {
+            recoverStructure();
         }
+        if (IsRetired()) {
+            return Result<void>::FromError(MakeErrorCode(ComErrc::kRegistryRetired, 0));
+        }
+        if (releaseSlot(slot_index)) {
+            guard.MarkModified();
+        }
+        stats_->unregistrations.fetch_add(1, std::memory_order_relaxed);
+
+        return Result<void>::FromValue();
     }
 
-    Optional<ServiceSlot> SharedMemoryRegistry::FindService(uint64_t service_id) const noexcept
+    Result<void> SingleRegistry::ReclaimSlot(uint32_t slot_index, pid_t owner_pid) noexcept
     {
+        if (!IsInitialized()) {
+            return Result<void>::FromError(MakeErrorCode(ComErrc::kNotInitialized, 0));
+        }
+
+        if (!IsValidSlotIndex(slot_index)) {
+            return Result<void>::FromError(MakeErrorCode(ComErrc::kInvalidArgument, 0));
+        }
+
+        RegistryWriteGuard guard(*header_, stats_);
+        if (!guard.IsLocked()) {
+            return Result<void>::FromError(MakeErrorCode(ComErrc::kRegistryLayoutMismatch, 0));
+        }
+        if (guard.Recovered()) {
+            recoverStructure();
+        }
+        if (IsRetired()) {
+            return Result<void>::FromError(MakeErrorCode(ComErrc::kRegistryRetired, 0));
+        }
+
+        // The slot may have been released and re-registered by a live process
+        const ServiceIndexEntry& entry = index_[slot_index];
+        if (!entry.IsActive() || entry.owner_pid != owner_pid) {
+            return Result<void>::FromError(MakeErrorCode(ComErrc::kServiceNotAvailable, 0));
+        }
+
+        releaseSlot(slot_index);
+        guard.MarkModified();
+        stats_->reclaims.fetch_add(1, std::memory_order_relaxed);
+
+        return Result<void>::FromValue();
+    }
+
+    bool SingleRegistry::releaseSlot(uint32_t slot_index) noexcept
+    {
+        ServiceSlot& slot = slots_[slot_index];
+        ServiceIndexEntry& entry = index_[slot_index];
+
+        uint8_t current = tags_[slot_index].load(std::memory_order_relaxed);
+        if (!entry.IsActive() && !slot.IsActive() && current < SlotTag::MIN_LIVE) {
+            return false;  // Already free: nothing to change
+        }
+
+        if (entry.IsActive()) {
+            unlinkSlot(slot_index, entry.service_id);
+        }
+
+        // Reset index entry first so lookups stop matching, then the slot
+        {
+            SeqLockWriter writer(entry.sequence);
+            entry.Reset();
+        }
+        {
+            SeqLockWriter writer(slot.sequence);
+            slot.Reset();
+        }
+
+        // Keep probe sequences through this slot intact (never revert to EMPTY)
+        if (current >= SlotTag::MIN_LIVE) {
+            tags_[slot_index].store(SlotTag::TOMBSTONE, std::memory_order_release);
+        }
+        return true;
+    }
+
+    Result<uint32_t> SingleRegistry::MigrateTo(SingleRegistry& successor) noexcept
+    {
+        if (!IsInitialized() || !successor.IsInitialized()) {
+            return Result<uint32_t>::FromError(MakeErrorCode(ComErrc::kNotInitialized, 0));
+        }
+
+        if (&successor == this || successor.slot_count_ < slot_count_) {
+            return Result<uint32_t>::FromError(MakeErrorCode(ComErrc::kInvalidArgument, 0));
+        }
+
+        // Block all writers of this registry until it is retired
+        RegistryWriteGuard guard(*header_, stats_);
+        if (!guard.IsLocked()) {
+            return Result<uint32_t>::FromError(MakeErrorCode(ComErrc::kRegistryLayoutMismatch, 0));
+        }
+        if (guard.Recovered()) {
+            recoverStructure();
+        }
+        if (IsRetired()) {
+            return Result<uint32_t>::FromError(MakeErrorCode(ComErrc::kRegistryRetired, 0));
+        }
+
+        uint32_t migrated = 0;
+        {
+            RegistryWriteGuard successor_guard(*successor.header_, stats_);
+            if (!successor_guard.IsLocked()) {
+                return Result<uint32_t>::FromError(MakeErrorCode(ComErrc::kRegistryLayoutMismatch, 0));
+            }
+            if (successor_guard.Recovered()) {
+                successor.recoverStructure();
+            }
+            successor_guard.MarkModified();
+
+            for (uint32_t index = 1; index < slot_count_; ++index) {
+                if (tags_[index].load(std::memory_order_relaxed) < SlotTag::MIN_LIVE ||
+                    !index_[index].IsActive()) {
+                    continue;
+                }
+                if (!successor.importSlot(index_[index], slots_[index])) {
+                    // Successor is discarded by the caller; this registry stays current
+                    return Result<uint32_t>::FromError(MakeErrorCode(ComErrc::kSlotConflict, 0));
+                }
+                ++migrated;
+            }
+
+            successor.header_->epoch = header_->epoch + 1;
+
+            // Counters continue in the successor (observers see monotonic totals)
+            const RegistryStatsShard* source = RegistryLayout::Stats(base_);
+            RegistryStatsShard* target = RegistryLayout::Stats(successor.base_);
+            for (uint32_t shard = 0; shard < RegistryLayout::STATS_SHARDS; ++shard) {
+                auto carry = [](const std::atomic<uint64_t>& from, std::atomic<uint64_t>& to) {
+                    to.fetch_add(from.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                };
+                carry(source[shard].registrations, target[shard].registrations);
+                carry(source[shard].unregistrations, target[shard].unregistrations);
+                carry(source[shard].reclaims, target[shard].reclaims);
+                carry(source[shard].heartbeats, target[shard].heartbeats);
+                carry(source[shard].reader_retries, target[shard].reader_retries);
+                carry(source[shard].reader_failures, target[shard].reader_failures);
+                carry(source[shard].writer_waits, target[shard].writer_waits);
+                target[shard].max_retry_streak.store(
+                    std::max(source[shard].max_retry_streak.load(std::memory_order_relaxed),
+                             target[shard].max_retry_streak.load(std::memory_order_relaxed)),
+                    std::memory_order_relaxed);
+            }
+        }
+
+        header_->successor_slot_count.store(successor.slot_count_, std::memory_order_release);
+        guard.MarkModified();
+
+        return Result<uint32_t>::FromValue(migrated);
+    }
+
+    bool SingleRegistry::importSlot(const ServiceIndexEntry& entry, const ServiceSlot& slot) noexcept
+    {
+        const uint64_t hash = HashServiceId(entry.service_id);
+
+        uint32_t candidate_step = max_probe_steps_;
+        for (uint32_t step = 0; step < max_probe_steps_; ++step) {
+            if (tags_[ProbeIndex(hash, step)].load(std::memory_order_relaxed) < SlotTag::MIN_LIVE) {
+                candidate_step = step;
+                break;
+            }
+        }
+
+        if (candidate_step == max_probe_steps_) {
+            return false;
+        }
+
+        ChainPosition position = locateChainPosition(hash, entry.service_id, entry.instance_id, candidate_step);
+        if (position.duplicate) {
+            return true;  // Same instance listed twice in a torn registry: keep one
+        }
+
+        const uint32_t candidate = ProbeIndex(hash, candidate_step);
+        publishSlot(candidate, TagOf(hash), position, entry.service_id, entry.instance_id,
+                    entry.major_version, entry.minor_version, slot.binding_type, slot.endpoint,
+                    entry.heartbeat_interval_ms);
+
+        // publishSlot() stamps the caller as owner; restore the original owner.
+        // No client maps the successor yet, so nobody observes the interim values.
+        ServiceSlot& target = slots_[candidate];
+        {
+            SeqLockWriter writer(target.sequence);
+            target.last_heartbeat_ns = slot.last_heartbeat_ns;
+            target.owner_pid = slot.owner_pid;
+            std::memcpy(target.metadata, slot.metadata, sizeof(target.metadata));
+        }
+
+        ServiceIndexEntry& target_entry = index_[candidate];
+        {
+            SeqLockWriter writer(target_entry.sequence);
+            target_entry.owner_pid = entry.owner_pid;
+        }
+        target_entry.last_heartbeat_ns.store(entry.last_heartbeat_ns.load(std::memory_order_acquire),
+                                             std::memory_order_release);
+
+        return true;
+    }
+
+    uint32_t SingleRegistry::probeActiveSlot(
+        uint64_t service_id, uint64_t instance_id, bool any_instance, uint64_t now_ns,
+        bool* contended) const noexcept
+    {
+        const uint64_t hash = HashServiceId(service_id);
+        const uint8_t tag = TagOf(hash);
+
+        for (uint32_t step = 0; step < max_probe_steps_; ++step) {
+            uint32_t index = ProbeIndex(hash, step);
+            uint8_t current = tags_[index].load(std::memory_order_acquire);
+
+            if (current == SlotTag::EMPTY) {
+                break;  // End of probe sequence
+            }
+            if (current != tag) {
+                continue;  // Tombstone or different fingerprint: skip without touching the slot
+            }
+
+            uint32_t retries = 0;
+            auto match = SeqLockReader::Read(index_[index], [&](const ServiceIndexEntry& e) {
+                return e.service_id == service_id && e.IsActive() &&
+                       (any_instance || e.instance_id == instance_id);
+            }, retries);
+            recordRead(retries, !match.has_value());
+            if (!match.has_value() && contended != nullptr) {
+                *contended = true;  // Writer held the entry for the whole backoff
+            }
+            if (match.has_value() && match.value()) {
+                // Heartbeat is an independent atomic, checked outside the seqlock read
+                const ServiceIndexEntry& entry = index_[index];
+                if (now_ns != 0 &&
+                    !IsLive(entry.last_heartbeat_ns.load(std::memory_order_acquire),
+                            entry.heartbeat_interval_ms, now_ns)) {
+                    stale_count_.fetch_add(1, std::memory_order_relaxed);
+                    continue;  // Zombie instance: try the next one of this service
+                }
+                return index;
+            }
+        }
+
+        return RegistryConfig::RESERVED_SLOT;
+    }
+
+    Optional<uint32_t> SingleRegistry::FindSlot(uint64_t service_id) const noexcept
+    {
+        if (!IsInitialized()) {
+            return Optional<uint32_t>{};
+        }
+
+        uint32_t slot_index = probeActiveSlot(service_id, 0, true);
+        if (slot_index == RegistryConfig::RESERVED_SLOT) {
+            return Optional<uint32_t>{};
+        }
+
+        return Optional<uint32_t>(slot_index);
+    }
+
+    Optional<uint32_t> SingleRegistry::FindSlot(uint64_t service_id, uint64_t instance_id) const noexcept
+    {
+        if (!IsInitialized()) {
+            return Optional<uint32_t>{};
+        }
+
+        uint32_t slot_index = probeActiveSlot(service_id, instance_id, false);
+        if (slot_index == RegistryConfig::RESERVED_SLOT) {
+            return Optional<uint32_t>{};
+        }
+
+        return Optional<uint32_t>(slot_index);
+    }
+
+    Vector<ServiceInstanceInfo> SingleRegistry::FindAllInstances(uint64_t service_id, Liveness liveness) const
+    {
+        Vector<ServiceInstanceInfo> instances;
+        if (!IsInitialized()) {
+            return instances;
+        }
+
+        const uint64_t hash = HashServiceId(service_id);
+        const uint8_t tag = TagOf(hash);
+        const uint64_t now_ns = (liveness == Liveness::LIVE_ONLY) ? MonotonicNowNs() : 0;
+        instances.reserve(8);
+
+        const SeqLockBackoff& backoff = SeqLockReader::GetBackoff();
+        uint32_t retry = 0;
+        do {
+            // Step 1: Wait for a stable structure (no register/unregister in progress)
+            uint64_t seq1 = header_->structure_sequence.load(std::memory_order_acquire);
+            if (seq1 & 1) {
+                continue;
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            // Step 2: Chain head = first instance in probe order
+            uint32_t index = CHAIN_END;
+            for (uint32_t step = 0; step < max_probe_steps_; ++step) {
+                uint32_t candidate = ProbeIndex(hash, step);
+                uint8_t current = tags_[candidate].load(std::memory_order_relaxed);
+                if (current == SlotTag::EMPTY) {
+                    break;
+                }
+                if (current == tag && index_[candidate].service_id == service_id &&
+                    index_[candidate].IsActive()) {
+                    index = candidate;
+                    break;
+                }
+            }
+
+            // Step 3: Follow the chain, copying only identity fields
+            // (hop count is bounded so a torn read can never loop forever)
+            instances.clear();
+            uint32_t stale = 0;
+            for (uint32_t hops = 0; index != CHAIN_END && index < slot_count_ && hops < slot_count_; ++hops) {
+                const ServiceIndexEntry& entry = index_[index];
+                if (now_ns == 0 ||
+                    IsLive(entry.last_heartbeat_ns.load(std::memory_order_relaxed),
+                           entry.heartbeat_interval_ms, now_ns)) {
+                    instances.push_back(ServiceInstanceInfo{
+                        entry.instance_id, index, entry.major_version, entry.minor_version, entry.owner_pid});
+                } else {
+                    ++stale;
+                }
+                index = chains_[index].load(std::memory_order_relaxed);
+            }
+
+            // Step 4: Validate the whole pass against the structure sequence
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (header_->structure_sequence.load(std::memory_order_acquire) == seq1) {
+                if (stale != 0) {
+                    stale_count_.fetch_add(stale, std::memory_order_relaxed);
+                }
+                recordRead(retry, false);
+                return instances;
+            }
+        } while (backoff.Wait(header_->structure_sequence, ++retry));
+
+        recordRead(retry, true);
+        instances.clear();
+        return instances;
+    }
+
+    Optional<ServiceSlot> SingleRegistry::FindService(uint64_t service_id, Liveness liveness) const noexcept
+    {
+        uint32_t slot_index = RegistryConfig::RESERVED_SLOT;
+        return FindService(service_id, liveness, slot_index);
+    }
+
+    Optional<ServiceSlot> SingleRegistry::FindService(
+        uint64_t service_id, Liveness liveness, uint32_t& slot_index) const noexcept
+    {
+        auto result = LookupService(service_id, liveness, slot_index);
+        if (!result.HasValue()) {
+            return Optional<ServiceSlot>{};
+        }
+        return Optional<ServiceSlot>(result.Value());
+    }
+
+    Result<ServiceSlot> SingleRegistry::LookupService(
+        uint64_t service_id, Liveness liveness, uint32_t& slot_index) const noexcept
+    {
+        slot_index = RegistryConfig::RESERVED_SLOT;
+        if (!IsInitialized()) {
+            return Result<ServiceSlot>::FromError(MakeErrorCode(ComErrc::kNotInitialized, 0));
+        }
+
+        // One clock read serves every instance probed by this lookup
+        const uint64_t now_ns = (liveness == Liveness::LIVE_ONLY) ? MonotonicNowNs() : 0;
+
+        // Probe on tags + index entries, touch the full slot only once found
+        bool contended = false;
+        const uint32_t found = probeActiveSlot(service_id, 0, true, now_ns, &contended);
+        if (found == RegistryConfig::RESERVED_SLOT) {
+            return Result<ServiceSlot>::FromError(
+                MakeErrorCode(contended ? ComErrc::kRegistryContended : ComErrc::kServiceNotAvailable, 0));
+        }
+
+        // Use seqlock to read slot atomically
+        uint32_t retries = 0;
+        auto opt_slot = SeqLockReader::Read(slots_[found], [service_id](const ServiceSlot& s) {
+            // Verify service ID matches and slot is active
+            if (s.service_id == service_id && s.IsActive()) {
+                return s;  // Return the slot
+            }
+            return ServiceSlot{};  // Return empty slot (service_id == 0)
+        }, retries);
+        recordRead(retries, !opt_slot.has_value());
+        if (!opt_slot.has_value()) {
+            return Result<ServiceSlot>::FromError(MakeErrorCode(ComErrc::kRegistryContended, 0));
+        }
+
+        // Filter out empty slots (unregistered between probe and read)
+        if (opt_slot.value().service_id == 0) {
+            return Result<ServiceSlot>::FromError(MakeErrorCode(ComErrc::kServiceNotAvailable, 0));
+        }
+
+        opt_slot.value().last_heartbeat_ns = index_[found].last_heartbeat_ns.load(std::memory_order_acquire);
+        slot_index = found;
+        return Result<ServiceSlot>::FromValue(opt_slot.value());
+    }
+
+    Optional<ServiceIndexEntry> SingleRegistry::FindServiceIndex(uint64_t service_id) const noexcept
+    {
+        if (!IsInitialized()) {
+            return Optional<ServiceIndexEntry>{};
+        }
+
+        uint32_t slot_index = probeActiveSlot(service_id, 0, true);
+        if (slot_index == RegistryConfig::RESERVED_SLOT) {
+            return Optional<ServiceIndexEntry>{};
+        }
+
+        uint32_t retries = 0;
+        auto opt_entry = SeqLockReader::ReadSlot(index_[slot_index], retries);
+        recordRead(retries, !opt_entry.has_value());
+        if (opt_entry.has_value() && opt_entry.value().service_id == service_id &&
+            opt_entry.value().IsActive()) {
+            return opt_entry;
+        }
+
+        return Optional<ServiceIndexEntry>{};
+    }
+
+    Result<uint32_t> SingleRegistry::WaitForChange(
+        uint32_t known_generation, std::chrono::milliseconds timeout) const noexcept
+    {
+        if (!IsInitialized()) {
+            return Result<uint32_t>::FromError(MakeErrorCode(ComErrc::kNotInitialized, 0));
+        }
+
+        const auto deadline = steady_clock::now() + timeout;
+
+        while (true) {
+            // A retired registry never changes again: its clients must refresh
+            if (IsRetired()) {
+                return Result<uint32_t>::FromError(MakeErrorCode(ComErrc::kRegistryRetired, 0));
+            }
+
+            uint32_t current = header_->generation.load(std::memory_order_acquire);
+            if (current != known_generation) {
+                return Result<uint32_t>::FromValue(current);
+            }
+
+            auto now = steady_clock::now();
+            if (now >= deadline) {
+                return Result<uint32_t>::FromError(MakeErrorCode(ComErrc::kTimeout, 0));
+            }
+
+            // Announce the waiter before sleeping; FUTEX_WAIT re-checks the
+            // generation atomically, so a concurrent bump is never missed
+            header_->waiters.fetch_add(1, std::memory_order_seq_cst);
+            RegistryFutex::Wait(header_->generation, known_generation, deadline - now);
+            header_->waiters.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+    Result<uint32_t> SingleRegistry::Snapshot(Vector<ServiceSlotSummary>& entries) const
+    {
+        if (!IsInitialized()) {
+            return Result<uint32_t>::FromError(MakeErrorCode(ComErrc::kNotInitialized, 0));
+        }
+
+        auto read_hot_fields = [](const ServiceIndexEntry& e) -> Optional<ServiceSlotSummary> {
+            if (!e.IsActive()) {
+                return Optional<ServiceSlotSummary>{};
+            }
+            return ServiceSlotSummary{e.service_id, e.instance_id,
+                                      e.last_heartbeat_ns.load(std::memory_order_relaxed), 0,
+                                      e.heartbeat_interval_ms, e.major_version, e.owner_pid};
+        };
+
+        uint32_t skipped = 0;
+        uint32_t retries = 0;
+        for (uint32_t block = 0; block < slot_count_; block += TagScan::BLOCK_SIZE) {
+            // Never-used and tombstoned slots are skipped without touching them
+            uint64_t live = TagScan::LiveMask(&tags_[block]) & TagScan::ValidMask(block, slot_count_);
+            if (live == 0) {
+                continue;
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            // One batched read from the first to the last live slot of the block;
+            // interleaved free entries are filtered by read_hot_fields
+            const uint32_t first = static_cast<uint32_t>(__builtin_ctzll(live));
+            const uint32_t last = 63U - static_cast<uint32_t>(__builtin_clzll(live));
+            const uint32_t run_begin = block + first;
+            skipped += SeqLockReader::ReadRange(
+                &index_[run_begin], last - first + 1, read_hot_fields,
+                [&entries, run_begin](uint32_t offset, ServiceSlotSummary&& entry) {
+                    entry.slot_index = run_begin + offset;
+                    entries.push_back(entry);
+                }, &retries);
+        }
+        recordRead(retries, skipped != 0);
+
+        return Result<uint32_t>::FromValue(skipped);
+    }
+
+    Result<uint32_t> SingleRegistry::ScanService(
+        uint64_t service_id, Vector<ServiceSlotSummary>& entries, Liveness liveness) const
+    {
+        if (!IsInitialized()) {
+            return Result<uint32_t>::FromError(MakeErrorCode(ComErrc::kNotInitialized, 0));
+        }
+
+        const uint8_t tag = TagOf(HashServiceId(service_id));
+        const uint64_t now_ns = (liveness == Liveness::LIVE_ONLY) ? MonotonicNowNs() : 0;
+        uint32_t skipped = 0;
+
+        for (uint32_t block = 0; block < slot_count_; block += TagScan::BLOCK_SIZE) {
+            uint64_t matches = TagScan::MatchMask(&tags_[block], tag) & TagScan::ValidMask(block, slot_count_);
+            if (matches == 0) {
+                continue;
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            // Tags are 8-bit fingerprints: confirm each candidate on its index entry
+            while (matches != 0) {
+                const uint32_t slot_index = block + static_cast<uint32_t>(__builtin_ctzll(matches));
+                matches &= matches - 1;
+
+                uint32_t retries = 0;
+                auto entry = SeqLockReader::Read(index_[slot_index], [service_id](const ServiceIndexEntry& e) {
+                    if (e.service_id != service_id || !e.IsActive()) {
+                        return ServiceSlotSummary{0, 0, 0, 0, 0, 0, 0};
+                    }
+                    return ServiceSlotSummary{e.service_id, e.instance_id, 0, 0,
+                                              e.heartbeat_interval_ms, e.major_version, e.owner_pid};
+                }, retries);
+                recordRead(retries, !entry.has_value());
+                if (!entry.has_value()) {
+                    ++skipped;
+                    continue;
+                }
+                ServiceSlotSummary summary = entry.value();
+                if (summary.service_id == 0) {
+                    continue;  // Fingerprint collision or released slot
+                }
+
+                summary.slot_index = slot_index;
+                summary.last_heartbeat_ns = index_[slot_index].last_heartbeat_ns.load(std::memory_order_acquire);
+                if (now_ns != 0 && !IsLive(summary.last_heartbeat_ns, summary.heartbeat_interval_ms, now_ns)) {
+                    stale_count_.fetch_add(1, std::memory_order_relaxed);
+                    continue;
+                }
+                entries.push_back(summary);
+            }
+        }
+
+        return Result<uint32_t>::FromValue(skipped);
+    }
+
+    Optional<ServiceSlot> SingleRegistry::ReadSlot(uint32_t slot_index) const noexcept
+    {
+        if (!IsInitialized() || !IsValidSlotIndex(slot_index)) {
+            return Optional<ServiceSlot>{};
+        }
+
+        uint32_t retries = 0;
+        auto opt_slot = SeqLockReader::ReadSlot(slots_[slot_index], retries);
+        recordRead(retries, !opt_slot.has_value());
+        if (opt_slot.has_value() && opt_slot.value().IsActive()) {
+            opt_slot.value().last_heartbeat_ns = index_[slot_index].last_heartbeat_ns.load(std::memory_order_acquire);
+        }
+        return opt_slot;
+    }
+
+    Result<void> SingleRegistry::UpdateHeartbeat(uint32_t slot_index, uint64_t timestamp_ns) noexcept
+    {
+        if (!IsInitialized()) {
+            return Result<void>::FromError(MakeErrorCode(ComErrc::kNotInitialized, 0));
+        }
+
+        if (!IsValidSlotIndex(slot_index)) {
+            return Result<void>::FromError(MakeErrorCode(ComErrc::kInvalidArgument, 0));
+        }
+
+        // Single atomic store outside the seqlock-protected fields: concurrent
+        // readers of the entry or the slot never have to retry for a heartbeat
+        index_[slot_index].last_heartbeat_ns.store(timestamp_ns, std::memory_order_release);
+        stats_->heartbeats.fetch_add(1, std::memory_order_relaxed);
+
+        return Result<void>::FromValue();
+    }
+
+    Result<RegistryStats> SingleRegistry::GetStats() const noexcept
+    {
+        if (!IsInitialized()) {
+            return Result<RegistryStats>::FromError(MakeErrorCode(ComErrc::kNotInitialized, 0));
+        }
+
+        RegistryStats stats{};
+        const RegistryStatsShard* shards = RegistryLayout::Stats(base_);
+        for (uint32_t shard = 0; shard < RegistryLayout::STATS_SHARDS; ++shard) {
+            const RegistryStatsShard& counters = shards[shard];
+            stats.registrations += counters.registrations.load(std::memory_order_relaxed);
+            stats.unregistrations += counters.unregistrations.load(std::memory_order_relaxed);
+            stats.reclaims += counters.reclaims.load(std::memory_order_relaxed);
+            stats.heartbeats += counters.heartbeats.load(std::memory_order_relaxed);
+            stats.reader_retries += counters.reader_retries.load(std::memory_order_relaxed);
+            stats.reader_failures += counters.reader_failures.load(std::memory_order_relaxed);
+            stats.writer_waits += counters.writer_waits.load(std::memory_order_relaxed);
+            stats.max_retry_streak = std::max(stats.max_retry_streak,
+                                              counters.max_retry_streak.load(std::memory_order_relaxed));
+        }
+
+        stats.generation = header_->generation.load(std::memory_order_acquire);
+        stats.epoch = header_->epoch;
+        stats.slot_count = slot_count_;
+        for (uint32_t block = 0; block < slot_count_; block += TagScan::BLOCK_SIZE) {
+            stats.live_slots += static_cast<uint32_t>(__builtin_popcountll(
+                TagScan::LiveMask(&tags_[block]) & TagScan::ValidMask(block, slot_count_)));
+        }
+
+        return Result<RegistryStats>::FromValue(stats);
+    }
+
+    // ========================================================================
+    // SharedMemoryRegistry Implementation
+    // ========================================================================
+
+    namespace
+    {
+        /// Attempts to fetch a successor that the daemon has already published
+        constexpr uint32_t REFRESH_RETRY_COUNT = 100;
+
+        /// Pause between attempts (daemon swaps its served memfd right after migrating)
+        constexpr std::chrono::milliseconds REFRESH_RETRY_DELAY{1};
+
+        template <typename T>
+        bool IsRetiredError(const Result<T>& result) noexcept
+        {
+            return !result.HasValue() &&
+                   result.Error().Value() == static_cast<int>(ComErrc::kRegistryRetired);
+        }
+    } // namespace
+
+    Result<void> SharedMemoryRegistry::Initialize() noexcept
+    {
+        // Initialize QM registry (QM + ASIL-A/B services)
+        auto qm_result = qm_registry_.Initialize();
+        if (qm_result.HasValue() == false) {
+            return qm_result;
+        }
+
+        // Initialize ASIL registry (ASIL-C/D services)
+        auto asil_result = asil_registry_.Initialize();
+        if (asil_result.HasValue() == false) {
+            return asil_result;
+        }
+
+        return Result<void>::FromValue();
+    }
+
+    Result<void> SharedMemoryRegistry::InitializeFromSocket(
+        const String& qm_socket_path,
+        const String& asil_socket_path) noexcept
+    {
+        // Initialize QM registry from systemd socket
+        auto qm_result = qm_registry_.InitializeFromSocket(qm_socket_path);
+        if (!qm_result.HasValue()) {
+            return qm_result;
+        }
+
+        // Initialize ASIL registry from systemd socket
+        auto asil_result = asil_registry_.InitializeFromSocket(asil_socket_path);
+        if (!asil_result.HasValue()) {
+            return asil_result;
+        }
+
+        // Remembered to fetch resized successors (Refresh())
+        qm_socket_path_ = qm_socket_path;
+        asil_socket_path_ = asil_socket_path;
+
+        return Result<void>::FromValue();
+    }
+
+    Result<bool> SharedMemoryRegistry::Refresh() noexcept
+    {
+        std::lock_guard<std::mutex> lock(refresh_mutex_);
+
+        auto qm_result = refreshRegistry(RegistryType::QM);
+        if (!qm_result.HasValue()) {
+            return qm_result;
+        }
+
+        auto asil_result = refreshRegistry(RegistryType::ASIL);
+        if (!asil_result.HasValue()) {
+            return asil_result;
+        }
+
+        return Result<bool>::FromValue(qm_result.Value() || asil_result.Value());
+    }
+
+    Result<bool> SharedMemoryRegistry::refreshRegistry(RegistryType type) noexcept
+    {
+        SingleRegistry& current = Active(type);
+        if (!current.IsRetired()) {
+            return Result<bool>::FromValue(false);
+        }
+
+        const String& socket_path = (type == RegistryType::ASIL) ? asil_socket_path_ : qm_socket_path_;
+        if (socket_path.empty()) {
+            return Result<bool>::FromError(MakeErrorCode(ComErrc::kNotSupported, 0));
+        }
+
+        // Huge pages are a property of the memfd chosen by its creator
+        RegistryMemoryOptions options = memory_options_;
+        options.huge_pages = false;
+
+        for (uint32_t attempt = 0; attempt < REFRESH_RETRY_COUNT; ++attempt) {
+            auto successor = std::make_unique<SingleRegistry>(type);
+            successor->SetMemoryOptions(options);
+
+            auto init_result = successor->InitializeFromSocket(socket_path);
+            if (!init_result.HasValue()) {
+                return Result<bool>::FromError(init_result.Error());
+            }
+
+            // The daemon may still be serving the memfd it has just retired
+            if (successor->IsRetired() || successor->GetEpoch() <= current.GetEpoch()) {
+                std::this_thread::sleep_for(REFRESH_RETRY_DELAY);
+                continue;
+            }
+
+            std::atomic<SingleRegistry*>& active = (type == RegistryType::ASIL) ? asil_active_ : qm_active_;
+            active.store(successor.get(), std::memory_order_release);
+            successors_.push_back(std::move(successor));
+            refresh_count_.fetch_add(1, std::memory_order_acq_rel);
+            return Result<bool>::FromValue(true);
+        }
+
+        return Result<bool>::FromError(MakeErrorCode(ComErrc::kTimeout, 0));
+    }
+
+    Result<void> SharedMemoryRegistry::RegisterService(
+        uint64_t service_id,
+        uint64_t instance_id,
+        uint32_t major_version,
+        uint32_t minor_version,
+        const char* binding_type,
+        const char* endpoint,
+        uint32_t heartbeat_interval_ms) noexcept
+    {
+        // Reject reserved service IDs
+        if (!IsValidServiceId(service_id)) {
+            return Result<void>::FromError(MakeErrorCode(ComErrc::kInvalidArgument, 0));
+        }
+
+        // Select registry based on service ID
         RegistryType reg_type = SelectRegistry(service_id);
 
-        if (reg_type == RegistryType::ASIL) {
-            return asil_registry_.FindService(service_id);
-        } else {
-            // QM or BOTH: search QM registry first
-            return qm_registry_.FindService(service_id);
+        if (reg_type == RegistryType::BOTH) {
+            // Broadcast service: register in both QM and ASIL registries
+            auto qm_result = RegisterIn(RegistryType::QM, service_id, instance_id,
+                                        major_version, minor_version, binding_type, endpoint,
+                                        heartbeat_interval_ms);
+            
+            auto asil_result = RegisterIn(RegistryType::ASIL, service_id, instance_id,
+                                          major_version, minor_version, binding_type, endpoint,
+                                          heartbeat_interval_ms);
+            
+            // Return first error if any
+            if (qm_result.HasValue() == false) {
+                return qm_result;
+            }
+            return asil_result;
         }
+
+        // ASIL-C/D service or QM + ASIL-A/B service
+        return RegisterIn(reg_type, service_id, instance_id,
+                          major_version, minor_version, binding_type, endpoint,
+                          heartbeat_interval_ms);
+    }
+
+    Result<void> SharedMemoryRegistry::RegisterIn(
+        RegistryType type,
+        uint64_t service_id,
+        uint64_t instance_id,
+        uint32_t major_version,
+        uint32_t minor_version,
+        const char* binding_type,
+        const char* endpoint,
+        uint32_t heartbeat_interval_ms) noexcept
+    {
+        auto result = Active(type).RegisterService(
+            service_id, instance_id, major_version, minor_version, binding_type, endpoint,
+            heartbeat_interval_ms);
+
+        if (IsRetiredError(result) && Refresh().HasValue()) {
+            result = Active(type).RegisterService(
+                service_id, instance_id, major_version, minor_version, binding_type, endpoint,
+                heartbeat_interval_ms);
+        }
+
+        if (!result.HasValue()) {
+            return Result<void>::FromError(result.Error());
+        }
+        return Result<void>::FromValue();
+    }
+
+    Result<void> SharedMemoryRegistry::UnregisterService(uint64_t service_id) noexcept
+    {
+        if (!IsValidServiceId(service_id)) {
+            return Result<void>::FromError(MakeErrorCode(ComErrc::kInvalidArgument, 0));
+        }
+
+        RegistryType reg_type = SelectRegistry(service_id);
+
+        if (reg_type == RegistryType::BOTH) {
+            UnregisterFrom(RegistryType::QM, service_id, Optional<uint64_t>{});
+            return UnregisterFrom(RegistryType::ASIL, service_id, Optional<uint64_t>{});
+        }
+        return UnregisterFrom(reg_type, service_id, Optional<uint64_t>{});
+    }
+
+    Result<void> SharedMemoryRegistry::UnregisterService(uint64_t service_id, uint64_t instance_id) noexcept
+    {
+        if (!IsValidServiceId(service_id)) {
+            return Result<void>::FromError(MakeErrorCode(ComErrc::kInvalidArgument, 0));
+        }
+
+        RegistryType reg_type = SelectRegistry(service_id);
+
+        if (reg_type == RegistryType::BOTH) {
+            UnregisterFrom(RegistryType::QM, service_id, Optional<uint64_t>(instance_id));
+            return UnregisterFrom(RegistryType::ASIL, service_id, Optional<uint64_t>(instance_id));
+        }
+        return UnregisterFrom(reg_type, service_id, Optional<uint64_t>(instance_id));
+    }
+
+    Result<void> SharedMemoryRegistry::UnregisterFrom(
+        RegistryType type, uint64_t service_id, const Optional<uint64_t>& instance_id) noexcept
+    {
+        Result<void> result = Result<void>::FromValue();
+
+        // Slot indices differ between generations: look up again after a refresh
+        for (uint32_t attempt = 0; attempt < 2; ++attempt) {
+            SingleRegistry& registry = Active(type);
+            auto slot_index = instance_id.has_value()
+                              ? registry.FindSlot(service_id, instance_id.value())
+                              : registry.FindSlot(service_id);
+            if (!slot_index.has_value()) {
+                return Result<void>::FromError(MakeErrorCode(ComErrc::kServiceNotAvailable, 0));
+            }
+
+            result = registry.UnregisterService(slot_index.value());
+            if (!IsRetiredError(result) || !Refresh().HasValue()) {
+                break;
+            }
+        }
+
+        return result;
+    }
+
+    Optional<ServiceSlot> SharedMemoryRegistry::FindService(uint64_t service_id, Liveness liveness) const noexcept
+    {
+        auto result = LookupService(service_id, liveness);
+        if (!result.HasValue()) {
+            return Optional<ServiceSlot>{};
+        }
+        return Optional<ServiceSlot>(result.Value());
+    }
+
+    Result<ServiceSlot> SharedMemoryRegistry::LookupService(uint64_t service_id, Liveness liveness) const noexcept
+    {
+        const RegistryType primary = PrimaryRegistry(service_id);
+        const uint64_t now_ns = (liveness == Liveness::LIVE_ONLY) ? SingleRegistry::MonotonicNowNs() : 0;
+
+        auto result = lookupIn(primary, service_id, liveness, now_ns);
+
+        // Reclassified service still registered in (or looked up with) the old registry
+        if (!result.HasValue() && routing_.GetSearch() == RegistrySearch::COMBINED &&
+            SelectRegistry(service_id) != RegistryType::BOTH &&
+            result.Error().Value() == static_cast<int>(ComErrc::kServiceNotAvailable)) {
+            const RegistryType other = (primary == RegistryType::ASIL) ? RegistryType::QM : RegistryType::ASIL;
+            auto fallback = lookupIn(other, service_id, liveness, now_ns);
+            if (fallback.HasValue() ||
+                fallback.Error().Value() == static_cast<int>(ComErrc::kRegistryContended)) {
+                return fallback;
+            }
+        }
+        return result;
+    }
+
+    Result<ServiceSlot> SharedMemoryRegistry::lookupIn(
+        RegistryType type, uint64_t service_id, Liveness liveness, uint64_t now_ns) const noexcept
+    {
+        const SingleRegistry& registry = Active(type);
+        if (!registry.IsInitialized()) {
+            return Result<ServiceSlot>::FromError(MakeErrorCode(ComErrc::kNotInitialized, 0));
+        }
+
+        // The ASIL half of the cache is offset so both registries of a service can be cached
+        const uint32_t bucket = (static_cast<uint32_t>(service_id ^ (service_id >> 32)) +
+                                 (type == RegistryType::ASIL ? RegistryConfig::LOOKUP_CACHE_SIZE / 2 : 0)) &
+                                (RegistryConfig::LOOKUP_CACHE_SIZE - 1);
+        const uint32_t generation = registry.GetGeneration();
+
+        // Hit: same registry and no registration change since the entry was read
+        LookupCacheEntry& entry = lookup_cache_[bucket];
+        LookupCacheCounters& counters = countersOfThisThread();
+        const uint64_t seq = entry.sequence.load(std::memory_order_acquire);
+        if ((seq & 1) == 0 && entry.registry == &registry && entry.service_id == service_id &&
+            entry.generation == generation) {
+            const uint32_t cached_index = entry.slot_index;
+            ServiceSlot slot{entry.slot};
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (entry.sequence.load(std::memory_order_relaxed) == seq) {
+                if (cached_index == RegistryConfig::RESERVED_SLOT) {
+                    counters.hits.fetch_add(1, std::memory_order_relaxed);
+                    return Result<ServiceSlot>::FromError(MakeErrorCode(ComErrc::kServiceNotAvailable, 0));
+                }
+                const uint64_t heartbeat_ns = registry.LoadHeartbeat(cached_index);
+                if (liveness == Liveness::ANY ||
+                    SingleRegistry::IsLive(heartbeat_ns, slot.heartbeat_interval_ms, now_ns)) {
+                    counters.hits.fetch_add(1, std::memory_order_relaxed);
+                    slot.last_heartbeat_ns = heartbeat_ns;
+                    return Result<ServiceSlot>::FromValue(slot);
+                }
+                // First instance is stale: a later instance may be live
+                counters.misses.fetch_add(1, std::memory_order_relaxed);
+                uint32_t live_index = RegistryConfig::RESERVED_SLOT;
+                return registry.LookupService(service_id, liveness, live_index);
+            }
+        }
+        counters.misses.fetch_add(1, std::memory_order_relaxed);
+
+        // Miss: cache the first instance regardless of liveness (valid for both filters)
+        uint32_t slot_index = RegistryConfig::RESERVED_SLOT;
+        auto result = registry.LookupService(service_id, Liveness::ANY, slot_index);
+
+        // A contended miss says nothing about the registry contents: do not cache it
+        if (!result.HasValue() && result.Error().Value() == static_cast<int>(ComErrc::kRegistryContended)) {
+            return result;
+        }
+
+        // Another thread filling the entry wins; this result is simply not cached
+        uint64_t fill_seq = entry.sequence.load(std::memory_order_relaxed);
+        if ((fill_seq & 1) == 0 &&
+            entry.sequence.compare_exchange_strong(fill_seq, fill_seq + 1, std::memory_order_acquire)) {
+            std::atomic_thread_fence(std::memory_order_release);
+            entry.registry = &registry;
+            entry.service_id = service_id;
+            entry.generation = generation;
+            entry.slot_index = slot_index;
+            if (result.HasValue()) {
+                entry.slot = result.Value();
+            }
+            entry.sequence.store(fill_seq + 2, std::memory_order_release);
+        }
+
+        if (result.HasValue() && liveness == Liveness::LIVE_ONLY &&
+            !SingleRegistry::IsLive(result.Value().last_heartbeat_ns,
+                                    result.Value().heartbeat_interval_ms, now_ns)) {
+            return registry.LookupService(service_id, liveness, slot_index);
+        }
+        return result;
+    }
+
+    SharedMemoryRegistry::LookupCacheCounters& SharedMemoryRegistry::countersOfThisThread() const noexcept
+    {
+        static thread_local const uint32_t shard = static_cast<uint32_t>(
+            std::hash<std::thread::id>{}(std::this_thread::get_id()) % RegistryLayout::STATS_SHARDS);
+        return lookup_cache_counters_[shard];
+    }
+
+    Vector<ServiceInstanceInfo> SharedMemoryRegistry::FindAllInstances(uint64_t service_id, Liveness liveness) const
+    {
+        // QM or BOTH: broadcast instances are mirrored, QM registry is authoritative
+        const RegistryType primary = PrimaryRegistry(service_id);
+        auto instances = Active(primary).FindAllInstances(service_id, liveness);
+
+        if (routing_.GetSearch() == RegistrySearch::COMBINED && SelectRegistry(service_id) != RegistryType::BOTH) {
+            const RegistryType other = (primary == RegistryType::ASIL) ? RegistryType::QM : RegistryType::ASIL;
+            auto more = Active(other).FindAllInstances(service_id, liveness);
+            instances.insert(instances.end(), more.begin(), more.end());
+        }
+        return instances;
+    }
+
+    Result<RegistryStats> SharedMemoryRegistry::GetStats(RegistryType type) const noexcept
+    {
+        if (type == RegistryType::BOTH) {
+            return Result<RegistryStats>::FromError(MakeErrorCode(ComErrc::kInvalidArgument, 0));
+        }
+
+        return Active(type).GetStats();
+    }
+
+    uint32_t SharedMemoryRegistry::GetGeneration(uint64_t service_id) const noexcept
+    {
+        // BOTH: broadcast services are mirrored, the QM registry is authoritative
+        return Active(PrimaryRegistry(service_id)).GetGeneration();
+    }
+
+    Result<uint32_t> SharedMemoryRegistry::WaitForChange(
+        uint64_t service_id, uint32_t known_generation, std::chrono::milliseconds timeout) noexcept
+    {
+        // BOTH: broadcast services are mirrored, the QM registry is authoritative
+        const RegistryType type = PrimaryRegistry(service_id);
+
+        auto result = Active(type).WaitForChange(known_generation, timeout);
+        if (IsRetiredError(result)) {
+            // Resized: the successor's contents are the change (its generation
+            // is unrelated to known_generation, so callers simply look up again)
+            auto refresh_result = Refresh();
+            if (!refresh_result.HasValue()) {
+                return Result<uint32_t>::FromError(refresh_result.Error());
+            }
+            return Result<uint32_t>::FromValue(Active(type).GetGeneration());
+        }
+        return result;
+    }
+
+    Result<uint32_t> SharedMemoryRegistry::Snapshot(Vector<ServiceSlotSummary>& entries) const
+    {
+        entries.clear();
+
+        auto qm_result = Active(RegistryType::QM).Snapshot(entries);
+        if (!qm_result.HasValue()) {
+            return qm_result;
+        }
+
+        // ASIL entries are appended after the QM entries
+        auto asil_result = Active(RegistryType::ASIL).Snapshot(entries);
+        if (!asil_result.HasValue()) {
+            return asil_result;
+        }
+
+        return Result<uint32_t>::FromValue(qm_result.Value() + asil_result.Value());
+    }
+
+    Result<uint32_t> SharedMemoryRegistry::ScanService(
+        uint64_t service_id, Vector<ServiceSlotSummary>& entries, Liveness liveness) const
+    {
+        entries.clear();
+
+        auto qm_result = Active(RegistryType::QM).ScanService(service_id, entries, liveness);
+        if (!qm_result.HasValue()) {
+            return qm_result;
+        }
+
+        // Broadcast instances are mirrored into the ASIL registry: QM copy is authoritative
+        if (SelectRegistry(service_id) == RegistryType::BOTH) {
+            return qm_result;
+        }
+
+        auto asil_result = Active(RegistryType::ASIL).ScanService(service_id, entries, liveness);
+        if (!asil_result.HasValue()) {
+            return asil_result;
+        }
+
+        return Result<uint32_t>::FromValue(qm_result.Value() + asil_result.Value());
     }
 
     Result<void> SharedMemoryRegistry::UpdateHeartbeat(uint64_t service_id, uint64_t timestamp_ns) noexcept
     {
-        uint32_t slot_index = CalculateSlot(service_id);
-        if (slot_index == 0) {
+        if (!IsValidServiceId(service_id)) {
             return Result<void>::FromError(MakeErrorCode(ComErrc::kInvalidArgument, 0));
         }
 
         RegistryType reg_type = SelectRegistry(service_id);
 
         if (reg_type == RegistryType::BOTH) {
-            qm_registry_.UpdateHeartbeat(slot_index, timestamp_ns);
-            return asil_registry_.UpdateHeartbeat(slot_index, timestamp_ns);
-        } else if (reg_type == RegistryType::ASIL) {
-            return asil_registry_.UpdateHeartbeat(slot_index, timestamp_ns);
-        } else {
-            return qm_registry_.UpdateHeartbeat(slot_index, timestamp_ns);
+            UpdateHeartbeatIn(Active(RegistryType::QM), service_id, timestamp_ns);
+            return UpdateHeartbeatIn(Active(RegistryType::ASIL), service_id, timestamp_ns);
+        }
+        return UpdateHeartbeatIn(Active(reg_type), service_id, timestamp_ns);
+    }
+
+    Result<void> SharedMemoryRegistry::GetHeartbeatTargets(
+        uint64_t service_id, uint64_t instance_id, Vector<HeartbeatTarget>& targets) const
+    {
+        RegistryType reg_type = SelectRegistry(service_id);
+        bool found = false;
+
+        if (reg_type != RegistryType::ASIL) {
+            found |= AppendHeartbeatTarget(Active(RegistryType::QM), RegistryType::QM,
+                                           service_id, instance_id, targets);
+        }
+        if (reg_type != RegistryType::QM) {
+            found |= AppendHeartbeatTarget(Active(RegistryType::ASIL), RegistryType::ASIL,
+                                           service_id, instance_id, targets);
+        }
+
+        if (!found) {
+            return Result<void>::FromError(MakeErrorCode(ComErrc::kServiceNotAvailable, 0));
+        }
+        return Result<void>::FromValue();
+    }
+
+    uint32_t SharedMemoryRegistry::UpdateHeartbeats(
+        const Vector<HeartbeatTarget>& targets, uint64_t timestamp_ns) noexcept
+    {
+        SingleRegistry& qm = Active(RegistryType::QM);
+        SingleRegistry& asil = Active(RegistryType::ASIL);
+
+        uint32_t failed = 0;
+        for (const auto& target : targets) {
+            SingleRegistry& registry = (target.registry == RegistryType::ASIL) ? asil : qm;
+            if (!registry.UpdateHeartbeat(target.slot_index, timestamp_ns).HasValue()) {
+                ++failed;
+            }
+        }
+        return failed;
+    }
+
+    bool SharedMemoryRegistry::ResolveHeartbeatTarget(HeartbeatTarget& target) const noexcept
+    {
+        auto slot_index = Active(target.registry).FindSlot(target.service_id, target.instance_id);
+        if (!slot_index.has_value()) {
+            return false;
+        }
+        target.slot_index = slot_index.value();
+        return true;
+    }
+
+    bool SharedMemoryRegistry::AppendHeartbeatTarget(
+        const SingleRegistry& registry, RegistryType type,
+        uint64_t service_id, uint64_t instance_id, Vector<HeartbeatTarget>& targets)
+    {
+        auto slot_index = registry.FindSlot(service_id, instance_id);
+        if (!slot_index.has_value()) {
+            return false;
+        }
+
+        auto slot = registry.ReadSlot(slot_index.value());
+        uint32_t interval_ms = slot.has_value() ? slot.value().heartbeat_interval_ms : 0;
+
+        targets.push_back(HeartbeatTarget{
+            service_id, instance_id, 0, slot_index.value(), interval_ms, type});
+        return true;
+    }
+
+    Result<void> SharedMemoryRegistry::UpdateHeartbeatIn(
+        SingleRegistry& registry, uint64_t service_id, uint64_t timestamp_ns) noexcept
+    {
+        auto slot_index = registry.FindSlot(service_id);
+        if (!slot_index.has_value()) {
+            return Result<void>::FromError(MakeErrorCode(ComErrc::kServiceNotAvailable, 0));
         }
+        return registry.UpdateHeartbeat(slot_index.value(), timestamp_ns);
     }
 
 } // namespace registry
@@ -12,11 +12,17 @@
 #define LAP_COM_EVENT_HPP
 
 #include "ComTypes.hpp"
+#include "LoanedEventChannel.hpp"
+#include "SampleQueue.hpp"
 #include <core/CResult.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <limits>
 #include <memory>
 #include <mutex>
-#include <queue>
+#include <new>
 #include <functional>
 
 namespace lap
@@ -31,11 +37,29 @@ namespace com
      * @brief Proxy-side event for receiving data
      * @tparam SampleType Type of event data
      * @note SWS_CM_00700 - Event subscription and reception
+     * @details Received samples pass from the binding thread to the application
+     *          through a lock-free SampleQueue sized by Subscribe(maxSampleCount).
+     *          m_mutex only serializes the control path (Subscribe/Unsubscribe,
+     *          E2E status); the receive handler has its own lock and is only
+     *          taken when a handler is set. The binding builds samples with
+     *          AllocateSample(), which takes them from a SamplePool sized with the
+     *          queue (bounded by kMaxPoolBytes) and falls back to the heap when the
+     *          pool is exhausted. With EnableZeroCopy() samples instead point into
+     *          transport memory and no pool is kept.
+     *          GetNextSample(), GetNewSamples(), Subscribe() and Unsubscribe()
+     *          are consumer-side calls and must come from one thread at a time.
      */
     template<typename SampleType>
     class ProxyEvent
     {
     public:
+        /// Queue depth used for Subscribe(0)
+        static constexpr lap::core::UInt32 kDefaultQueueDepth = 256;
+        /// Upper bound on pooled receive samples
+        static constexpr lap::core::UInt32 kMaxPoolSize = 1U << 20;
+        /// Upper bound on the memory of the receive pool (larger samples use the heap)
+        static constexpr std::size_t kMaxPoolBytes = std::size_t{4} << 20;
+
         /**
          * @brief Constructor
          * @note SWS_CM_00701
@@ -49,27 +73,82 @@ namespace com
         ~ProxyEvent() noexcept
         {
             Unsubscribe();
+            if (m_borrowChannel)
+            {
+                // Wait for the binding thread, then return what it pushed meanwhile
+                m_borrowChannel->Detach();
+                if (m_sampleQueue)
+                {
+                    m_sampleQueue->Clear();
+                }
+            }
         }
         
         /**
          * @brief Subscribe to event
-         * @param maxSampleCount Maximum number of cached samples (0 = unlimited)
-         * @return Result indicating success or error
+         * @param maxSampleCount Depth of the sample queue; the oldest sample is
+         *        dropped when it is full (0 = kDefaultQueueDepth). The sample pool
+         *        holds twice as many (a full queue plus as many held by the
+         *        application), at most kMaxPoolBytes; none with EnableZeroCopy().
+         * @return Result indicating success or error; kInvalidArgument with
+         *         EnableZeroCopy() if the depth exceeds the transport's borrow limit
          * @note SWS_CM_00703
          */
         Result<void> Subscribe(lap::core::UInt32 maxSampleCount = 1) noexcept
         {
             std::lock_guard<std::mutex> lock(m_mutex);
             
-            if (m_subscriptionState == SubscriptionState::kSubscribed)
+            if (m_subscriptionState.load(std::memory_order_relaxed) == SubscriptionState::kSubscribed)
             {
                 return Result<void>::FromValue();
             }
             
+            const lap::core::UInt32 depth = (maxSampleCount == 0) ? kDefaultQueueDepth : maxSampleCount;
+            if (m_borrowChannel && !FitsBorrowLimit(*m_borrowChannel, depth))
+            {
+                return Result<void>::FromError(
+                    MakeErrorCode(ComErrc::kInvalidArgument, 0));
+            }
             m_maxSampleCount = maxSampleCount;
-            m_subscriptionState = SubscriptionState::kSubscribed;
+            
+            // Reuse the ring of a previous subscription when it still fits
+            if (!m_sampleQueue || m_sampleQueue->Capacity() != depth ||
+                m_sampleQueue->Producers() != m_queueProducers)
+            {
+                std::unique_ptr<SampleQueue<SamplePtr<SampleType>>> queue(
+                    new (std::nothrow) SampleQueue<SamplePtr<SampleType>>(depth, m_queueProducers));
+                if (!queue || !queue->IsValid())
+                {
+                    return Result<void>::FromError(
+                        MakeErrorCode(ComErrc::kSampleAllocationFailure, 0));
+                }
+                
+                // The borrow channel keeps delivering while unsubscribed: stop
+                // its listener so it cannot use the ring and pool being replaced
+                if (m_borrowChannel)
+                {
+                    m_borrowChannel->Detach();
+                }
+                
+                m_sampleQueue = std::move(queue);
+                
+                // Samples still held from the old pool keep it alive; without a
+                // pool the binding allocates on the heap
+                const lap::core::UInt32 poolSize = m_borrowChannel ? 0 : PoolSizeFor(depth);
+                m_samplePool.reset((poolSize != 0) ? SamplePool::Create<SampleType>(poolSize) : nullptr);
+                
+                if (m_borrowChannel)
+                {
+                    auto result = SubscribeBorrowed(*m_borrowChannel);
+                    if (!result.HasValue())
+                    {
+                        return result;
+                    }
+                }
+            }
             
             // Register with network binding
+            m_subscriptionState.store(SubscriptionState::kSubscribed, std::memory_order_release);
             return Result<void>::FromValue();
         }
         
@@ -81,11 +160,11 @@ namespace com
         {
             std::lock_guard<std::mutex> lock(m_mutex);
             
-            if (m_subscriptionState == SubscriptionState::kSubscribed)
+            if (m_subscriptionState.load(std::memory_order_relaxed) == SubscriptionState::kSubscribed)
             {
-                m_subscriptionState = SubscriptionState::kNotSubscribed;
-                m_sampleQueue = std::queue<SamplePtr<SampleType>>{};
-                m_receiveHandler = nullptr;
+                m_subscriptionState.store(SubscriptionState::kNotSubscribed, std::memory_order_release);
+                m_sampleQueue->Clear();
+                UnsetReceiveHandler();
             }
         }
         
@@ -95,9 +174,83 @@ namespace com
          * @note SWS_CM_00705
          */
         SubscriptionState GetSubscriptionState() const noexcept
+        {
+            return m_subscriptionState.load(std::memory_order_acquire);
+        }
+        
+        /**
+         * @brief Select single- or multi-threaded delivery into the sample queue
+         * @param producers kMultiple if the binding pushes from several threads
+         * @note Takes effect with the next Subscribe()
+         */
+        void SetQueueProducers(SampleQueueProducers producers) noexcept
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_queueProducers = producers;
+        }
+        
+        /**
+         * @brief Receive samples in place from a zero-copy binding
+         * @param transport Binding of the subscribed service instance
+         * @param serviceId AUTOSAR service ID
+         * @param instanceId AUTOSAR instance ID
+         * @param eventId Event identifier
+         * @return kNotSupported if SampleType is not trivially copyable or the
+         *         binding has no zero-copy path (subscribe through the binding as before);
+         *         kInvalidArgument if the queue depth of Subscribe() exceeds the
+         *         transport's borrow limit
+         * @note Replaces ITransportBinding::SubscribeEvent() for this event: each
+         *       received SamplePtr points into transport memory and returns it when
+         *       dropped. The transport bounds how many samples may be held at once
+         *       (ITransportBinding::GetMaxBorrowedSamples()): queued samples and
+         *       samples held by the application both count, so the queue depth may
+         *       not exceed it and samples should be released promptly, and before
+         *       the event or binding is destroyed. Call once, after the event has its final address and
+         *       before any binding delivers. The receive pool is dropped: only
+         *       misaligned payloads are copied, into heap samples.
+         */
+        Result<void> EnableZeroCopy(binding::ITransportBinding& transport, uint64_t serviceId,
+                                    uint64_t instanceId, uint32_t eventId) noexcept
         {
             std::lock_guard<std::mutex> lock(m_mutex);
-            return m_subscriptionState;
+            
+            if (m_borrowChannel)
+            {
+                return Result<void>::FromValue();
+            }
+            
+            std::unique_ptr<BorrowedEventChannel<SampleType>> channel(
+                new (std::nothrow) BorrowedEventChannel<SampleType>());
+            if (!channel)
+            {
+                return Result<void>::FromError(
+                    MakeErrorCode(ComErrc::kSampleAllocationFailure, 0));
+            }
+            
+            auto result = channel->Attach(transport, serviceId, instanceId, eventId);
+            if (!result.HasValue())
+            {
+                return result;
+            }
+            
+            // A deeper queue would exhaust the borrow limit and stall delivery
+            if (m_sampleQueue && !FitsBorrowLimit(*channel, m_sampleQueue->Capacity()))
+            {
+                return Result<void>::FromError(
+                    MakeErrorCode(ComErrc::kInvalidArgument, 0));
+            }
+            
+            // Nothing delivers yet, so the pool can go before the listener starts
+            m_samplePool.reset();
+            
+            result = SubscribeBorrowed(*channel);
+            if (!result.HasValue())
+            {
+                return result;
+            }
+            
+            m_borrowChannel = std::move(channel);
+            return Result<void>::FromValue();
         }
         
         /**
@@ -107,8 +260,46 @@ namespace com
          */
         lap::core::UInt32 GetNewSamples() const noexcept
         {
-            std::lock_guard<std::mutex> lock(m_mutex);
-            return static_cast<lap::core::UInt32>(m_sampleQueue.size());
+            if (m_subscriptionState.load(std::memory_order_acquire) != SubscriptionState::kSubscribed)
+            {
+                return 0;
+            }
+            return m_sampleQueue->Size();
+        }
+        
+        /**
+         * @brief Drain queued samples through a callback
+         * @tparam F Callable invoked as f(SamplePtr<SampleType>)
+         * @param f Callback, invoked once per sample in arrival order
+         * @param maxNumberOfSamples Upper bound on samples handed to f
+         * @return Result containing the number of samples handed to f, or error
+         * @note SWS_CM_00706 (callable form). Samples are popped straight from the
+         *       queue, with no lock and no Result per sample. The pass is bounded by
+         *       the queue size at entry, so a fast producer cannot keep the consumer
+         *       in the loop.
+         */
+        template<typename F>
+        Result<std::size_t> GetNewSamples(
+            F&& f, std::size_t maxNumberOfSamples = std::numeric_limits<std::size_t>::max())
+        {
+            if (m_subscriptionState.load(std::memory_order_acquire) != SubscriptionState::kSubscribed)
+            {
+                return Result<std::size_t>::FromError(
+                    MakeErrorCode(ComErrc::kServiceNotAvailable, 0));
+            }
+            
+            const std::size_t available = m_sampleQueue->Size();
+            const std::size_t limit = (maxNumberOfSamples < available) ? maxNumberOfSamples : available;
+            
+            std::size_t count = 0;
+            SamplePtr<SampleType> sample;
+            while (count < limit && m_sampleQueue->TryPop(sample))
+            {
+                ++count;
+                f(std::move(sample));
+            }
+            
+            return Result<std::size_t>::FromValue(count);
         }
         
         /**
@@ -120,23 +311,19 @@ namespace com
         Result<SamplePtr<SampleType>> GetNextSample(
             std::chrono::milliseconds timeout = std::chrono::milliseconds(0)) noexcept
         {
-            std::lock_guard<std::mutex> lock(m_mutex);
-            
-            if (m_subscriptionState != SubscriptionState::kSubscribed)
+            if (m_subscriptionState.load(std::memory_order_acquire) != SubscriptionState::kSubscribed)
             {
                 return Result<SamplePtr<SampleType>>::FromError(
                     MakeErrorCode(ComErrc::kServiceNotAvailable, 0));
             }
             
-            if (m_sampleQueue.empty())
+            SamplePtr<SampleType> sample;
+            if (!m_sampleQueue->TryPop(sample))
             {
                 return Result<SamplePtr<SampleType>>::FromError(
                     MakeErrorCode(ComErrc::kMaxSamplesExceeded, 0));
             }
             
-            auto sample = std::move(m_sampleQueue.front());
-            m_sampleQueue.pop();
-            
             return Result<SamplePtr<SampleType>>::FromValue(std::move(sample));
         }
         
@@ -148,8 +335,9 @@ namespace com
          */
         Result<void> SetReceiveHandler(EventReceiveHandler<SampleType> handler) noexcept
         {
-            std::lock_guard<std::mutex> lock(m_mutex);
+            std::lock_guard<std::mutex> lock(m_handlerMutex);
             m_receiveHandler = std::move(handler);
+            m_hasReceiveHandler.store(static_cast<bool>(m_receiveHandler), std::memory_order_release);
             return Result<void>::FromValue();
         }
         
@@ -159,7 +347,8 @@ namespace com
          */
         void UnsetReceiveHandler() noexcept
         {
-            std::lock_guard<std::mutex> lock(m_mutex);
+            std::lock_guard<std::mutex> lock(m_handlerMutex);
+            m_hasReceiveHandler.store(false, std::memory_order_release);
             m_receiveHandler = nullptr;
         }
         
@@ -182,32 +371,105 @@ namespace com
         
     private:
         mutable std::mutex m_mutex;
-        SubscriptionState m_subscriptionState{SubscriptionState::kNotSubscribed};
+        std::atomic<SubscriptionState> m_subscriptionState{SubscriptionState::kNotSubscribed};
         lap::core::UInt32 m_maxSampleCount{1};
-        std::queue<SamplePtr<SampleType>> m_sampleQueue;
+        SampleQueueProducers m_queueProducers{SampleQueueProducers::kSingle};
+        // Declared before the queue: queued borrowed samples release through it
+        std::unique_ptr<BorrowedEventChannel<SampleType>> m_borrowChannel;
+        std::unique_ptr<SampleQueue<SamplePtr<SampleType>>> m_sampleQueue;
+        SamplePoolHandle m_samplePool;
+        std::mutex m_handlerMutex;
+        std::atomic<bool> m_hasReceiveHandler{false};
         EventReceiveHandler<SampleType> m_receiveHandler{nullptr};
         E2ECheckStatus m_e2eStatus{};
         
+        /**
+         * @brief Internal: Receive pool capacity for a queue depth
+         * @return 2 x depth, bounded by kMaxPoolSize and kMaxPoolBytes (0 = no pool)
+         */
+        static constexpr lap::core::UInt32 PoolSizeFor(lap::core::UInt32 depth) noexcept
+        {
+            const std::size_t byBytes = kMaxPoolBytes / sizeof(SampleType);
+            const std::size_t wanted = (depth > kMaxPoolSize / 2) ? kMaxPoolSize : std::size_t{depth} * 2;
+            return static_cast<lap::core::UInt32>((wanted < byBytes) ? wanted : byBytes);
+        }
+        
+        /**
+         * @brief Internal: A queue of this depth fits the transport's borrow limit
+         */
+        static bool FitsBorrowLimit(const BorrowedEventChannel<SampleType>& channel,
+                                    lap::core::UInt32 depth) noexcept
+        {
+            const uint32_t limit = channel.MaxBorrowed();
+            return limit == 0 || depth <= limit;
+        }
+        
+        /**
+         * @brief Internal: Start delivery of borrowed samples into the queue
+         * @param channel Attached borrow channel of this event
+         * @note Called with m_mutex held (EnableZeroCopy(), Subscribe())
+         */
+        Result<void> SubscribeBorrowed(BorrowedEventChannel<SampleType>& channel) noexcept
+        {
+            BorrowedEventChannel<SampleType>* borrowed = &channel;
+            return channel.Subscribe([this, borrowed](binding::EventLoan& loan) {
+                auto sample = borrowed->Adopt(loan, [this]() { return AllocateSample(); });
+                if (sample)
+                {
+                    PushSample(std::move(sample));
+                }
+            });
+        }
+        
+        /**
+         * @brief Internal: Get a sample for the binding to deserialize into
+         * @return Pooled sample, or a heap sample if the pool is exhausted (empty
+         *         on OOM or while not subscribed: the sample would be dropped)
+         * @note Binding thread, same lifetime rules as PushSample()
+         */
+        SampleAllocateePtr<SampleType> AllocateSample() noexcept
+        {
+            if (m_subscriptionState.load(std::memory_order_acquire) != SubscriptionState::kSubscribed)
+            {
+                return SampleAllocateePtr<SampleType>();
+            }
+            if (m_samplePool)
+            {
+                auto sample = MakePooledSample<SampleType>(*m_samplePool);
+                if (sample)
+                {
+                    return sample;
+                }
+            }
+            return SampleAllocateePtr<SampleType>(new (std::nothrow) SampleType());
+        }
+        
         /**
          * @brief Internal: Push received sample to queue
          * @param sample Sample to enqueue
+         * @note Binding thread. Lock-free unless a receive handler is set. The
+         *       binding must stop delivering before the event is unsubscribed
+         *       and subscribed again with a different depth (the ring is replaced);
+         *       Subscribe() does so itself for the EnableZeroCopy() channel.
          */
         void PushSample(SamplePtr<SampleType> sample) noexcept
         {
-            std::lock_guard<std::mutex> lock(m_mutex);
-            
-            // Drop oldest if max samples exceeded
-            if (m_maxSampleCount > 0 && m_sampleQueue.size() >= m_maxSampleCount)
+            if (m_subscriptionState.load(std::memory_order_acquire) != SubscriptionState::kSubscribed)
             {
-                m_sampleQueue.pop();
+                return;
             }
             
-            m_sampleQueue.push(std::move(sample));
+            // Drops the oldest sample if the queue is full
+            m_sampleQueue->Push(std::move(sample));
             
             // Notify handler if set
-            if (m_receiveHandler)
+            if (m_hasReceiveHandler.load(std::memory_order_acquire))
             {
-                m_receiveHandler();
+                std::lock_guard<std::mutex> lock(m_handlerMutex);
+                if (m_receiveHandler)
+                {
+                    m_receiveHandler();
+                }
             }
         }
         
@@ -227,6 +489,9 @@ namespace com
     class SkeletonEvent
     {
     public:
+        /// Pool size used until SetMaxSamples() is called
+        static constexpr lap::core::UInt32 kDefaultMaxSamples = 8;
+        
         /**
          * @brief Constructor
          * @note SWS_CM_00721
@@ -237,16 +502,100 @@ namespace com
          * @brief Destructor
          * @note SWS_CM_00722
          */
-        ~SkeletonEvent() noexcept = default;
+        ~SkeletonEvent() noexcept
+        {
+            SamplePool* pool = m_samplePool.load(std::memory_order_acquire);
+            if (pool != nullptr)
+            {
+                pool->Release();
+            }
+        }
+        
+        /**
+         * @brief Set the number of samples that can be allocated and not yet sent
+         * @param maxSamples Pool capacity (> 0)
+         * @return Result indicating success or error
+         * @note Configuration step: call before the first Allocate(), not concurrently
+         *       with it. Samples from a previous pool stay valid.
+         */
+        Result<void> SetMaxSamples(lap::core::UInt32 maxSamples) noexcept
+        {
+            if (maxSamples == 0)
+            {
+                return Result<void>::FromError(
+                    MakeErrorCode(ComErrc::kInvalidArgument, 0));
+            }
+            
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_maxSamples = maxSamples;
+            SamplePool* old = m_samplePool.exchange(nullptr, std::memory_order_acq_rel);
+            if (old != nullptr)
+            {
+                old->Release();
+            }
+            return Result<void>::FromValue();
+        }
+        
+        /**
+         * @brief Allocate samples in transport loans and publish them in place
+         * @param transport Binding that offers the service (e.g. iceoryx2)
+         * @param serviceId AUTOSAR service ID
+         * @param instanceId AUTOSAR instance ID
+         * @param eventId Event identifier
+         * @return kNotSupported if SampleType is not trivially copyable or the
+         *         binding has no zero-copy path (the event keeps its pool)
+         * @note Configuration step like SetMaxSamples(). Loaned samples must be
+         *       sent or dropped before the service stops being offered.
+         */
+        Result<void> EnableZeroCopy(binding::ITransportBinding& transport, uint64_t serviceId,
+                                    uint64_t instanceId, uint32_t eventId) noexcept
+        {
+            std::unique_ptr<LoanedEventChannel<SampleType>> channel(
+                new (std::nothrow) LoanedEventChannel<SampleType>());
+            if (!channel)
+            {
+                return Result<void>::FromError(
+                    MakeErrorCode(ComErrc::kSampleAllocationFailure, 0));
+            }
+            
+            auto result = channel->Attach(transport, serviceId, instanceId, eventId);
+            if (!result.HasValue())
+            {
+                return result;
+            }
+            
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_loanChannel = std::move(channel);
+            return Result<void>::FromValue();
+        }
         
         /**
          * @brief Allocate sample for sending
          * @return Result containing allocated sample or error
-         * @note SWS_CM_00723
+         * @note SWS_CM_00723. With EnableZeroCopy() the sample is built directly in
+         *       a transport loan. Otherwise (or when no loan is available) it comes
+         *       from a fixed pool of max-samples slots (created on first use);
+         *       kSampleAllocationFailure once all of them are allocated and not yet sent.
          */
         Result<SampleAllocateePtr<SampleType>> Allocate() noexcept
         {
-            auto sample = std::make_unique<SampleType>();
+            if (m_loanChannel)
+            {
+                auto loaned = m_loanChannel->Allocate();
+                if (loaned)
+                {
+                    return Result<SampleAllocateePtr<SampleType>>::FromValue(std::move(loaned));
+                }
+            }
+            
+            SamplePool* pool = m_samplePool.load(std::memory_order_acquire);
+            if (pool == nullptr)
+            {
+                pool = CreatePool();
+            }
+            
+            auto sample = (pool != nullptr) ? MakePooledSample<SampleType>(*pool)
+                                            : SampleAllocateePtr<SampleType>();
             if (!sample)
             {
                 return Result<SampleAllocateePtr<SampleType>>::FromError(
@@ -303,6 +652,25 @@ namespace com
         mutable std::mutex m_mutex;
         bool m_isOffered{false};
         lap::core::UInt32 m_subscriberCount{0};
+        lap::core::UInt32 m_maxSamples{kDefaultMaxSamples};
+        std::atomic<SamplePool*> m_samplePool{nullptr};
+        std::unique_ptr<LoanedEventChannel<SampleType>> m_loanChannel;
+        
+        /**
+         * @brief Create the sample pool on first Allocate()
+         * @return Pool, nullptr on allocation failure
+         */
+        SamplePool* CreatePool() noexcept
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            SamplePool* pool = m_samplePool.load(std::memory_order_acquire);
+            if (pool == nullptr)
+            {
+                pool = SamplePool::Create<SampleType>(m_maxSamples);
+                m_samplePool.store(pool, std::memory_order_release);
+            }
+            return pool;
+        }
         
         /**
          * @brief Implementation-specific send
@@ -311,6 +679,12 @@ namespace com
          */
         Result<void> DoSend(SampleAllocateePtr<SampleType> sample) noexcept
         {
+            if (m_loanChannel)
+            {
+                // Loaned samples are published in place
+                return m_loanChannel->Send(std::move(sample));
+            }
+            
             // Serialize and transmit via network binding
             // Implementation will use D-Bus signals, SOME/IP events, etc.
             
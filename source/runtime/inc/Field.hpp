@@ -13,11 +13,15 @@
 
 #include "ComTypes.hpp"
 #include "Event.hpp"
+#include "SharedFieldValue.hpp"
 #include <core/CResult.hpp>
 #include <core/CFuture.hpp>
 
+#include <cstddef>
 #include <functional>
+#include <limits>
 #include <mutex>
+#include <utility>
 
 namespace lap
 {
@@ -72,6 +76,12 @@ namespace com
             
             std::lock_guard<std::mutex> lock(m_mutex);
             
+            // Same-host skeleton publishes the value: no transport round trip
+            if (m_sharedValue.IsOpen())
+            {
+                return m_sharedValue.Load();
+            }
+            
             if (!m_isConnected)
             {
                 return Result<FieldType>::FromError(
@@ -97,6 +107,21 @@ namespace com
             
             std::lock_guard<std::mutex> lock(m_mutex);
             
+            if (m_sharedValue.IsOpen())
+            {
+                lap::core::Promise<FieldType> promise;
+                auto value = m_sharedValue.Load();
+                if (value.HasValue())
+                {
+                    promise.set_value(std::move(value).Value());
+                }
+                else
+                {
+                    promise.SetError(value.Error());
+                }
+                return promise.GetFuture();
+            }
+            
             if (!m_isConnected)
             {
                 lap::core::Promise<FieldType> promise;
@@ -208,6 +233,20 @@ namespace com
             return m_event.GetNewSamples();
         }
         
+        /**
+         * @brief Drain cached update notifications through a callback
+         * @tparam F Callable invoked as f(SamplePtr<FieldType>)
+         * @param f Callback, invoked once per update in arrival order
+         * @param maxNumberOfSamples Upper bound on updates handed to f
+         * @return Result containing the number of updates handed to f, or error
+         */
+        template<typename F>
+        Result<std::size_t> GetNewSamples(
+            F&& f, std::size_t maxNumberOfSamples = std::numeric_limits<std::size_t>::max())
+        {
+            return m_event.GetNewSamples(std::forward<F>(f), maxNumberOfSamples);
+        }
+        
         /**
          * @brief Get next field update notification
          * @param timeout Maximum wait time
@@ -246,6 +285,34 @@ namespace com
             m_event.UnsetReceiveHandler();
         }
         
+        /**
+         * @brief Serve Get()/GetAsync() from the skeleton's shared value
+         * @param name Shared memory object name, see MakeSharedFieldName()
+         * @return Result indicating success or error (kNotSupported for
+         *         non trivially copyable field types)
+         * @see SkeletonField::EnableSharedValue()
+         */
+        Result<void> AttachSharedValue(const char* name) noexcept
+        {
+            if (!m_hasGetter)
+            {
+                return Result<void>::FromError(
+                    MakeErrorCode(ComErrc::kInvalidArgument, 0));
+            }
+            
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_sharedValue.Open(name);
+        }
+        
+        /**
+         * @brief Go back to transport-based Get()
+         */
+        void DetachSharedValue() noexcept
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_sharedValue.Close();
+        }
+        
         /**
          * @brief Check if field has getter
          * @return true if getter is available
@@ -286,6 +353,7 @@ namespace com
         bool m_hasNotifier;
         bool m_isConnected{false};
         ProxyEvent<FieldType> m_event;
+        SharedFieldValue<FieldType> m_sharedValue;
         
         /**
          * @brief Implementation-specific synchronous get
@@ -421,6 +489,20 @@ namespace com
             return Result<void>::FromValue();
         }
         
+        /**
+         * @brief Publish every Update() to same-host proxies in shared memory
+         * @param name Shared memory object name, see MakeSharedFieldName()
+         * @return Result indicating success or error (kNotSupported for
+         *         non trivially copyable field types, kInvalidState if another
+         *         skeleton already publishes this field)
+         * @see ProxyField::AttachSharedValue()
+         */
+        Result<void> EnableSharedValue(const char* name) noexcept
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_sharedValue.Create(name);
+        }
+        
         /**
          * @brief Update field value and notify subscribers
          * @param value New field value
@@ -429,13 +511,24 @@ namespace com
          */
         Result<void> Update(const FieldType& value) noexcept
         {
-            if (!m_hasNotifier)
+            std::lock_guard<std::mutex> lock(m_mutex);
+            
+            if (!m_hasNotifier && !m_sharedValue.IsWriter())
             {
                 return Result<void>::FromError(
                     MakeErrorCode(ComErrc::kInvalidArgument, 0));
             }
             
-            std::lock_guard<std::mutex> lock(m_mutex);
+            // Serialized by m_mutex: single writer of the shared value
+            if (m_sharedValue.IsWriter())
+            {
+                m_sharedValue.Store(value);
+            }
+            
+            if (!m_hasNotifier)
+            {
+                return Result<void>::FromValue();
+            }
             
             // Allocate and send notification
             auto sampleResult = m_event.Allocate();
@@ -474,6 +567,7 @@ namespace com
         GetterHandlerType m_getterHandler{nullptr};
         SetterHandlerType m_setterHandler{nullptr};
         SkeletonEvent<FieldType> m_event;
+        SharedFieldValue<FieldType> m_sharedValue;
         
         /**
          * @brief Internal: Process getter request
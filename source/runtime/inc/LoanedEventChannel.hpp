@@ -0,0 +1,334 @@
+/**
+ * @file        LoanedEventChannel.hpp
+ * @author      LightAP Development Team
+ * @brief       Zero-copy event samples placed in transport loans
+ * @date        2025-11-23
+ * @details     The skeleton side of an event constructs each sample directly in a
+ *              payload buffer loaned from the transport binding (iceoryx2 shared
+ *              memory) and publishes it in place: no heap sample, no serialization
+ *              buffer, no memcpy. A sample dropped without Send() returns its loan.
+ *              The proxy side (BorrowedEventChannel) hands received payloads to the
+ *              application as SamplePtr without copying them out of the transport;
+ *              dropping the SamplePtr returns the payload to the transport.
+ * @copyright   Copyright (c) 2025
+ * @note        Only trivially copyable sample types can be loaned; for other types
+ *              Attach() returns kNotSupported and the event keeps its pool.
+ */
+#ifndef LAP_COM_LOANED_EVENT_CHANNEL_HPP
+#define LAP_COM_LOANED_EVENT_CHANNEL_HPP
+
+#include "ComTypes.hpp"
+#include "ITransportBinding.hpp"
+#include <core/CResult.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace lap
+{
+namespace com
+{
+    /**
+     * @brief Event sample allocation and send through transport loans
+     * @tparam SampleType Type of event data
+     *
+     * @details Allocate() loans sizeof(SampleType) bytes and default-initializes
+     *          the sample in place, so large frames are not zeroed first. The loan
+     *          handle travels in the SampleDeleter context; the channel is the
+     *          deleter's SampleStorage and releases the loan if the sample is
+     *          dropped. Samples that did not come from a loan (pool fallback) are
+     *          sent with one copy through ITransportBinding::SendEvent().
+     */
+    template<typename SampleType, bool = std::is_trivially_copyable<SampleType>::value>
+    class LoanedEventChannel final : public SampleStorage
+    {
+    public:
+        LoanedEventChannel() noexcept = default;
+
+        LoanedEventChannel(const LoanedEventChannel&) = delete;
+        LoanedEventChannel& operator=(const LoanedEventChannel&) = delete;
+
+        /**
+         * @brief Bind to the event of an offered service instance
+         * @return kNotSupported if the binding has no zero-copy path
+         */
+        Result<void> Attach(binding::ITransportBinding& transport, uint64_t serviceId,
+                            uint64_t instanceId, uint32_t eventId) noexcept
+        {
+            if (!transport.SupportsZeroCopy()) {
+                return Result<void>::FromError(MakeErrorCode(ComErrc::kNotSupported, 0));
+            }
+            transport_ = &transport;
+            service_id_ = serviceId;
+            instance_id_ = instanceId;
+            event_id_ = eventId;
+            return Result<void>::FromValue();
+        }
+
+        [[nodiscard]] bool IsAttached() const noexcept
+        {
+            return transport_ != nullptr;
+        }
+
+        /**
+         * @brief Construct a sample in a fresh loan
+         * @return Loaned sample, empty if the transport cannot loan right now or
+         *         its payload is not aligned for SampleType
+         */
+        SampleAllocateePtr<SampleType> Allocate() noexcept
+        {
+            if (transport_ == nullptr) {
+                return SampleAllocateePtr<SampleType>();
+            }
+            auto loan = transport_->LoanEvent(service_id_, instance_id_, event_id_, sizeof(SampleType));
+            if (!loan.HasValue()) {
+                return SampleAllocateePtr<SampleType>();
+            }
+            binding::EventLoan& buffer = loan.Value();
+            if (reinterpret_cast<std::uintptr_t>(buffer.payload) % alignof(SampleType) != 0) {
+                transport_->ReleaseLoanedEvent(buffer);
+                return SampleAllocateePtr<SampleType>();
+            }
+            return SampleAllocateePtr<SampleType>(::new (buffer.payload) SampleType,
+                                                  SampleDeleter<SampleType>(this, buffer.handle));
+        }
+
+        /**
+         * @brief Publish a sample: in place if loaned, else as one copy
+         */
+        Result<void> Send(SampleAllocateePtr<SampleType> sample) noexcept
+        {
+            if (transport_ == nullptr) {
+                return Result<void>::FromError(MakeErrorCode(ComErrc::kNotInitialized, 0));
+            }
+            if (sample.get_deleter().Storage() == this) {
+                // Trivially copyable, so there is no destructor to run
+                binding::EventLoan loan = MakeLoan(sample.get(), sample.get_deleter().Context());
+                sample.release();
+                return transport_->SendLoanedEvent(loan);
+            }
+            binding::ByteBuffer data(sizeof(SampleType));
+            std::memcpy(data.data(), sample.get(), sizeof(SampleType));
+            return transport_->SendEvent(service_id_, instance_id_, event_id_, data);
+        }
+
+        /// SampleDeleter: loaned sample dropped without Send()
+        void Recycle(void* sample, void* context) noexcept override
+        {
+            binding::EventLoan loan = MakeLoan(sample, context);
+            transport_->ReleaseLoanedEvent(loan);
+        }
+
+    private:
+        binding::EventLoan MakeLoan(void* payload, void* handle) const noexcept
+        {
+            binding::EventLoan loan;
+            loan.service_id = service_id_;
+            loan.instance_id = instance_id_;
+            loan.event_id = event_id_;
+            loan.payload = payload;
+            loan.size = sizeof(SampleType);
+            loan.handle = handle;
+            return loan;
+        }
+
+        binding::ITransportBinding* transport_{nullptr};
+        uint64_t service_id_{0};
+        uint64_t instance_id_{0};
+        uint32_t event_id_{0};
+    };
+
+    /**
+     * @brief Non trivially copyable samples: no loans, the event keeps its pool
+     */
+    template<typename SampleType>
+    class LoanedEventChannel<SampleType, false> final : public SampleStorage
+    {
+    public:
+        Result<void> Attach(binding::ITransportBinding&, uint64_t, uint64_t, uint32_t) noexcept
+        {
+            return Result<void>::FromError(MakeErrorCode(ComErrc::kNotSupported, 0));
+        }
+
+        [[nodiscard]] bool IsAttached() const noexcept
+        {
+            return false;
+        }
+
+        SampleAllocateePtr<SampleType> Allocate() noexcept
+        {
+            return SampleAllocateePtr<SampleType>();
+        }
+
+        Result<void> Send(SampleAllocateePtr<SampleType>) noexcept
+        {
+            return Result<void>::FromError(MakeErrorCode(ComErrc::kNotSupported, 0));
+        }
+
+        void Recycle(void*, void*) noexcept override {}
+    };
+
+    /**
+     * @brief Received event samples borrowed from transport memory
+     * @tparam SampleType Type of event data
+     *
+     * @details Adopt() turns a payload delivered by
+     *          ITransportBinding::SubscribeLoanedEvent() into a SamplePtr that
+     *          points into transport memory. The receive handle travels in the
+     *          SampleDeleter context; the channel is the deleter's SampleStorage
+     *          and returns the payload with ReleaseReceivedEvent(). Payloads not
+     *          aligned for SampleType are copied into an allocated sample instead.
+     *          The channel must outlive every sample it adopted.
+     */
+    template<typename SampleType, bool = std::is_trivially_copyable<SampleType>::value>
+    class BorrowedEventChannel final : public SampleStorage
+    {
+    public:
+        BorrowedEventChannel() noexcept = default;
+
+        BorrowedEventChannel(const BorrowedEventChannel&) = delete;
+        BorrowedEventChannel& operator=(const BorrowedEventChannel&) = delete;
+
+        /**
+         * @brief Bind to the event of a service instance
+         * @return kNotSupported if the binding has no zero-copy path
+         */
+        Result<void> Attach(binding::ITransportBinding& transport, uint64_t serviceId,
+                            uint64_t instanceId, uint32_t eventId) noexcept
+        {
+            if (!transport.SupportsZeroCopy()) {
+                return Result<void>::FromError(MakeErrorCode(ComErrc::kNotSupported, 0));
+            }
+            transport_ = &transport;
+            service_id_ = serviceId;
+            instance_id_ = instanceId;
+            event_id_ = eventId;
+            return Result<void>::FromValue();
+        }
+
+        [[nodiscard]] bool IsAttached() const noexcept
+        {
+            return transport_ != nullptr;
+        }
+
+        /**
+         * @brief Samples the transport lets this subscriber hold at once
+         * @return Borrow limit, 0 if unbounded
+         */
+        [[nodiscard]] uint32_t MaxBorrowed() const noexcept
+        {
+            return (transport_ != nullptr) ? transport_->GetMaxBorrowedSamples() : 0;
+        }
+
+        /**
+         * @brief Start delivery: every received payload is passed to @p deliver
+         * @param deliver Called on the binding thread with a loan to Adopt()
+         */
+        Result<void> Subscribe(binding::LoanedEventCallback deliver) noexcept
+        {
+            if (transport_ == nullptr) {
+                return Result<void>::FromError(MakeErrorCode(ComErrc::kNotInitialized, 0));
+            }
+            return transport_->SubscribeLoanedEvent(service_id_, instance_id_, event_id_, std::move(deliver));
+        }
+
+        /**
+         * @brief Stop delivery; returns once the binding no longer calls back
+         */
+        void Detach() noexcept
+        {
+            if (transport_ != nullptr) {
+                (void)transport_->UnsubscribeEvent(service_id_, instance_id_, event_id_);
+            }
+        }
+
+        /**
+         * @brief Take ownership of a received payload
+         * @param allocate Returns a SampleAllocateePtr for the copy fallback
+         * @return Sample in transport memory, a copy if the payload is misaligned,
+         *         empty (payload already released) if its size does not match
+         */
+        template<typename Allocate>
+        SamplePtr<SampleType> Adopt(binding::EventLoan& loan, Allocate&& allocate) noexcept
+        {
+            if (loan.size != sizeof(SampleType) || loan.payload == nullptr) {
+                transport_->ReleaseReceivedEvent(loan);
+                return SamplePtr<SampleType>();
+            }
+            if (reinterpret_cast<std::uintptr_t>(loan.payload) % alignof(SampleType) == 0) {
+                const SampleType* sample = std::launder(reinterpret_cast<const SampleType*>(loan.payload));
+                return SamplePtr<SampleType>(sample, SampleDeleter<const SampleType>(this, loan.handle));
+            }
+            SampleAllocateePtr<SampleType> copy = allocate();
+            if (copy) {
+                std::memcpy(copy.get(), loan.payload, sizeof(SampleType));
+            }
+            transport_->ReleaseReceivedEvent(loan);
+            return SamplePtr<SampleType>(std::move(copy));
+        }
+
+        /// SampleDeleter: application dropped a borrowed sample
+        void Recycle(void* sample, void* context) noexcept override
+        {
+            binding::EventLoan loan;
+            loan.service_id = service_id_;
+            loan.instance_id = instance_id_;
+            loan.event_id = event_id_;
+            loan.payload = sample;
+            loan.size = sizeof(SampleType);
+            loan.handle = context;
+            transport_->ReleaseReceivedEvent(loan);
+        }
+
+    private:
+        binding::ITransportBinding* transport_{nullptr};
+        uint64_t service_id_{0};
+        uint64_t instance_id_{0};
+        uint32_t event_id_{0};
+    };
+
+    /**
+     * @brief Non trivially copyable samples: no borrowing, the event keeps its binding
+     */
+    template<typename SampleType>
+    class BorrowedEventChannel<SampleType, false> final : public SampleStorage
+    {
+    public:
+        Result<void> Attach(binding::ITransportBinding&, uint64_t, uint64_t, uint32_t) noexcept
+        {
+            return Result<void>::FromError(MakeErrorCode(ComErrc::kNotSupported, 0));
+        }
+
+        [[nodiscard]] bool IsAttached() const noexcept
+        {
+            return false;
+        }
+
+        [[nodiscard]] uint32_t MaxBorrowed() const noexcept
+        {
+            return 0;
+        }
+
+        Result<void> Subscribe(binding::LoanedEventCallback) noexcept
+        {
+            return Result<void>::FromError(MakeErrorCode(ComErrc::kNotSupported, 0));
+        }
+
+        void Detach() noexcept {}
+
+        template<typename Allocate>
+        SamplePtr<SampleType> Adopt(binding::EventLoan&, Allocate&&) noexcept
+        {
+            return SamplePtr<SampleType>();
+        }
+
+        void Recycle(void*, void*) noexcept override {}
+    };
+
+} // namespace com
+} // namespace lap
+
+#endif // LAP_COM_LOANED_EVENT_CHANNEL_HPP
@@ -182,22 +182,40 @@ namespace com
      * @param service_id Service identifier (0x0001 - 0x3fff for QM+AB)
      * @param instance_id Instance identifier (0x0001 - 0xfffe)
      * @param network_binding Network binding type (0-255)
+     * @param heartbeat_interval_ms Heartbeat interval of the instance
+     *        (0 = registry default: 100 ms QM, 50 ms ASIL)
      * @return Result indicating success or error
      * @note AUTOSAR SWS_CM_00001 OfferService backend implementation
+     * @note The heartbeat worker refreshes the slot at this interval
      */
     LAP_COM_API Result<void> RegisterService(
         lap::core::UInt16 service_id,
         lap::core::UInt16 instance_id,
-        lap::core::UInt8 network_binding) noexcept;
+        lap::core::UInt8 network_binding,
+        lap::core::UInt32 heartbeat_interval_ms = 0) noexcept;
     
     /**
      * @brief Find a service instance by service ID
      * @param service_id Service identifier to search for
+     * @param live_only Skip instances whose heartbeat is older than 3× their interval
      * @return Optional containing ServiceSlot if found, empty otherwise
      * @note AUTOSAR SWS_CM_00002 FindService backend implementation
      * @note Performance: P99 < 150ns (verified in Week 2 testing)
      */
-    LAP_COM_API lap::core::Optional<registry::ServiceSlot> FindService(lap::core::UInt16 service_id) noexcept;
+    LAP_COM_API lap::core::Optional<registry::ServiceSlot> FindService(
+        lap::core::UInt16 service_id, bool live_only = false) noexcept;
+    
+    /**
+     * @brief Find a service instance and report why none was returned
+     * @param service_id Service identifier to search for
+     * @param live_only Skip instances whose heartbeat is older than 3× their interval
+     * @return Result containing the ServiceSlot, or kServiceNotAvailable (not offered),
+     *         kRegistryContended (registry entry write-locked beyond the reader
+     *         backoff: retry, do not tear down connections), kInvalidArgument,
+     *         kNotInitialized
+     */
+    LAP_COM_API Result<registry::ServiceSlot> LookupService(
+        lap::core::UInt16 service_id, bool live_only = false) noexcept;
     
     /**
      * @brief Unregister a service instance from the registry
@@ -207,6 +225,27 @@ namespace com
      */
     LAP_COM_API Result<void> UnregisterService(lap::core::UInt16 service_id) noexcept;
     
+    /**
+     * @brief Get the registry generation relevant for a service ID
+     * @param service_id Service identifier (selects QM or ASIL registry)
+     * @return Generation counter (0 if runtime is not initialized)
+     * @note Pass the value to WaitForServiceChange() to detect later changes
+     */
+    LAP_COM_API lap::core::UInt32 GetServiceGeneration(lap::core::UInt16 service_id) noexcept;
+    
+    /**
+     * @brief Block until a service is registered/unregistered in the relevant registry
+     * @param service_id Service identifier (selects QM or ASIL registry)
+     * @param known_generation Generation returned by GetServiceGeneration()
+     * @param timeout_ms Maximum wait time in milliseconds
+     * @return Result with the new generation, or kTimeout
+     * @note Backend for StartFindService: futex wait instead of polling
+     */
+    LAP_COM_API Result<lap::core::UInt32> WaitForServiceChange(
+        lap::core::UInt16 service_id,
+        lap::core::UInt32 known_generation,
+        lap::core::UInt32 timeout_ms) noexcept;
+    
 } // namespace com
 } // namespace lap
 
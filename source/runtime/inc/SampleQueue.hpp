@@ -0,0 +1,209 @@
+/**
+ * @file        SampleQueue.hpp
+ * @author      LightAP Development Team
+ * @brief       Bounded lock-free sample queue for the event receive path
+ * @date        2025-11-20
+ * @details     Ring of cells with per-cell sequence numbers (D. Vyukov's bounded
+ *              queue). The binding listener thread pushes, the application thread
+ *              pops, and neither side takes a lock. When the ring is full the
+ *              producer drops the oldest sample (ProxyEvent semantics), so the
+ *              consumer side always claims cells with a CAS.
+ * @copyright   Copyright (c) 2025
+ * @note        Single consumer. One producer by default; SampleQueueProducers::kMultiple
+ *              for bindings that deliver from several threads.
+ */
+#ifndef LAP_COM_SAMPLE_QUEUE_HPP
+#define LAP_COM_SAMPLE_QUEUE_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace lap
+{
+namespace com
+{
+    /**
+     * @brief Number of threads allowed to push into a SampleQueue
+     */
+    enum class SampleQueueProducers : uint8_t
+    {
+        kSingle   = 0,  ///< One binding thread (plain store on the tail)
+        kMultiple = 1   ///< Several binding threads (CAS on the tail)
+    };
+
+    /**
+     * @brief Bounded lock-free FIFO with drop-oldest overflow
+     * @tparam T Element type (default constructible, nothrow movable, e.g. SamplePtr)
+     *
+     * @details Positions are 64-bit and never wrap in practice; a cell is free for
+     *          position p when its sequence equals p, and holds an element for p
+     *          when its sequence equals p + 1. The capacity does not have to be a
+     *          power of two, so Subscribe(maxSampleCount) maps to it exactly.
+     */
+    template<typename T>
+    class SampleQueue final
+    {
+        static_assert(std::is_default_constructible<T>::value, "SampleQueue element must be default constructible");
+        static_assert(std::is_nothrow_move_assignable<T>::value, "SampleQueue element must be nothrow movable");
+
+    public:
+        /**
+         * @brief Create an empty queue
+         * @param capacity Number of elements (>= 1)
+         * @param producers Producer mode
+         * @note Check IsValid(): the ring is allocated with nothrow new
+         */
+        explicit SampleQueue(uint32_t capacity, SampleQueueProducers producers = SampleQueueProducers::kSingle) noexcept
+            : cells_(new (std::nothrow) Cell[capacity == 0 ? 1 : capacity])
+            , capacity_(cells_ ? (capacity == 0 ? 1 : capacity) : 0)
+            , producers_(producers)
+        {
+            for (uint32_t i = 0; i < capacity_; ++i) {
+                cells_[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        SampleQueue(const SampleQueue&) = delete;
+        SampleQueue& operator=(const SampleQueue&) = delete;
+
+        [[nodiscard]] bool IsValid() const noexcept
+        {
+            return capacity_ != 0;
+        }
+
+        [[nodiscard]] uint32_t Capacity() const noexcept
+        {
+            return capacity_;
+        }
+
+        [[nodiscard]] SampleQueueProducers Producers() const noexcept
+        {
+            return producers_;
+        }
+
+        /**
+         * @brief Approximate number of queued elements
+         * @note Exact when neither side is running concurrently
+         */
+        [[nodiscard]] uint32_t Size() const noexcept
+        {
+            const uint64_t head = head_.load(std::memory_order_acquire);
+            const uint64_t tail = tail_.load(std::memory_order_acquire);
+            if (tail <= head) {
+                return 0;
+            }
+            const uint64_t size = tail - head;
+            return static_cast<uint32_t>(size < capacity_ ? size : capacity_);
+        }
+
+        /**
+         * @brief Enqueue without overwriting
+         * @return false if the ring is full (value is left untouched)
+         */
+        bool TryPush(T& value) noexcept
+        {
+            uint64_t pos = tail_.load(std::memory_order_relaxed);
+            Cell* cell = nullptr;
+            for (;;) {
+                cell = &cells_[pos % capacity_];
+                const uint64_t seq = cell->sequence.load(std::memory_order_acquire);
+                const int64_t diff = static_cast<int64_t>(seq - pos);
+                if (diff == 0) {
+                    if (producers_ == SampleQueueProducers::kSingle) {
+                        tail_.store(pos + 1, std::memory_order_relaxed);
+                        break;
+                    }
+                    if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        break;
+                    }
+                } else if (diff < 0) {
+                    return false;
+                } else {
+                    pos = tail_.load(std::memory_order_relaxed);
+                }
+            }
+            cell->value = std::move(value);
+            cell->sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Enqueue, dropping the oldest element(s) while the ring is full
+         * @return Number of elements dropped to make room
+         * @note Dropped elements are destroyed on the producer thread
+         */
+        uint32_t Push(T value) noexcept
+        {
+            uint32_t dropped = 0;
+            while (!TryPush(value)) {
+                T oldest;
+                if (TryPop(oldest)) {
+                    ++dropped;
+                }
+            }
+            return dropped;
+        }
+
+        /**
+         * @brief Dequeue the oldest element
+         * @return false if empty (or the next element is still being written)
+         */
+        bool TryPop(T& out) noexcept
+        {
+            uint64_t pos = head_.load(std::memory_order_relaxed);
+            Cell* cell = nullptr;
+            for (;;) {
+                cell = &cells_[pos % capacity_];
+                const uint64_t seq = cell->sequence.load(std::memory_order_acquire);
+                const int64_t diff = static_cast<int64_t>(seq - (pos + 1));
+                if (diff == 0) {
+                    // CAS even with one consumer: a producer may be dropping the oldest
+                    if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        break;
+                    }
+                } else if (diff < 0) {
+                    return false;
+                } else {
+                    pos = head_.load(std::memory_order_relaxed);
+                }
+            }
+            out = std::move(cell->value);
+            cell->value = T{};
+            cell->sequence.store(pos + capacity_, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Drop all queued elements (consumer side)
+         */
+        void Clear() noexcept
+        {
+            T value;
+            while (TryPop(value)) {
+                value = T{};
+            }
+        }
+
+    private:
+        struct Cell
+        {
+            std::atomic<uint64_t> sequence{0};
+            T value{};
+        };
+
+        std::unique_ptr<Cell[]> cells_;
+        uint32_t capacity_;
+        SampleQueueProducers producers_;
+
+        alignas(64) std::atomic<uint64_t> tail_{0};  ///< Next push position (producers)
+        alignas(64) std::atomic<uint64_t> head_{0};  ///< Next pop position (consumer)
+    };
+
+} // namespace com
+} // namespace lap
+
+#endif // LAP_COM_SAMPLE_QUEUE_HPP
@@ -0,0 +1,317 @@
+/**
+ * @file        SharedFieldValue.hpp
+ * @author      LightAP Development Team
+ * @brief       Field value published in shared memory (latest value wins)
+ * @date        2025-11-20
+ * @details     The skeleton side of a field publishes each Update() into a POSIX
+ *              shared memory object holding a registry::SeqLocked<T, N>; proxies on
+ *              the same host map it read-only and serve Get() without a transport
+ *              round trip. Intended for state signals (vehicle state, pose) whose
+ *              consumers only need the newest value.
+ * @copyright   Copyright (c) 2025
+ * @note        Only trivially copyable field types can be shared; for other types
+ *              Create()/Open() return kNotSupported and the field keeps using its
+ *              transport binding.
+ */
+#ifndef LAP_COM_SHARED_FIELD_VALUE_HPP
+#define LAP_COM_SHARED_FIELD_VALUE_HPP
+
+#include "ComTypes.hpp"
+#include "SeqLock.hpp"
+#include <core/CResult.hpp>
+
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <new>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace lap
+{
+namespace com
+{
+    /// Buffer size for MakeSharedFieldName()
+    constexpr size_t FIELD_NAME_SIZE = 32;
+
+    /**
+     * @brief Shared memory object name of one field instance
+     * @param buffer Output buffer
+     * @return buffer, e.g. "/lap_com_field_0100_0001_0003"
+     */
+    inline const char* MakeSharedFieldName(char (&buffer)[FIELD_NAME_SIZE], lap::core::UInt16 service_id,
+                                           lap::core::UInt16 instance_id, lap::core::UInt16 field_id) noexcept
+    {
+        std::snprintf(buffer, FIELD_NAME_SIZE, "/lap_com_field_%04x_%04x_%04x",
+                      static_cast<unsigned>(service_id), static_cast<unsigned>(instance_id),
+                      static_cast<unsigned>(field_id));
+        return buffer;
+    }
+
+    /**
+     * @brief Field value in a named shared memory object
+     * @tparam FieldType Type of field data
+     * @tparam N Buffers in the version ring (see registry::SeqLocked)
+     *
+     * @details One writer (Create(), guarded by an exclusive flock on the
+     *          object) and any number of readers (Open(), read-only mapping).
+     *          The object outlives the writer, so a restarted skeleton resumes
+     *          the version sequence and proxies keep the last value meanwhile;
+     *          Unlink() removes it.
+     */
+    template<typename FieldType, uint32_t N = 2, bool = std::is_trivially_copyable<FieldType>::value>
+    class SharedFieldValue final
+    {
+    public:
+        static constexpr uint32_t MAGIC = 0x4C434656U;  ///< "LCFV"
+        static constexpr uint32_t LAYOUT_VERSION = 1;
+
+        /**
+         * @brief Mapped object: header followed by the seqlocked value
+         */
+        struct Region
+        {
+            std::atomic<uint32_t> magic;  ///< MAGIC once formatted (stored last)
+            uint32_t layout_version;
+            uint32_t value_size;          ///< sizeof(FieldType) of the writer
+            uint32_t buffer_count;        ///< N of the writer
+            registry::SeqLocked<FieldType, N> value;
+        };
+
+        SharedFieldValue() noexcept = default;
+
+        ~SharedFieldValue() noexcept
+        {
+            Close();
+        }
+
+        SharedFieldValue(const SharedFieldValue&) = delete;
+        SharedFieldValue& operator=(const SharedFieldValue&) = delete;
+
+        /**
+         * @brief Create (or take over) the object as its single writer
+         * @param name Object name, see MakeSharedFieldName()
+         * @return kInvalidState if another writer holds the object,
+         *         kSharedMemory* errors on system call failure
+         */
+        Result<void> Create(const char* name) noexcept
+        {
+            Close();
+
+            const int fd = shm_open(name, O_CREAT | O_RDWR | O_CLOEXEC, 0660);
+            if (fd < 0) {
+                return Result<void>::FromError(MakeErrorCode(ComErrc::kSharedMemoryCreationFailed, errno));
+            }
+            if (flock(fd, LOCK_EX | LOCK_NB) != 0) {
+                const int err = errno;
+                close(fd);
+                return Result<void>::FromError(MakeErrorCode(ComErrc::kInvalidState, err));
+            }
+            if (ftruncate(fd, static_cast<off_t>(sizeof(Region))) != 0) {
+                const int err = errno;
+                close(fd);
+                return Result<void>::FromError(MakeErrorCode(ComErrc::kSharedMemoryResizeFailed, err));
+            }
+
+            void* addr = mmap(nullptr, sizeof(Region), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            if (addr == MAP_FAILED) {
+                const int err = errno;
+                close(fd);
+                return Result<void>::FromError(MakeErrorCode(ComErrc::kSharedMemoryMappingFailed, err));
+            }
+
+            // Keep a compatible region of a previous writer (value and versions survive)
+            region_ = static_cast<Region*>(addr);
+            if (!IsCompatible(*region_)) {
+                region_->magic.store(0, std::memory_order_relaxed);
+                new (&region_->value) registry::SeqLocked<FieldType, N>();
+                region_->layout_version = LAYOUT_VERSION;
+                region_->value_size = static_cast<uint32_t>(sizeof(FieldType));
+                region_->buffer_count = N;
+                region_->magic.store(MAGIC, std::memory_order_release);
+            }
+            fd_ = fd;  // Holds the writer lock until Close()
+            return Result<void>::FromValue();
+        }
+
+        /**
+         * @brief Map an existing object read-only
+         * @param name Object name, see MakeSharedFieldName()
+         * @return kServiceNotAvailable if no writer created it yet,
+         *         kInvalidArgument if it holds a different type/layout
+         */
+        Result<void> Open(const char* name) noexcept
+        {
+            Close();
+
+            const int fd = shm_open(name, O_RDONLY | O_CLOEXEC, 0);
+            if (fd < 0) {
+                const ComErrc errc = (errno == ENOENT) ? ComErrc::kServiceNotAvailable
+                                   : (errno == EACCES) ? ComErrc::kPermissionDenied
+                                                       : ComErrc::kSharedMemoryMappingFailed;
+                return Result<void>::FromError(MakeErrorCode(errc, errno));
+            }
+
+            struct stat st{};
+            if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(Region)) {
+                close(fd);
+                return Result<void>::FromError(MakeErrorCode(ComErrc::kServiceNotAvailable, 0));
+            }
+
+            void* addr = mmap(nullptr, sizeof(Region), PROT_READ, MAP_SHARED, fd, 0);
+            const int err = errno;
+            close(fd);
+            if (addr == MAP_FAILED) {
+                return Result<void>::FromError(MakeErrorCode(ComErrc::kSharedMemoryMappingFailed, err));
+            }
+
+            if (!IsCompatible(*static_cast<const Region*>(addr))) {
+                munmap(addr, sizeof(Region));
+                return Result<void>::FromError(MakeErrorCode(ComErrc::kInvalidArgument, 0));
+            }
+            region_ = static_cast<Region*>(addr);
+            return Result<void>::FromValue();
+        }
+
+        /**
+         * @brief Unmap (and release the writer lock)
+         */
+        void Close() noexcept
+        {
+            if (region_ != nullptr) {
+                munmap(region_, sizeof(Region));
+                region_ = nullptr;
+            }
+            if (fd_ >= 0) {
+                close(fd_);
+                fd_ = -1;
+            }
+        }
+
+        /**
+         * @brief Remove the object name (mapped instances stay valid)
+         */
+        static void Unlink(const char* name) noexcept
+        {
+            shm_unlink(name);
+        }
+
+        [[nodiscard]] bool IsOpen() const noexcept
+        {
+            return region_ != nullptr;
+        }
+
+        [[nodiscard]] bool IsWriter() const noexcept
+        {
+            return fd_ >= 0;
+        }
+
+        /**
+         * @brief Publish a new value
+         * @return kInvalidState if not opened with Create()
+         */
+        Result<void> Store(const FieldType& value) noexcept
+        {
+            if (!IsWriter()) {
+                return Result<void>::FromError(MakeErrorCode(ComErrc::kInvalidState, 0));
+            }
+            region_->value.Store(value);
+            return Result<void>::FromValue();
+        }
+
+        /**
+         * @brief Copy the newest value
+         * @return kNotInitialized if not open, kFieldValueIsNotValid if never
+         *         written, kTimeout if the writer kept lapping the version ring
+         */
+        Result<FieldType> Load() const noexcept
+        {
+            if (!IsOpen()) {
+                return Result<FieldType>::FromError(MakeErrorCode(ComErrc::kNotInitialized, 0));
+            }
+
+            FieldType value{};
+            uint32_t retries = 0;
+            if (region_->value.Load(value, retries) == 0) {
+                const ComErrc errc = registry::SeqLockReader::GaveUp(retries) ? ComErrc::kTimeout
+                                                                              : ComErrc::kFieldValueIsNotValid;
+                return Result<FieldType>::FromError(MakeErrorCode(errc, 0));
+            }
+            return Result<FieldType>::FromValue(value);
+        }
+
+        /**
+         * @brief Newest published version (0 = never written or not open)
+         */
+        [[nodiscard]] uint64_t Version() const noexcept
+        {
+            return IsOpen() ? region_->value.Version() : 0;
+        }
+
+    private:
+        static bool IsCompatible(const Region& region) noexcept
+        {
+            return region.magic.load(std::memory_order_acquire) == MAGIC &&
+                   region.layout_version == LAYOUT_VERSION &&
+                   region.value_size == sizeof(FieldType) &&
+                   region.buffer_count == N;
+        }
+
+        Region* region_{nullptr};
+        int fd_{-1};  ///< Writer only: locked object descriptor
+    };
+
+    /**
+     * @brief Non-shareable field types: every operation reports kNotSupported
+     */
+    template<typename FieldType, uint32_t N>
+    class SharedFieldValue<FieldType, N, false> final
+    {
+    public:
+        Result<void> Create(const char*) noexcept
+        {
+            return Result<void>::FromError(MakeErrorCode(ComErrc::kNotSupported, 0));
+        }
+
+        Result<void> Open(const char*) noexcept
+        {
+            return Result<void>::FromError(MakeErrorCode(ComErrc::kNotSupported, 0));
+        }
+
+        void Close() noexcept {}
+
+        [[nodiscard]] bool IsOpen() const noexcept
+        {
+            return false;
+        }
+
+        [[nodiscard]] bool IsWriter() const noexcept
+        {
+            return false;
+        }
+
+        Result<void> Store(const FieldType&) noexcept
+        {
+            return Result<void>::FromError(MakeErrorCode(ComErrc::kNotSupported, 0));
+        }
+
+        Result<FieldType> Load() const noexcept
+        {
+            return Result<FieldType>::FromError(MakeErrorCode(ComErrc::kNotSupported, 0));
+        }
+
+        [[nodiscard]] uint64_t Version() const noexcept
+        {
+            return 0;
+        }
+    };
+
+} // namespace com
+} // namespace lap
+
+#endif // LAP_COM_SHARED_FIELD_VALUE_HPP
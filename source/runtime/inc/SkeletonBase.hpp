@@ -180,6 +180,19 @@ namespace com
             return m_processingMode;
         }
         
+        /**
+         * @brief Propagate the offered state to one of the skeleton's events
+         * @param event SkeletonEvent member of the derived skeleton
+         * @param offered Offering state
+         * @note For DoOfferService()/DoStopOfferService(): Send() fails with
+         *       kServiceNotOffered until the event is marked offered
+         */
+        template<typename EventType>
+        static void SetEventOffered(EventType& event, bool offered) noexcept
+        {
+            event.SetOffered(offered);
+        }
+        
         /**
          * @brief Implementation-specific service offering
          * @return Result indicating success or error
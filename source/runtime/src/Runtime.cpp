@@ -32,17 +32,20 @@
 
 #include "Runtime.hpp"
 #include "SharedMemoryRegistry.hpp"
+#include "HeartbeatTimerWheel.hpp"
 #include "ComTypes.hpp"
 
 #include <thread>
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <iostream>  // Temporary for logging until lap_log integration
 
 // Unix socket and file descriptor passing
 #include <sys/socket.h>
 #include <sys/un.h>
 #include <unistd.h>
+#include <cstdlib>  // getenv
 #include <cstring>  // memset
 
 namespace lap
@@ -59,28 +62,104 @@ namespace com
     static std::atomic<bool> g_initialized{false};
     static std::mutex g_init_mutex;
     
+    // Slots offered by this process (guarded by g_heartbeat_mutex)
+    static std::mutex g_heartbeat_mutex;
+    static std::condition_variable g_heartbeat_cv;
+    static registry::HeartbeatTimerWheel g_heartbeat_wheel;
+    
     // ========================================================================
-    // Heartbeat daemon thread (100ms interval)
+    // Heartbeat daemon thread (per-slot heartbeat_interval_ms)
     // ========================================================================
     
     /**
      * @brief Heartbeat worker thread function
-     * @details Periodically updates heartbeat timestamp in service registry
-     *          to indicate runtime is alive. AUTOSAR SWS_CM_00125.
-     * @note Week 3 v1.0: Placeholder implementation (full heartbeat in v1.1)
+     * @details Refreshes last_heartbeat_ns of every slot offered by this process.
+     *          AUTOSAR SWS_CM_00125.
+     * 
+     * Loop:
+     * 1. Collect all slots due now from the timer wheel
+     * 2. Refresh them in one batched pass with a single steady-clock timestamp
+     * 3. Sleep until the next deadline (or until a service is offered/withdrawn)
+     * 
+     * After an online registry resize the targets are re-resolved, since the
+     * successor registry places every instance in a different slot. The
+     * refresh itself runs without g_heartbeat_mutex; targets scheduled in the
+     * meantime are re-resolved together with the rest under the lock.
+     * 
+     * @note Idle (no offered services) the thread blocks without waking up
      */
     static void HeartbeatWorker() noexcept
     {
         using namespace std::chrono;
         
+        lap::core::Vector<registry::HeartbeatTarget> due;
+        std::unique_lock<std::mutex> lock(g_heartbeat_mutex);
+        uint32_t bound_refresh_count = g_dual_registry->GetRefreshCount();
+        
         while (g_heartbeat_running.load(std::memory_order_acquire))
         {
-            // TODO Week 3 v1.1: Implement per-service heartbeat updates
-            // For now, just keep thread alive to validate threading infrastructure
+            if (g_heartbeat_wheel.Size() != 0 && g_dual_registry->NeedsRefresh())
+            {
+                // Refresh() may wait for a migrating writer: do not block
+                // OfferService/StopOfferService on the heartbeat mutex meanwhile
+                lock.unlock();
+                g_dual_registry->Refresh();
+                lock.lock();
+            }
+            const uint32_t refresh_count = g_dual_registry->GetRefreshCount();
+            if (refresh_count != bound_refresh_count)
+            {
+                bound_refresh_count = refresh_count;
+                g_heartbeat_wheel.ForEach([](registry::HeartbeatTarget& target) {
+                    g_dual_registry->ResolveHeartbeatTarget(target);
+                });
+            }
             
-            // Sleep 100ms (configurable via AUTOSAR manifest)
-            std::this_thread::sleep_for(milliseconds(100));
+            const uint64_t now_ns = static_cast<uint64_t>(
+                duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count());
+            
+            due.clear();
+            g_heartbeat_wheel.Collect(now_ns / 1000000, due);
+            if (!due.empty())
+            {
+                g_dual_registry->UpdateHeartbeats(due, now_ns);
+            }
+            
+            const uint64_t deadline_ms = g_heartbeat_wheel.NextDeadlineMs();
+            if (deadline_ms == registry::HeartbeatTimerWheel::NO_DEADLINE)
+            {
+                g_heartbeat_cv.wait(lock);
+            }
+            else
+            {
+                g_heartbeat_cv.wait_until(lock, steady_clock::time_point(milliseconds(deadline_ms)));
+            }
+        }
+    }
+    
+    /**
+     * @brief Start refreshing the heartbeat of a newly registered instance
+     */
+    static void ScheduleHeartbeat(lap::core::UInt16 service_id, lap::core::UInt16 instance_id) noexcept
+    {
+        using namespace std::chrono;
+        
+        lap::core::Vector<registry::HeartbeatTarget> targets;
+        if (!g_dual_registry->GetHeartbeatTargets(service_id, instance_id, targets).HasValue())
+        {
+            return;
+        }
+        
+        const uint64_t now_ms = static_cast<uint64_t>(
+            duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count());
+        {
+            std::lock_guard<std::mutex> lock(g_heartbeat_mutex);
+            for (const auto& target : targets)
+            {
+                g_heartbeat_wheel.Schedule(target, now_ms);
+            }
         }
+        g_heartbeat_cv.notify_one();
     }
     
     // ========================================================================
@@ -98,7 +177,8 @@ namespace com
      * 
      * Initialization sequence (systemd socket activation mode):
      * 1. Mutex-protected state check (prevent double initialization)
-     * 2. Create SharedMemoryRegistry instance
+     * 2. Create SharedMemoryRegistry instance, load its routing table
+     *    ($LAP_COM_REGISTRY_ROUTING or /etc/lap/com/slot_mapping.yaml)
      * 3. Connect to systemd sockets:
      *    - QM socket: /run/lap/registry_qm.sock (QM+AB services)
      *    - ASIL socket: /run/lap/registry_asil.sock (ASIL-CD services)
@@ -107,9 +187,9 @@ namespace com
      *    - QM: 1024 slots × 256 bytes = 256KB (world-readable)
      *    - ASIL: 1024 slots × 256 bytes = 256KB (controlled access)
      *    - Physical isolation: separate inodes (verified via inode comparison)
-     * 6. Start heartbeat daemon thread (100ms interval)
-     *    - Monitors registered services (PID liveness check)
-     *    - Updates heartbeat timestamps (Phase 2 implementation)
+     * 6. Start heartbeat daemon thread
+     *    - Refreshes heartbeat timestamps of offered services
+     *    - Per-slot heartbeat_interval_ms scheduled by a timer wheel
      * 7. Set g_initialized flag
      * 
      * Thread-safety: Mutex-protected, safe for concurrent calls
@@ -134,6 +214,35 @@ namespace com
         // Create dual-registry instance (QM+ASIL)
         g_dual_registry = std::make_unique<registry::SharedMemoryRegistry>();
         
+        // Optional pre-faulting / locking of the registry mapping (page tables are
+        // per process, so every client opts in itself); unknown options are ignored
+        registry::RegistryMemoryOptions memory_options;
+        if (registry::RegistryMemoryOptions::Parse(
+                std::getenv(registry::RegistryMemoryOptions::ENV_VAR), memory_options))
+        {
+            g_dual_registry->SetMemoryOptions(memory_options);
+        }
+        
+        // service_id → registry routing: an explicitly configured file must load,
+        // the system-wide default is optional (built-in ranges otherwise)
+        const char* routing_path = std::getenv(registry::RegistryRoutingTable::ENV_VAR);
+        if (routing_path == nullptr &&
+            access(registry::RegistryRoutingTable::DEFAULT_CONFIG_PATH, R_OK) == 0)
+        {
+            routing_path = registry::RegistryRoutingTable::DEFAULT_CONFIG_PATH;
+        }
+        if (routing_path != nullptr)
+        {
+            auto routing = std::make_unique<registry::RegistryRoutingTable>();
+            auto routing_result = routing->Load(routing_path);
+            if (!routing_result.HasValue())
+            {
+                g_dual_registry.reset();
+                return routing_result;
+            }
+            g_dual_registry->SetRoutingTable(*routing);
+        }
+        
         // Initialize from systemd sockets (dual-registry mode)
         auto init_result = g_dual_registry->InitializeFromSocket(
             "/run/lap/registry_qm.sock",
@@ -173,7 +282,7 @@ namespace com
      * Thread-safety: Mutex-protected, safe for concurrent calls
      * Idempotency: Returns kNotInitialized if already deinitialized
      * 
-     * @warning Blocks until heartbeat thread terminates (< 100ms)
+     * @warning Blocks until heartbeat thread terminates (woken immediately)
      * @warning Registered services persist in shared memory
      */
     Result<void> Runtime::Deinitialize() noexcept
@@ -189,7 +298,12 @@ namespace com
         // Stop heartbeat thread gracefully
         if (g_heartbeat_thread && g_heartbeat_running.load(std::memory_order_acquire))
         {
-            g_heartbeat_running.store(false, std::memory_order_release);
+            {
+                std::lock_guard<std::mutex> heartbeat_lock(g_heartbeat_mutex);
+                g_heartbeat_running.store(false, std::memory_order_release);
+                g_heartbeat_wheel.Clear();
+            }
+            g_heartbeat_cv.notify_one();
             
             if (g_heartbeat_thread->joinable())
             {
@@ -227,6 +341,7 @@ namespace com
      * @param service_id Service identifier (0x0001 - 0x3fff for QM+AB)
      * @param instance_id Instance identifier (0x0001 - 0xfffe)
      * @param network_binding Network binding type (0=iceoryx2, 1=dds, 2=socket, 3=dbus, 4=someip)
+     * @param heartbeat_interval_ms Heartbeat interval (0 = registry default)
      * @return Result<void> Success or error code
      * 
      * @note AUTOSAR SWS_CM_00001: OfferService backend implementation
@@ -250,7 +365,8 @@ namespace com
     Result<void> RegisterService(
         lap::core::UInt16 service_id,
         lap::core::UInt16 instance_id,
-        lap::core::UInt8 network_binding) noexcept
+        lap::core::UInt8 network_binding,
+        lap::core::UInt32 heartbeat_interval_ms) noexcept
     {
         // Pre-condition: Runtime must be initialized
         if (!Runtime::IsInitialized())
@@ -307,7 +423,13 @@ namespace com
             service_id, instance_id, 
             1, 0,  // Major version 1, minor version 0
             binding_str, 
-            "");  // Endpoint will be filled by Binding Manager (Phase 2)
+            "",  // Endpoint will be filled by Binding Manager (Phase 2)
+            heartbeat_interval_ms);
+        
+        if (result.HasValue())
+        {
+            ScheduleHeartbeat(service_id, instance_id);
+        }
         
         return result;
     }
@@ -319,10 +441,11 @@ namespace com
     /**
      * @brief Find a service instance by service ID (lock-free lookup)
      * @param service_id Service identifier to search for
+     * @param live_only Skip zombie instances (heartbeat older than 3× interval)
      * @return Optional<ServiceSlot> Containing service metadata if found, empty otherwise
      * 
      * @note AUTOSAR SWS_CM_00002: FindService backend implementation
-     * @note SERVICE_DISCOVERY_ARCHITECTURE.md §2.2: O(1) fixed-slot lookup
+     * @note SERVICE_DISCOVERY_ARCHITECTURE.md §2.2: bounded open-addressing lookup
      * @note Performance: 
      *       - Direct registry call: P99 = 129ns (Week 2 test_registry)
      *       - Runtime wrapper: P99 = 1348ns (Week 3 test_runtime)
@@ -331,25 +454,49 @@ namespace com
      * 
      * Lookup algorithm:
      * 1. Validate service_id range (< 50ns)
-     * 2. Calculate slot index: slot = service_id & 1023 (< 10ns)
+     * 2. Probe slot tags from home = FNV1A(service_id) (< 10ns)
      * 3. seqlock read from shared memory (< 100ns)
+     *    - skipped while the registry generation is unchanged (process-local cache)
+     *    - live_only: heartbeat checked against one cached CLOCK_MONOTONIC read
      * 4. Return ServiceSlot copy (< 50ns)
      * 
      * Thread-safety: Lock-free seqlock read, no blocking
      */
     lap::core::Optional<registry::ServiceSlot> FindService(
-        lap::core::UInt16 service_id) noexcept
+        lap::core::UInt16 service_id, bool live_only) noexcept
     {
-        // Fast-path: Check initialization without error object creation
-        if (!Runtime::IsInitialized())
+        auto result = LookupService(service_id, live_only);
+        if (!result.HasValue())
         {
             return lap::core::Optional<registry::ServiceSlot>{};
         }
+        return lap::core::Optional<registry::ServiceSlot>(result.Value());
+    }
+    
+    /**
+     * @brief Find a service instance, distinguishing "not offered" from contention
+     * @param service_id Service identifier to search for
+     * @param live_only Skip zombie instances (heartbeat older than 3× interval)
+     * @return Result<ServiceSlot> Service metadata, or the reason for a miss
+     * 
+     * @note kRegistryContended means a writer held the registry entry for the
+     *       whole reader backoff (SeqLockBackoff); callers should retry instead
+     *       of reacting as if the service had been withdrawn
+     */
+    Result<registry::ServiceSlot> LookupService(
+        lap::core::UInt16 service_id, bool live_only) noexcept
+    {
+        if (!Runtime::IsInitialized())
+        {
+            return Result<registry::ServiceSlot>::FromError(
+                MakeErrorCode(ComErrc::kNotInitialized, 0));
+        }
         
         // Defensive check (should never happen if initialized)
         if (!g_dual_registry)
         {
-            return lap::core::Optional<registry::ServiceSlot>{};
+            return Result<registry::ServiceSlot>::FromError(
+                MakeErrorCode(ComErrc::kInternal, 0));
         }
         
         // Fast validation: Service ID range check
@@ -361,12 +508,20 @@ namespace com
         
         if (!is_qm_range && !is_asil_range)
         {
-            return lap::core::Optional<registry::ServiceSlot>{};
+            return Result<registry::ServiceSlot>::FromError(
+                MakeErrorCode(ComErrc::kInvalidArgument, service_id));
+        }
+        
+        // Follow an online resize of the registry (two loads when nothing changed)
+        if (g_dual_registry->NeedsRefresh())
+        {
+            g_dual_registry->Refresh();
         }
         
         // Delegate to SharedMemoryRegistry (seqlock-protected read)
         // Performance: Direct shared memory access, no syscalls
-        return g_dual_registry->FindService(service_id);
+        return g_dual_registry->LookupService(
+            service_id, live_only ? registry::Liveness::LIVE_ONLY : registry::Liveness::ANY);
     }
     
     // ========================================================================
@@ -384,9 +539,11 @@ namespace com
      * 
      * Unregistration sequence:
      * 1. Validate service_id range
-     * 2. Calculate slot index (service_id & 1023)
-     * 3. seqlock-protected write to clear slot (set status = 0)
-     * 4. Return success
+     * 2. Locate the instance offered by this process (timer wheel, else
+     *    owner_pid match) and withdraw its heartbeat
+     * 3. Remove exactly that instance (instance-aware unregister)
+     * 4. seqlock-protected write to clear slot (set status = 0)
+     * 5. Return success
      * 
      * Slot state after unregistration:
      * - ServiceSlot::status = 0 (SLOT_FREE)
@@ -424,7 +581,98 @@ namespace com
                 MakeErrorCode(ComErrc::kInvalidArgument, service_id));
         }
         
-        return g_dual_registry->UnregisterService(service_id);
+        // Resolve the instance from this process's own offers: other processes
+        // may offer further instances of the same service
+        lap::core::Optional<uint64_t> instance_id;
+        {
+            std::lock_guard<std::mutex> lock(g_heartbeat_mutex);
+            instance_id = g_heartbeat_wheel.FindInstance(service_id);
+            if (instance_id.has_value())
+            {
+                g_heartbeat_wheel.Cancel(service_id, instance_id.value());
+            }
+        }
+        
+        // Offered without a scheduled heartbeat: match the owner PID instead
+        if (!instance_id.has_value())
+        {
+            const pid_t self = getpid();
+            for (const auto& instance : g_dual_registry->FindAllInstances(service_id))
+            {
+                if (instance.owner_pid == self)
+                {
+                    instance_id = instance.instance_id;
+                    break;
+                }
+            }
+        }
+        
+        if (!instance_id.has_value())
+        {
+            return Result<void>::FromError(
+                MakeErrorCode(ComErrc::kServiceNotAvailable, 0));
+        }
+        
+        return g_dual_registry->UnregisterService(service_id, instance_id.value());
+    }
+    
+    // ========================================================================
+    // Registry Change Notification API
+    // ========================================================================
+    
+    /**
+     * @brief Get the registry generation relevant for a service ID
+     * @param service_id Service identifier
+     * @return Generation counter (0 if runtime is not initialized)
+     */
+    lap::core::UInt32 GetServiceGeneration(lap::core::UInt16 service_id) noexcept
+    {
+        if (!Runtime::IsInitialized() || !g_dual_registry)
+        {
+            return 0;
+        }
+        
+        if (g_dual_registry->NeedsRefresh())
+        {
+            g_dual_registry->Refresh();
+        }
+        
+        return g_dual_registry->GetGeneration(service_id);
+    }
+    
+    /**
+     * @brief Block until the registry of service_id changes
+     * @param service_id Service identifier
+     * @param known_generation Generation returned by GetServiceGeneration()
+     * @param timeout_ms Maximum wait time in milliseconds
+     * @return Result<UInt32> New generation or kTimeout
+     * 
+     * Typical StartFindService loop:
+     * 1. gen = GetServiceGeneration(id)
+     * 2. FindService(id) → report availability
+     * 3. WaitForServiceChange(id, gen, timeout) → back to 1
+     * 
+     * Thread-safety: Futex wait on shared memory, no process-local locks
+     */
+    Result<lap::core::UInt32> WaitForServiceChange(
+        lap::core::UInt16 service_id,
+        lap::core::UInt32 known_generation,
+        lap::core::UInt32 timeout_ms) noexcept
+    {
+        if (!Runtime::IsInitialized())
+        {
+            return Result<lap::core::UInt32>::FromError(
+                MakeErrorCode(ComErrc::kNotInitialized, 0));
+        }
+        
+        if (!g_dual_registry)
+        {
+            return Result<lap::core::UInt32>::FromError(
+                MakeErrorCode(ComErrc::kInternal, 0));
+        }
+        
+        return g_dual_registry->WaitForChange(
+            service_id, known_generation, std::chrono::milliseconds(timeout_ms));
     }
     
 } // namespace com
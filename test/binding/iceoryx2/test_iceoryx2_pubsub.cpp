@@ -9,6 +9,7 @@
 #include <chrono>
 #include <atomic>
 #include <cstring>
+#include <mutex>
 #include <vector>
 #include <cassert>
 
@@ -21,6 +22,9 @@ std::atomic<int> received_count{0};
 std::atomic<int> large_msg_count{0};
 std::atomic<int> multi_sub_count1{0};
 std::atomic<int> multi_sub_count2{0};
+std::atomic<int> loan_payload_ok{0};
+std::mutex borrowed_mutex;
+std::vector<EventLoan> borrowed_loans;
 
 // Callback for basic test
 void basicEventCallback(uint64_t service_id, uint64_t instance_id, uint32_t event_id, const ByteBuffer& data)
@@ -58,6 +62,28 @@ void multiSubCallback2(uint64_t, uint64_t, uint32_t, const ByteBuffer& data)
     std::cout << "  [Sub2] Received " << data.size() << " bytes" << std::endl;
 }
 
+// Callback for loaned (zero-copy) send test
+void loanCallback(uint64_t, uint64_t, uint32_t, const ByteBuffer& data)
+{
+    if (data.size() == 256 && data[0] == 0x5A && data[255] == 0xA5) {
+        loan_payload_ok.fetch_add(1);
+    }
+    received_count.fetch_add(1);
+}
+
+void borrowedCallback(EventLoan& loan)
+{
+    const auto* payload = static_cast<const uint8_t*>(loan.payload);
+    if (loan.size == 256 && payload[0] == 0x5A && payload[255] == 0xA5) {
+        loan_payload_ok.fetch_add(1);
+    }
+    received_count.fetch_add(1);
+
+    // Hold the sample; the test thread releases it
+    std::lock_guard<std::mutex> lock(borrowed_mutex);
+    borrowed_loans.push_back(loan);
+}
+
 // Test 1: Basic Pub/Sub
 bool test_basic_pubsub()
 {
@@ -365,6 +391,147 @@ bool test_cleanup_restart()
     return passed;
 }
 
+// Test 6: Zero-copy send through LoanEvent/SendLoanedEvent
+bool test_loaned_send()
+{
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "TEST 6: Loaned (Zero-Copy) Send" << std::endl;
+    std::cout << "========================================" << std::endl;
+    
+    received_count.store(0);
+    loan_payload_ok.store(0);
+    
+    Iceoryx2Binding publisher;
+    Iceoryx2Binding subscriber;
+
+    publisher.Initialize();
+    subscriber.Initialize();
+
+    const uint64_t service_id = 0x1006;
+    const uint64_t instance_id = 0x2006;
+    const uint32_t event_id = 0x3006;
+
+    publisher.OfferService(service_id, instance_id);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    
+    subscriber.SubscribeEvent(service_id, instance_id, event_id, loanCallback);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    std::cout << "1. Loaning, filling in place and sending 5 payloads..." << std::endl;
+    for (int i = 0; i < 5; i++) {
+        auto loan = publisher.LoanEvent(service_id, instance_id, event_id, 256);
+        if (!loan.HasValue()) {
+            std::cout << "   LoanEvent failed" << std::endl;
+            break;
+        }
+        auto* payload = static_cast<uint8_t*>(loan.Value().payload);
+        std::memset(payload, 0, 256);
+        payload[0] = 0x5A;
+        payload[255] = 0xA5;
+        publisher.SendLoanedEvent(loan.Value());
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    std::cout << "2. Releasing a loan without sending..." << std::endl;
+    auto unused = publisher.LoanEvent(service_id, instance_id, event_id, 16);
+    if (unused.HasValue()) {
+        publisher.ReleaseLoanedEvent(unused.Value());
+    }
+
+    auto too_large = publisher.LoanEvent(service_id, instance_id, event_id, 1024 * 1024);
+    std::cout << "3. Loan above publisher_max_slice_len rejected: "
+              << (too_large.HasValue() ? "no" : "yes") << std::endl;
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+    std::cout << "4. Results: Sent=5, Received=" << received_count.load()
+              << ", intact=" << loan_payload_ok.load() << std::endl;
+
+    subscriber.UnsubscribeEvent(service_id, instance_id, event_id);
+    publisher.StopOfferService(service_id, instance_id);
+    subscriber.Shutdown();
+    publisher.Shutdown();
+
+    bool passed = (received_count.load() == 5) && (loan_payload_ok.load() == 5) && unused.HasValue() &&
+                  !too_large.HasValue();
+    std::cout << "Result: " << (passed ? "✓ PASSED" : "✗ FAILED") << std::endl;
+    return passed;
+}
+
+// Test 7: Borrowed (Zero-Copy) Receive
+bool test_borrowed_receive()
+{
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "TEST 7: Borrowed (Zero-Copy) Receive" << std::endl;
+    std::cout << "========================================" << std::endl;
+    
+    received_count.store(0);
+    loan_payload_ok.store(0);
+    
+    Iceoryx2Binding publisher;
+    Iceoryx2Binding subscriber;
+
+    publisher.Initialize();
+    subscriber.Initialize();
+
+    const uint64_t service_id = 0x1007;
+    const uint64_t instance_id = 0x2007;
+    const uint32_t event_id = 0x3007;
+
+    publisher.OfferService(service_id, instance_id);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    
+    auto subscribed = subscriber.SubscribeLoanedEvent(service_id, instance_id, event_id, borrowedCallback);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    std::cout << "1. Sending 5 payloads, releasing borrowed samples from this thread..." << std::endl;
+    size_t released = 0;
+    for (int i = 0; i < 5; i++) {
+        auto loan = publisher.LoanEvent(service_id, instance_id, event_id, 256);
+        if (!loan.HasValue()) {
+            std::cout << "   LoanEvent failed" << std::endl;
+            break;
+        }
+        auto* payload = static_cast<uint8_t*>(loan.Value().payload);
+        std::memset(payload, 0, 256);
+        payload[0] = 0x5A;
+        payload[255] = 0xA5;
+        publisher.SendLoanedEvent(loan.Value());
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+        std::lock_guard<std::mutex> lock(borrowed_mutex);
+        for (auto& held : borrowed_loans) {
+            subscriber.ReleaseReceivedEvent(held);
+            released++;
+        }
+        borrowed_loans.clear();
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    {
+        std::lock_guard<std::mutex> lock(borrowed_mutex);
+        for (auto& held : borrowed_loans) {
+            subscriber.ReleaseReceivedEvent(held);
+            released++;
+        }
+        borrowed_loans.clear();
+    }
+    subscriber.UnsubscribeEvent(service_id, instance_id, event_id);
+
+    std::cout << "2. Results: Sent=5, Received=" << received_count.load()
+              << ", intact=" << loan_payload_ok.load() << ", released=" << released << std::endl;
+
+    publisher.StopOfferService(service_id, instance_id);
+    subscriber.Shutdown();
+    publisher.Shutdown();
+
+    bool passed = subscribed.HasValue() && (received_count.load() == 5) && (loan_payload_ok.load() == 5) &&
+                  (released == 5);
+    std::cout << "Result: " << (passed ? "✓ PASSED" : "✗ FAILED") << std::endl;
+    return passed;
+}
+
 int main()
 {
     std::cout << "==========================================" << std::endl;
@@ -372,13 +539,15 @@ int main()
     std::cout << "==========================================" << std::endl;
 
     int passed = 0;
-    int total = 5;
+    int total = 7;
 
     if (test_basic_pubsub()) passed++;
     if (test_multiple_messages()) passed++;
     if (test_multi_subscriber()) passed++;
     if (test_subscribe_before_offer()) passed++;
     if (test_cleanup_restart()) passed++;
+    if (test_loaned_send()) passed++;
+    if (test_borrowed_receive()) passed++;
 
     std::cout << "\n==========================================" << std::endl;
     std::cout << "  Test Summary" << std::endl;
@@ -0,0 +1,296 @@
+/**
+ * @file        benchmark_boot_storm.cpp
+ * @author      LightAP Development Team
+ * @brief       Boot-storm benchmark for the RegistryInitializer accept loop
+ * @date        2025-11-20
+ * @details     Simulates system start-up: N client processes are forked and held at
+ *              a pipe barrier, then released at once to connect to the registry
+ *              daemon (a forked RegistryInitializer), receive the memfd via
+ *              SCM_RIGHTS and map it (SingleRegistry::InitializeFromSocket()).
+ *              Reports the time until all clients are initialized and the
+ *              per-client latency distribution (P50/P99) measured from the
+ *              barrier release; the slowest client defines the all-init time.
+ * @copyright   Copyright (c) 2025
+ * @note        Not a pass/fail test (except for failed clients); compare runs per SoC.
+ * @reference   SERVICE_DISCOVERY_ARCHITECTURE.md §2.2.2
+ * sdk:
+ * platform:    Linux 5.10+
+ * project:     LightAP
+ * @version
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author          <th>Description
+ * <tr><td>2025/11/20  <td>1.0      <td>LightAP Team    <td>Initial boot-storm benchmark
+ * </table>
+ *
+ * @usage       bench_boot_storm [--clients=N] [--rounds=R] [--socket=PATH]
+ */
+
+#include "RegistryInitializer.hpp"
+#include "SharedMemoryRegistry.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+using namespace lap::com::registry;
+
+namespace
+{
+    struct Options
+    {
+        uint32_t clients = 200;   ///< Simultaneous client processes
+        uint32_t rounds = 3;      ///< Storms against the same daemon
+        std::string socket_path;  ///< Daemon socket (default: per-PID path in /tmp)
+    };
+
+    /**
+     * @brief Per-client result (lives in a MAP_SHARED anonymous mapping)
+     */
+    struct ClientResult
+    {
+        uint64_t done_ns;  ///< CLOCK_MONOTONIC when InitializeFromSocket() returned
+        uint32_t ok;       ///< 1 if the registry was mapped
+        uint32_t error;    ///< Error code value otherwise
+    };
+
+    RegistryInitializer* g_server = nullptr;
+
+    uint64_t NowNs() noexcept
+    {
+        struct timespec ts{};
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return static_cast<uint64_t>(ts.tv_sec) * 1000000000ULL + static_cast<uint64_t>(ts.tv_nsec);
+    }
+
+    void OnTerminate(int) noexcept
+    {
+        if (g_server != nullptr) {
+            g_server->Shutdown();
+        }
+    }
+
+    /**
+     * @brief Daemon process: serve the registry until SIGTERM
+     */
+    [[noreturn]] void RunServer(const Options& options)
+    {
+        RegistryInitializer server(RegistryType::QM, options.socket_path.c_str());
+        server.SetReapInterval(0);
+        if (!server.Initialize().HasValue()) {
+            std::fprintf(stderr, "RegistryInitializer::Initialize() failed\n");
+            _exit(EXIT_FAILURE);
+        }
+        g_server = &server;
+        std::signal(SIGTERM, OnTerminate);
+        const bool ok = server.Run().HasValue();
+        g_server = nullptr;
+        std::fprintf(stderr, "# daemon served %llu clients\n",
+                     static_cast<unsigned long long>(server.GetServedCount()));
+        std::fflush(stderr);
+        _exit(ok ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+
+    /**
+     * @brief Wait until the daemon accepts connections
+     */
+    bool WaitForServer(const std::string& socket_path)
+    {
+        for (int attempt = 0; attempt < 500; ++attempt) {
+            int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+            struct sockaddr_un addr{};
+            addr.sun_family = AF_UNIX;
+            std::strncpy(addr.sun_path, socket_path.c_str(), sizeof(addr.sun_path) - 1);
+            const bool connected =
+                connect(fd, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) == 0;
+            close(fd);
+            if (connected) {
+                return true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        return false;
+    }
+
+    /**
+     * @brief Client process: wait at the barrier, then initialize from the socket
+     */
+    [[noreturn]] void RunClient(const Options& options, int barrier_fd, ClientResult* result)
+    {
+        char byte = 0;
+        while (read(barrier_fd, &byte, 1) < 0 && errno == EINTR) {
+        }
+        close(barrier_fd);
+
+        SingleRegistry registry(RegistryType::QM);
+        auto init_result = registry.InitializeFromSocket(options.socket_path.c_str());
+        result->done_ns = NowNs();
+        result->ok = init_result.HasValue() ? 1U : 0U;
+        result->error = init_result.HasValue() ? 0U : static_cast<uint32_t>(init_result.Error().Value());
+        _exit(EXIT_SUCCESS);
+    }
+
+    uint64_t PercentileOf(const std::vector<uint64_t>& sorted, double percentile) noexcept
+    {
+        if (sorted.empty()) {
+            return 0;
+        }
+        const size_t rank = static_cast<size_t>(percentile / 100.0 * static_cast<double>(sorted.size() - 1));
+        return sorted[rank];
+    }
+
+    /**
+     * @brief Run one storm of options.clients simultaneous clients
+     * @return Number of failed clients
+     */
+    uint32_t RunRound(const Options& options, uint32_t round, ClientResult* results)
+    {
+        std::memset(results, 0, sizeof(ClientResult) * options.clients);
+
+        int barrier[2];
+        if (pipe2(barrier, O_CLOEXEC) != 0) {
+            std::perror("pipe2");
+            return options.clients;
+        }
+
+        std::vector<pid_t> children;
+        children.reserve(options.clients);
+        for (uint32_t i = 0; i < options.clients; ++i) {
+            pid_t pid = fork();
+            if (pid == 0) {
+                close(barrier[1]);
+                RunClient(options, barrier[0], &results[i]);
+            }
+            if (pid < 0) {
+                std::perror("fork");
+                break;
+            }
+            children.push_back(pid);
+        }
+        close(barrier[0]);
+
+        // Let every client reach read() on the barrier
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        const uint64_t start_ns = NowNs();
+        close(barrier[1]);  // EOF releases all clients at once
+
+        for (pid_t pid : children) {
+            int status = 0;
+            waitpid(pid, &status, 0);
+        }
+
+        std::vector<uint64_t> latencies;
+        latencies.reserve(options.clients);
+        uint32_t failed = options.clients - static_cast<uint32_t>(children.size());
+        uint32_t first_error = 0;
+        for (size_t i = 0; i < children.size(); ++i) {
+            if (results[i].ok != 0U) {
+                latencies.push_back(results[i].done_ns - start_ns);
+            } else {
+                ++failed;
+                first_error = (first_error == 0U) ? results[i].error : first_error;
+            }
+        }
+        std::sort(latencies.begin(), latencies.end());
+
+        const uint64_t all_ns = latencies.empty() ? 0 : latencies.back();
+        std::printf("%5u %8u %8u %6u %12.1f %10.1f %10.1f\n",
+                    round, options.clients, static_cast<uint32_t>(latencies.size()), failed,
+                    static_cast<double>(all_ns) / 1000.0,
+                    static_cast<double>(PercentileOf(latencies, 50.0)) / 1000.0,
+                    static_cast<double>(PercentileOf(latencies, 99.0)) / 1000.0);
+        if (first_error != 0U) {
+            std::fprintf(stderr, "# first client error: 0x%x\n", first_error);
+        }
+        return failed;
+    }
+
+    bool ParseArgs(int argc, char** argv, Options& options)
+    {
+        for (int i = 1; i < argc; ++i) {
+            const char* arg = argv[i];
+            if (std::strncmp(arg, "--clients=", 10) == 0) {
+                options.clients = static_cast<uint32_t>(std::strtoul(arg + 10, nullptr, 10));
+            } else if (std::strncmp(arg, "--rounds=", 9) == 0) {
+                options.rounds = static_cast<uint32_t>(std::strtoul(arg + 9, nullptr, 10));
+            } else if (std::strncmp(arg, "--socket=", 9) == 0) {
+                options.socket_path = arg + 9;
+            } else {
+                std::printf("Usage: %s [options]\n"
+                            "  --clients=<n>     Simultaneous client processes (default: 200)\n"
+                            "  --rounds=<n>      Storms against the same daemon (default: 3)\n"
+                            "  --socket=<path>   Daemon socket (default: /tmp/lap_boot_storm_<pid>.sock)\n",
+                            argv[0]);
+                return false;
+            }
+        }
+
+        if (options.socket_path.empty()) {
+            options.socket_path = "/tmp/lap_boot_storm_" + std::to_string(getpid()) + ".sock";
+        }
+        return options.clients > 0 && options.rounds > 0;
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!ParseArgs(argc, argv, options)) {
+        return EXIT_FAILURE;
+    }
+
+    void* mapping = mmap(nullptr, sizeof(ClientResult) * options.clients, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (mapping == MAP_FAILED) {
+        std::perror("mmap");
+        return EXIT_FAILURE;
+    }
+    auto* results = static_cast<ClientResult*>(mapping);
+
+    std::fflush(stdout);
+    pid_t server = fork();
+    if (server == 0) {
+        RunServer(options);
+    }
+    if (server < 0 || !WaitForServer(options.socket_path)) {
+        std::fprintf(stderr, "Registry daemon did not start on %s\n", options.socket_path.c_str());
+        if (server > 0) {
+            kill(server, SIGKILL);
+            waitpid(server, nullptr, 0);
+        }
+        return EXIT_FAILURE;
+    }
+
+    std::printf("# %ld cpus online, latencies in us from barrier release\n", sysconf(_SC_NPROCESSORS_ONLN));
+    std::printf("%5s %8s %8s %6s %12s %10s %10s\n",
+                "round", "clients", "ok", "fail", "all-init", "P50", "P99");
+
+    uint32_t failed = 0;
+    for (uint32_t round = 0; round < options.rounds; ++round) {
+        failed += RunRound(options, round, results);
+    }
+    std::fflush(stdout);
+
+    kill(server, SIGTERM);
+    int status = 0;
+    waitpid(server, &status, 0);
+    munmap(mapping, sizeof(ClientResult) * options.clients);
+
+    return (failed == 0 && WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS)
+           ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,590 @@
+/**
+ * @file        benchmark_registry.cpp
+ * @author      LightAP Development Team
+ * @brief       Latency benchmark for SeqLock and SharedMemoryRegistry read paths
+ * @date        2025-11-20
+ * @details     Measures per-operation latency histograms (P50/P99/P99.9/max) and
+ *              seqlock retry rates (torn reads re-read by read_func) and give-up
+ *              rates under N reader / M writer contention:
+ *              - read:     SeqLockReader::Read() of three hot fields
+ *              - readslot: SeqLockReader::ReadSlot() (full 256-byte copy)
+ *              - find:     SingleRegistry::FindService() with register/unregister churn
+ *              Workers run as threads or as forked processes that map the registry
+ *              memfd themselves (--processes), each pinned to one CPU.
+ * @copyright   Copyright (c) 2025
+ * @note        Validates the SeqLock.hpp targets: < 100ns read latency (P99),
+ *              < 0.1% retry rate. Not a pass/fail test; compare runs per SoC.
+ * @reference   SERVICE_DISCOVERY_ARCHITECTURE.md §2.1.2
+ * sdk:
+ * platform:    Linux 5.10+
+ * project:     LightAP
+ * @version
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author          <th>Description
+ * <tr><td>2025/11/20  <td>1.0      <td>LightAP Team    <td>Initial benchmark suite
+ * </table>
+ *
+ * @usage       bench_registry [--mode=read|readslot|find|all] [--readers=N] [--writers=M]
+ *                             [--duration-ms=D] [--processes] [--cpus=0,2,4]
+ *                             [--write-interval-us=U] [--services=K]
+ */
+
+#include "SharedMemoryRegistry.hpp"
+#include "SeqLock.hpp"
+#include "ServiceSlot.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace lap::com::registry;
+
+namespace
+{
+    // ========================================================================
+    // Latency histogram (log-linear, shared-memory friendly: no pointers)
+    // ========================================================================
+
+    /**
+     * @brief Fixed-size latency histogram
+     * @details Exact 1 ns buckets below 1024 ns, then 64 sub-buckets per power
+     *          of two (< 1.6% relative error) up to 2^40 ns.
+     */
+    struct LatencyHistogram
+    {
+        static constexpr uint32_t LINEAR_LIMIT = 1024;
+        static constexpr uint32_t SUB_BUCKETS = 64;
+        static constexpr uint32_t LOG_GROUPS = 30;
+        static constexpr uint32_t BUCKET_COUNT = LINEAR_LIMIT + SUB_BUCKETS * LOG_GROUPS;
+
+        uint64_t counts[BUCKET_COUNT];
+        uint64_t total;
+        uint64_t max_ns;
+
+        void Record(uint64_t ns) noexcept
+        {
+            counts[BucketOf(ns)]++;
+            total++;
+            max_ns = std::max(max_ns, ns);
+        }
+
+        void Merge(const LatencyHistogram& other) noexcept
+        {
+            for (uint32_t i = 0; i < BUCKET_COUNT; ++i) {
+                counts[i] += other.counts[i];
+            }
+            total += other.total;
+            max_ns = std::max(max_ns, other.max_ns);
+        }
+
+        uint64_t Percentile(double percentile) const noexcept
+        {
+            if (total == 0) {
+                return 0;
+            }
+            const uint64_t rank = static_cast<uint64_t>(percentile / 100.0 * static_cast<double>(total - 1));
+            uint64_t seen = 0;
+            for (uint32_t i = 0; i < BUCKET_COUNT; ++i) {
+                seen += counts[i];
+                if (seen > rank) {
+                    return std::min(ValueOf(i), max_ns);
+                }
+            }
+            return max_ns;
+        }
+
+        static uint32_t BucketOf(uint64_t ns) noexcept
+        {
+            if (ns < LINEAR_LIMIT) {
+                return static_cast<uint32_t>(ns);
+            }
+            const uint32_t msb = 63U - static_cast<uint32_t>(__builtin_clzll(ns));  // >= 10
+            const uint32_t group = std::min(msb - 10U, LOG_GROUPS - 1U);
+            const uint32_t sub = (msb - 10U >= LOG_GROUPS)
+                                 ? SUB_BUCKETS - 1U
+                                 : static_cast<uint32_t>((ns >> (msb - 6U)) & (SUB_BUCKETS - 1U));
+            return LINEAR_LIMIT + group * SUB_BUCKETS + sub;
+        }
+
+        /// Representative (upper) value of a bucket
+        static uint64_t ValueOf(uint32_t bucket) noexcept
+        {
+            if (bucket < LINEAR_LIMIT) {
+                return bucket;
+            }
+            const uint32_t group = (bucket - LINEAR_LIMIT) / SUB_BUCKETS;
+            const uint32_t sub = (bucket - LINEAR_LIMIT) % SUB_BUCKETS;
+            return ((static_cast<uint64_t>(SUB_BUCKETS + sub + 1)) << (group + 4U)) - 1U;
+        }
+    };
+
+    /**
+     * @brief Per-reader result block (lives in the shared control mapping)
+     */
+    struct alignas(64) ReaderStats
+    {
+        LatencyHistogram histogram;
+        uint64_t operations;   ///< Completed read operations
+        uint64_t attempts;     ///< read_func invocations (attempts - operations = retries)
+        uint64_t failures;     ///< Reads that returned empty (retry limit or not found)
+    };
+
+    /**
+     * @brief Shared control block (MAP_SHARED | MAP_ANONYMOUS, survives fork)
+     */
+    struct ControlBlock
+    {
+        std::atomic<uint32_t> ready;
+        std::atomic<uint32_t> start;
+        std::atomic<uint32_t> stop;
+        std::atomic<uint64_t> writes;
+    };
+
+    enum class Mode : uint8_t { READ, READSLOT, FIND };
+
+    struct Options
+    {
+        std::vector<Mode> modes{Mode::READ, Mode::READSLOT, Mode::FIND};
+        uint32_t readers = 2;
+        uint32_t writers = 1;
+        uint32_t duration_ms = 2000;
+        uint32_t write_interval_us = 0;
+        uint32_t services = 64;
+        bool processes = false;
+        std::vector<int> cpus;
+    };
+
+    const char* ModeName(Mode mode) noexcept
+    {
+        switch (mode) {
+            case Mode::READ:     return "read";
+            case Mode::READSLOT: return "readslot";
+            case Mode::FIND:     return "find";
+        }
+        return "?";
+    }
+
+    inline uint64_t NowNs() noexcept
+    {
+        return SingleRegistry::MonotonicNowNs();
+    }
+
+    void PinToCpu(const Options& options, uint32_t worker_index) noexcept
+    {
+        const long online = sysconf(_SC_NPROCESSORS_ONLN);
+        const int cpu = options.cpus.empty()
+                        ? static_cast<int>(worker_index % static_cast<uint32_t>(online > 0 ? online : 1))
+                        : options.cpus[worker_index % options.cpus.size()];
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0) {
+            std::fprintf(stderr, "warning: cannot pin worker %u to cpu %d\n", worker_index, cpu);
+        }
+    }
+
+    /**
+     * @brief Minimum cost of one NowNs() pair, subtracted from every sample
+     */
+    uint64_t CalibrateTimerOverhead() noexcept
+    {
+        uint64_t best = UINT64_MAX;
+        for (int i = 0; i < 10000; ++i) {
+            const uint64_t t0 = NowNs();
+            const uint64_t t1 = NowNs();
+            best = std::min(best, t1 - t0);
+        }
+        return best;
+    }
+
+    // ========================================================================
+    // Benchmark fixture: seqlock slot array or registry, both in a memfd
+    // ========================================================================
+
+    class Bench
+    {
+    public:
+        Bench(const Options& options, Mode mode, uint64_t timer_overhead_ns)
+            : options_(options), mode_(mode), timer_overhead_ns_(timer_overhead_ns), registry_(RegistryType::QM)
+        {
+        }
+
+        ~Bench()
+        {
+            if (control_ != nullptr) {
+                munmap(control_, controlSize());
+            }
+            if (slots_ != nullptr) {
+                munmap(slots_, slotBytes());
+            }
+            if (slot_fd_ >= 0) {
+                close(slot_fd_);
+            }
+        }
+
+        bool Setup()
+        {
+            control_ = static_cast<ControlBlock*>(mmap(nullptr, controlSize(), PROT_READ | PROT_WRITE,
+                                                      MAP_SHARED | MAP_ANONYMOUS, -1, 0));
+            if (control_ == MAP_FAILED) {
+                control_ = nullptr;
+                return false;
+            }
+            new (control_) ControlBlock{};
+            stats_ = reinterpret_cast<ReaderStats*>(reinterpret_cast<uint8_t*>(control_) + 64);
+            std::memset(static_cast<void*>(stats_), 0, sizeof(ReaderStats) * options_.readers);
+
+            if (mode_ == Mode::FIND) {
+                if (!registry_.Initialize().HasValue()) {
+                    return false;
+                }
+                for (uint32_t i = 0; i < options_.services; ++i) {
+                    if (!registry_.RegisterService(ServiceIdOf(i), 1, 1, 0, "iceoryx2", "shm://bench").HasValue()) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            // Raw seqlock slot array in its own memfd (same sharing as the registry)
+            slot_fd_ = static_cast<int>(memfd_create("lap_bench_seqlock", MFD_CLOEXEC));
+            if (slot_fd_ < 0 || ftruncate(slot_fd_, static_cast<off_t>(slotBytes())) != 0) {
+                return false;
+            }
+            slots_ = mapSlots();
+            if (slots_ == nullptr) {
+                return false;
+            }
+            for (uint32_t i = 0; i < options_.services; ++i) {
+                new (&slots_[i]) ServiceSlot();
+                slots_[i].service_id = ServiceIdOf(i);
+                slots_[i].status = static_cast<uint32_t>(SlotStatus::ACTIVE);
+            }
+            return true;
+        }
+
+        void Run()
+        {
+            const uint32_t workers = options_.readers + options_.writers;
+            std::vector<std::thread> threads;
+            std::vector<pid_t> children;
+
+            for (uint32_t w = 0; w < workers; ++w) {
+                if (options_.processes) {
+                    pid_t pid = fork();
+                    if (pid == 0) {
+                        runWorker(w, true);
+                        _exit(0);
+                    }
+                    if (pid > 0) {
+                        children.push_back(pid);
+                    }
+                } else {
+                    threads.emplace_back([this, w]() { runWorker(w, false); });
+                }
+            }
+
+            const uint32_t started = options_.processes ? static_cast<uint32_t>(children.size())
+                                                        : static_cast<uint32_t>(threads.size());
+            while (control_->ready.load(std::memory_order_acquire) < started) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            control_->start.store(1, std::memory_order_release);
+            std::this_thread::sleep_for(std::chrono::milliseconds(options_.duration_ms));
+            control_->stop.store(1, std::memory_order_release);
+
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            for (pid_t pid : children) {
+                int status = 0;
+                waitpid(pid, &status, 0);
+            }
+        }
+
+        void Report() const
+        {
+            LatencyHistogram merged{};
+            uint64_t operations = 0;
+            uint64_t attempts = 0;
+            uint64_t failures = 0;
+            for (uint32_t r = 0; r < options_.readers; ++r) {
+                merged.Merge(stats_[r].histogram);
+                operations += stats_[r].operations;
+                attempts += stats_[r].attempts;
+                failures += stats_[r].failures;
+            }
+
+            const double retry_pct = (operations == 0) ? 0.0
+                : 100.0 * static_cast<double>(attempts - std::min(attempts, operations)) / static_cast<double>(operations);
+            const double fail_pct = (operations == 0) ? 0.0
+                : 100.0 * static_cast<double>(failures) / static_cast<double>(operations);
+
+            // Retries are counted per read_func attempt; FindService hides them
+            char retry[16];
+            if (mode_ == Mode::FIND) {
+                std::snprintf(retry, sizeof(retry), "n/a");
+            } else {
+                std::snprintf(retry, sizeof(retry), "%.4f%%", retry_pct);
+            }
+
+            std::printf("%-9s %-9s %3u/%-3u %12llu %10llu %7llu %7llu %7llu %8llu %10s %8.4f%%\n",
+                        ModeName(mode_), options_.processes ? "process" : "thread",
+                        options_.readers, options_.writers,
+                        static_cast<unsigned long long>(operations),
+                        static_cast<unsigned long long>(control_->writes.load()),
+                        static_cast<unsigned long long>(merged.Percentile(50.0)),
+                        static_cast<unsigned long long>(merged.Percentile(99.0)),
+                        static_cast<unsigned long long>(merged.Percentile(99.9)),
+                        static_cast<unsigned long long>(merged.max_ns),
+                        retry, fail_pct);
+        }
+
+    private:
+        static uint64_t ServiceIdOf(uint32_t i) noexcept
+        {
+            return 0x0001 + i;  // QM range
+        }
+
+        size_t controlSize() const noexcept
+        {
+            return 64 + sizeof(ReaderStats) * options_.readers;
+        }
+
+        size_t slotBytes() const noexcept
+        {
+            return sizeof(ServiceSlot) * options_.services;
+        }
+
+        ServiceSlot* mapSlots() const noexcept
+        {
+            void* addr = mmap(nullptr, slotBytes(), PROT_READ | PROT_WRITE, MAP_SHARED, slot_fd_, 0);
+            return (addr == MAP_FAILED) ? nullptr : static_cast<ServiceSlot*>(addr);
+        }
+
+        void runWorker(uint32_t worker_index, bool own_mapping)
+        {
+            PinToCpu(options_, worker_index);
+
+            // Child processes attach to the memfd through their own mapping
+            ServiceSlot* slots = slots_;
+            SingleRegistry attached(RegistryType::QM);
+            const SingleRegistry* registry = &registry_;
+            if (own_mapping) {
+                if (mode_ == Mode::FIND) {
+                    if (!attached.InitializeFromFd(registry_.GetMemfd()).HasValue()) {
+                        control_->ready.fetch_add(1, std::memory_order_release);
+                        return;
+                    }
+                    registry = &attached;
+                } else {
+                    slots = mapSlots();
+                }
+            }
+
+            control_->ready.fetch_add(1, std::memory_order_release);
+            while (control_->start.load(std::memory_order_acquire) == 0) {
+                LAP_CPU_PAUSE();
+            }
+
+            if (worker_index < options_.readers) {
+                runReader(stats_[worker_index], slots, *registry);
+            } else {
+                runWriter(worker_index - options_.readers, slots, own_mapping ? attached : registry_);
+            }
+
+            if (own_mapping && slots != nullptr && slots != slots_) {
+                munmap(slots, slotBytes());
+            }
+        }
+
+        void runReader(ReaderStats& stats, ServiceSlot* slots, const SingleRegistry& registry)
+        {
+            uint32_t index = 0;
+            uint64_t attempts = 0;
+            struct HotFields { uint64_t service_id; uint64_t instance_id; uint32_t major; };
+
+            while (control_->stop.load(std::memory_order_relaxed) == 0) {
+                index = (index + 1 == options_.services) ? 0 : index + 1;
+                bool ok = false;
+
+                const uint64_t t0 = NowNs();
+                switch (mode_) {
+                    case Mode::READ: {
+                        auto fields = SeqLockReader::Read(slots[index], [&attempts](const ServiceSlot& s) {
+                            ++attempts;
+                            return HotFields{s.service_id, s.instance_id, s.major_version};
+                        });
+                        ok = fields.has_value();
+                        break;
+                    }
+                    case Mode::READSLOT: {
+                        auto slot = SeqLockReader::Read(slots[index], [&attempts](const ServiceSlot& s) -> ServiceSlot {
+                            ++attempts;
+                            return s;
+                        });
+                        ok = slot.has_value();
+                        break;
+                    }
+                    case Mode::FIND: {
+                        ++attempts;
+                        ok = registry.FindService(ServiceIdOf(index)).has_value();
+                        break;
+                    }
+                }
+                const uint64_t t1 = NowNs();
+
+                const uint64_t elapsed = t1 - t0;
+                stats.histogram.Record(elapsed > timer_overhead_ns_ ? elapsed - timer_overhead_ns_ : 0);
+                stats.operations++;
+                if (!ok) {
+                    stats.failures++;
+                }
+            }
+            stats.attempts = attempts;
+        }
+
+        void runWriter(uint32_t writer_index, ServiceSlot* slots, SingleRegistry& registry)
+        {
+            uint64_t writes = 0;
+            uint32_t index = writer_index;
+            const uint64_t churn_instance = 0x10000 + writer_index;
+
+            while (control_->stop.load(std::memory_order_relaxed) == 0) {
+                if (mode_ == Mode::FIND) {
+                    // Structural churn: probe tags, chains and both seqlocks change
+                    const uint64_t service_id = ServiceIdOf(index);
+                    if (registry.RegisterService(service_id, churn_instance, 1, 0, "dds", "bench").HasValue()) {
+                        auto slot_index = registry.FindSlot(service_id, churn_instance);
+                        if (slot_index.has_value()) {
+                            registry.UnregisterService(slot_index.value());
+                        }
+                    }
+                } else {
+                    // SeqLockWriter is single-writer: writer w owns slots w, w+M, ...
+                    ServiceSlot& slot = slots[index];
+                    SeqLockWriter writer(slot.sequence);
+                    slot.instance_id++;
+                    slot.major_version = static_cast<uint32_t>(slot.instance_id);
+                    std::snprintf(slot.endpoint, sizeof(slot.endpoint), "shm://bench/%llu",
+                                  static_cast<unsigned long long>(slot.instance_id));
+                }
+                ++writes;
+
+                index += options_.writers;
+                if (index >= options_.services) {
+                    index = writer_index;
+                }
+                if (options_.write_interval_us != 0) {
+                    std::this_thread::sleep_for(std::chrono::microseconds(options_.write_interval_us));
+                }
+            }
+            control_->writes.fetch_add(writes, std::memory_order_relaxed);
+        }
+
+        const Options& options_;
+        Mode mode_;
+        uint64_t timer_overhead_ns_;
+        SingleRegistry registry_;
+        ControlBlock* control_ = nullptr;
+        ReaderStats* stats_ = nullptr;
+        ServiceSlot* slots_ = nullptr;
+        int slot_fd_ = -1;
+    };
+
+    bool ParseArgs(int argc, char** argv, Options& options)
+    {
+        for (int i = 1; i < argc; ++i) {
+            const char* arg = argv[i];
+            if (std::strncmp(arg, "--mode=", 7) == 0) {
+                const std::string mode = arg + 7;
+                if (mode == "read") {
+                    options.modes = {Mode::READ};
+                } else if (mode == "readslot") {
+                    options.modes = {Mode::READSLOT};
+                } else if (mode == "find") {
+                    options.modes = {Mode::FIND};
+                } else if (mode != "all") {
+                    std::fprintf(stderr, "Invalid mode: %s\n", mode.c_str());
+                    return false;
+                }
+            } else if (std::strncmp(arg, "--readers=", 10) == 0) {
+                options.readers = static_cast<uint32_t>(std::strtoul(arg + 10, nullptr, 10));
+            } else if (std::strncmp(arg, "--writers=", 10) == 0) {
+                options.writers = static_cast<uint32_t>(std::strtoul(arg + 10, nullptr, 10));
+            } else if (std::strncmp(arg, "--duration-ms=", 14) == 0) {
+                options.duration_ms = static_cast<uint32_t>(std::strtoul(arg + 14, nullptr, 10));
+            } else if (std::strncmp(arg, "--write-interval-us=", 20) == 0) {
+                options.write_interval_us = static_cast<uint32_t>(std::strtoul(arg + 20, nullptr, 10));
+            } else if (std::strncmp(arg, "--services=", 11) == 0) {
+                options.services = static_cast<uint32_t>(std::strtoul(arg + 11, nullptr, 10));
+            } else if (std::strcmp(arg, "--processes") == 0) {
+                options.processes = true;
+            } else if (std::strncmp(arg, "--cpus=", 7) == 0) {
+                const char* cursor = arg + 7;
+                while (*cursor != '\0') {
+                    char* end = nullptr;
+                    options.cpus.push_back(static_cast<int>(std::strtol(cursor, &end, 10)));
+                    cursor = (*end == ',') ? end + 1 : end;
+                    if (end == cursor && *cursor != '\0') {
+                        return false;
+                    }
+                }
+            } else {
+                std::printf("Usage: %s [options]\n"
+                            "  --mode=<read|readslot|find|all>  Workload (default: all)\n"
+                            "  --readers=<n>                    Reader workers (default: 2)\n"
+                            "  --writers=<n>                    Writer workers (default: 1)\n"
+                            "  --duration-ms=<n>                Measurement time per mode (default: 2000)\n"
+                            "  --write-interval-us=<n>          Writer pause between writes (default: 0)\n"
+                            "  --services=<n>                   Slots/services read (default: 64)\n"
+                            "  --processes                      Fork workers, each maps the memfd\n"
+                            "  --cpus=<list>                    CPUs to pin workers to (readers first)\n",
+                            argv[0]);
+                return false;
+            }
+        }
+
+        const uint32_t max_services = RegistryConfig::MAX_SLOTS / 2;
+        return options.readers > 0 && options.services > 0 && options.services <= max_services;
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!ParseArgs(argc, argv, options)) {
+        return EXIT_FAILURE;
+    }
+
+    const uint64_t timer_overhead = CalibrateTimerOverhead();
+    std::printf("# timer overhead %llu ns (subtracted), %ld cpus online, latencies in ns\n",
+                static_cast<unsigned long long>(timer_overhead), sysconf(_SC_NPROCESSORS_ONLN));
+    std::printf("%-9s %-9s %7s %12s %10s %7s %7s %7s %8s %10s %9s\n",
+                "mode", "workers", "R/W", "reads", "writes", "P50", "P99", "P99.9", "max", "retry", "fail");
+
+    for (Mode mode : options.modes) {
+        Bench bench(options, mode, timer_overhead);
+        if (!bench.Setup()) {
+            std::fprintf(stderr, "Setup failed for mode %s\n", ModeName(mode));
+            return EXIT_FAILURE;
+        }
+        bench.Run();
+        bench.Report();
+    }
+
+    return EXIT_SUCCESS;
+}
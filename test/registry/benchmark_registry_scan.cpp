@@ -0,0 +1,243 @@
+/**
+ * @file        benchmark_registry_scan.cpp
+ * @author      LightAP Development Team
+ * @brief       Full-registry scan benchmark: slot walk vs. scalar vs. SIMD tag scan
+ * @date        2025-11-20
+ * @details     Fills a registry to the requested load and times one full scan per
+ *              iteration (all instances of one service_id):
+ *              - walk:     seqlock read of every index entry, compare service_id
+ *              - tag-scal: TagScan::MatchMaskScalar() per 64 tags + verify matches
+ *              - tag-simd: SingleRegistry::ScanService() (TagScan::MatchMask())
+ *              - snapshot: SingleRegistry::Snapshot() of all live slots
+ * @copyright   Copyright (c) 2025
+ * @note        Not a pass/fail test; compare runs per SoC.
+ * @reference   SERVICE_DISCOVERY_ARCHITECTURE.md §2.1
+ * sdk:
+ * platform:    Linux 5.10+
+ * project:     LightAP
+ * @version
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author          <th>Description
+ * <tr><td>2025/11/20  <td>1.0      <td>LightAP Team    <td>Initial scan benchmark
+ * </table>
+ *
+ * @usage       bench_registry_scan [--slots=N] [--load=P] [--iterations=K]
+ */
+
+#include "SharedMemoryRegistry.hpp"
+#include "RegistryLayout.hpp"
+#include "SeqLock.hpp"
+#include "TagScan.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+using namespace lap::com::registry;
+
+namespace
+{
+    struct Options
+    {
+        uint32_t slots = RegistryConfig::MAX_SLOTS;  ///< Registry slot count
+        uint32_t load = 50;                          ///< Occupied slots in percent
+        uint32_t iterations = 20000;                 ///< Timed scans per variant
+    };
+
+    /// Service scanned for: registered with several instances
+    constexpr uint64_t TARGET_SERVICE_ID = 0x30000ULL;
+    constexpr uint32_t TARGET_INSTANCES = 4;
+
+    /**
+     * @brief Read-only view of the registry memfd (same mapping a client has)
+     */
+    struct RegistryView
+    {
+        void* base = nullptr;
+        size_t size = 0;
+        uint32_t slot_count = 0;
+        const std::atomic<uint8_t>* tags = nullptr;
+        const ServiceIndexEntry* index = nullptr;
+
+        bool Map(int memfd)
+        {
+            struct stat st{};
+            if (fstat(memfd, &st) != 0) {
+                return false;
+            }
+            size = static_cast<size_t>(st.st_size);
+            base = mmap(nullptr, size, PROT_READ, MAP_SHARED, memfd, 0);
+            if (base == MAP_FAILED) {
+                base = nullptr;
+                return false;
+            }
+            slot_count = RegistryLayout::Header(base)->slot_count;
+            tags = RegistryLayout::Tags(base);
+            index = RegistryLayout::Index(base, slot_count);
+            return true;
+        }
+
+        ~RegistryView()
+        {
+            if (base != nullptr) {
+                munmap(base, size);
+            }
+        }
+    };
+
+    /// Confirm a tag match on its index entry (shared by walk and tag-scal)
+    inline bool Matches(const ServiceIndexEntry& entry, uint64_t service_id) noexcept
+    {
+        auto match = SeqLockReader::Read(entry, [service_id](const ServiceIndexEntry& e) {
+            return e.service_id == service_id && e.IsActive();
+        });
+        return match.has_value() && match.value();
+    }
+
+    uint32_t ScanWalk(const RegistryView& view, uint64_t service_id) noexcept
+    {
+        uint32_t found = 0;
+        for (uint32_t i = 1; i < view.slot_count; ++i) {
+            found += Matches(view.index[i], service_id) ? 1U : 0U;
+        }
+        return found;
+    }
+
+    uint32_t ScanTagScalar(const RegistryView& view, uint8_t tag, uint64_t service_id) noexcept
+    {
+        uint32_t found = 0;
+        for (uint32_t block = 0; block < view.slot_count; block += TagScan::BLOCK_SIZE) {
+            uint64_t matches = TagScan::MatchMaskScalar(&view.tags[block], tag) &
+                               TagScan::ValidMask(block, view.slot_count);
+            while (matches != 0) {
+                const uint32_t slot = block + static_cast<uint32_t>(__builtin_ctzll(matches));
+                matches &= matches - 1;
+                found += Matches(view.index[slot], service_id) ? 1U : 0U;
+            }
+        }
+        return found;
+    }
+
+    /**
+     * @brief Time `iterations` calls of scan; prints P50/P99/mean in ns
+     */
+    void Measure(const char* name, uint32_t iterations, uint32_t expected, const std::function<uint32_t()>& scan)
+    {
+        std::vector<uint64_t> samples;
+        samples.reserve(iterations);
+        uint32_t mismatches = 0;
+
+        for (uint32_t i = 0; i < 100; ++i) {
+            (void)scan();  // Warm caches and branch predictors
+        }
+        for (uint32_t i = 0; i < iterations; ++i) {
+            const uint64_t t0 = SingleRegistry::MonotonicNowNs();
+            const uint32_t found = scan();
+            const uint64_t t1 = SingleRegistry::MonotonicNowNs();
+            samples.push_back(t1 - t0);
+            mismatches += (found != expected) ? 1U : 0U;
+        }
+        std::sort(samples.begin(), samples.end());
+
+        uint64_t sum = 0;
+        for (uint64_t sample : samples) {
+            sum += sample;
+        }
+        std::printf("%-10s %10llu %10llu %10llu %8u %10u\n", name,
+                    static_cast<unsigned long long>(samples[samples.size() / 2]),
+                    static_cast<unsigned long long>(samples[samples.size() * 99 / 100]),
+                    static_cast<unsigned long long>(sum / samples.size()),
+                    expected, mismatches);
+    }
+
+    bool ParseArgs(int argc, char** argv, Options& options)
+    {
+        for (int i = 1; i < argc; ++i) {
+            const char* arg = argv[i];
+            if (std::strncmp(arg, "--slots=", 8) == 0) {
+                options.slots = static_cast<uint32_t>(std::strtoul(arg + 8, nullptr, 10));
+            } else if (std::strncmp(arg, "--load=", 7) == 0) {
+                options.load = static_cast<uint32_t>(std::strtoul(arg + 7, nullptr, 10));
+            } else if (std::strncmp(arg, "--iterations=", 13) == 0) {
+                options.iterations = static_cast<uint32_t>(std::strtoul(arg + 13, nullptr, 10));
+            } else {
+                std::printf("Usage: %s [options]\n"
+                            "  --slots=<n>        Registry slot count (default: 1024)\n"
+                            "  --load=<percent>   Occupied slots (default: 50, max: 90)\n"
+                            "  --iterations=<n>   Timed scans per variant (default: 20000)\n",
+                            argv[0]);
+                return false;
+            }
+        }
+        return options.slots >= 64 && options.slots <= RegistryConfig::MAX_SLOTS_LIMIT &&
+               options.load <= 90 && options.iterations > 0;
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!ParseArgs(argc, argv, options)) {
+        return EXIT_FAILURE;
+    }
+
+    SingleRegistry registry(RegistryType::QM);
+    if (!registry.Initialize(options.slots).HasValue()) {
+        std::fprintf(stderr, "SingleRegistry::Initialize(%u) failed\n", options.slots);
+        return EXIT_FAILURE;
+    }
+
+    // Target instances first, then unrelated services up to the requested load
+    const uint32_t occupied = options.slots * options.load / 100;
+    for (uint32_t instance = 1; instance <= TARGET_INSTANCES && instance <= occupied; ++instance) {
+        if (!registry.RegisterService(TARGET_SERVICE_ID, instance, 1, 0, "dds", "topic://bench").HasValue()) {
+            return EXIT_FAILURE;
+        }
+    }
+    for (uint32_t i = TARGET_INSTANCES; i < occupied; ++i) {
+        if (!registry.RegisterService(0x40000ULL + i, 1, 1, 0, "dds", "topic://bench").HasValue()) {
+            std::fprintf(stderr, "Registry full at %u services\n", i);
+            return EXIT_FAILURE;
+        }
+    }
+
+    RegistryView view;
+    if (!view.Map(registry.GetMemfd())) {
+        return EXIT_FAILURE;
+    }
+
+    std::vector<ServiceSlotSummary> entries;
+    entries.reserve(options.slots);
+    if (!registry.Snapshot(entries).HasValue()) {
+        return EXIT_FAILURE;
+    }
+    const uint32_t live = static_cast<uint32_t>(entries.size());
+    const uint32_t expected = std::min(TARGET_INSTANCES, occupied);
+    // Probe tag of the target service, as stored by the registry
+    const uint8_t tag = view.tags[registry.FindSlot(TARGET_SERVICE_ID).value()].load(std::memory_order_relaxed);
+
+    std::printf("# %u slots, %u live, tag scan isa=%s, latencies in ns per full scan\n",
+                options.slots, live, TagScan::Isa());
+    std::printf("%-10s %10s %10s %10s %8s %10s\n", "variant", "P50", "P99", "mean", "found", "mismatch");
+
+    Measure("walk", options.iterations, expected, [&] { return ScanWalk(view, TARGET_SERVICE_ID); });
+    Measure("tag-scal", options.iterations, expected, [&] { return ScanTagScalar(view, tag, TARGET_SERVICE_ID); });
+    Measure("tag-simd", options.iterations, expected, [&] {
+        entries.clear();
+        registry.ScanService(TARGET_SERVICE_ID, entries);
+        return static_cast<uint32_t>(entries.size());
+    });
+    Measure("snapshot", options.iterations, live, [&] {
+        entries.clear();
+        registry.Snapshot(entries);
+        return static_cast<uint32_t>(entries.size());
+    });
+
+    return EXIT_SUCCESS;
+}
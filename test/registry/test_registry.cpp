@@ -7,12 +7,22 @@
  */
 
 #include "SharedMemoryRegistry.hpp"
+#include "HeartbeatTimerWheel.hpp"
+#include "ComTypes.hpp"
 
 #include <gtest/gtest.h>
 #include <chrono>
 #include <thread>
+#include <atomic>
 #include <numeric>
 #include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <csignal>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
 
 using namespace lap::com::registry;
 using namespace std::chrono;
@@ -144,6 +154,50 @@ TEST_F(SharedMemoryRegistryTest, FindQM_AB_Service)
     EXPECT_STREQ(found.value().endpoint, "shm://camera/front");
 }
 
+/**
+ * @test Endpoint strings are pre-parsed into the slot at registration
+ */
+TEST_F(SharedMemoryRegistryTest, PreParsedEndpoint)
+{
+    ASSERT_TRUE(registry_->RegisterService(0x0210, 1, 1, 0, "someip", "tcp://192.168.1.10:30509").HasValue());
+    auto found = registry_->FindService(0x0210);
+    ASSERT_TRUE(found.has_value());
+
+    const EndpointAddress& address = found.value().endpoint_address;
+    EXPECT_EQ(address.Transport(), EndpointTransport::TCP);
+    EXPECT_EQ(address.Port(), 30509u);
+
+    sockaddr_storage storage{};
+    ASSERT_EQ(address.ToSockaddr(found.value().endpoint, storage), sizeof(sockaddr_in));
+    const auto* inet = reinterpret_cast<const sockaddr_in*>(&storage);
+    EXPECT_EQ(inet->sin_addr.s_addr, inet_addr("192.168.1.10"));
+
+    // Equal endpoints encode to identical bytes
+    EndpointAddress parsed;
+    ASSERT_TRUE(EndpointAddress::Parse("tcp://192.168.1.10:30509", parsed));
+    EXPECT_TRUE(parsed == address);
+    ASSERT_TRUE(EndpointAddress::Parse("tcp://192.168.1.10:30510", parsed));
+    EXPECT_TRUE(parsed != address);
+
+    ASSERT_TRUE(EndpointAddress::Parse("udp://[fe80::1]:30490", parsed));
+    EXPECT_EQ(parsed.family, AF_INET6);
+    EXPECT_EQ(parsed.Port(), 30490u);
+
+    const char* uds = "uds:///var/run/lap_service.sock";
+    ASSERT_TRUE(EndpointAddress::Parse(uds, parsed));
+    ASSERT_GT(parsed.ToSockaddr(uds, storage), 0u);
+    EXPECT_STREQ(reinterpret_cast<const sockaddr_un*>(&storage)->sun_path, "/var/run/lap_service.sock");
+
+    ASSERT_TRUE(EndpointAddress::Parse("shm://camera/front", parsed));
+    EXPECT_EQ(parsed.Transport(), EndpointTransport::SHM);
+    EXPECT_EQ(parsed.name_hash, EndpointAddress::HashName("camera/front", 12));
+
+    // Unknown schemes and host names stay unencoded
+    EXPECT_FALSE(EndpointAddress::Parse("http://example.com:80", parsed));
+    EXPECT_FALSE(EndpointAddress::Parse("tcp://ecu1.local:30509", parsed));
+    EXPECT_FALSE(parsed.IsValid());
+}
+
 /**
  * @test Find a registered ASIL service
  * @req SWS_CM_00001 (FindService)
@@ -195,6 +249,74 @@ TEST_F(SharedMemoryRegistryTest, UnregisterService)
     EXPECT_FALSE(found2.has_value()) << "Service should be unregistered";
 }
 
+/**
+ * @test Repeated lookups hit the process-local cache until the generation changes
+ */
+TEST_F(SharedMemoryRegistryTest, LookupCacheInvalidatedByGeneration)
+{
+    const uint64_t service_id = 0x0310;
+    ASSERT_TRUE(registry_->RegisterService(service_id, 1, 1, 0, "someip", "udp://10.0.0.1:30501").HasValue());
+
+    auto before = registry_->GetLookupCacheStats();
+    auto found1 = registry_->FindService(service_id);
+    auto found2 = registry_->FindService(service_id);
+    ASSERT_TRUE(found1.has_value() && found2.has_value());
+    EXPECT_STREQ(found2.value().endpoint, "udp://10.0.0.1:30501");
+    EXPECT_STREQ(found2.value().binding_type, "someip");
+    auto after = registry_->GetLookupCacheStats();
+    EXPECT_EQ(after.misses - before.misses, 1u);
+    EXPECT_EQ(after.hits - before.hits, 1u);
+
+    // Any registration change in the QM registry invalidates the entry
+    ASSERT_TRUE(registry_->RegisterService(0x0311, 1, 1, 0, "dds", "x").HasValue());
+    ASSERT_TRUE(registry_->FindService(service_id).has_value());
+    EXPECT_EQ(registry_->GetLookupCacheStats().misses - after.misses, 1u);
+
+    // Negative results are cached as well, and never outlive a re-registration
+    ASSERT_TRUE(registry_->UnregisterService(service_id).HasValue());
+    EXPECT_FALSE(registry_->FindService(service_id).has_value());
+    EXPECT_FALSE(registry_->FindService(service_id).has_value());
+    ASSERT_TRUE(registry_->RegisterService(service_id, 2, 1, 0, "someip", "udp://10.0.0.2:30501").HasValue());
+    auto found3 = registry_->FindService(service_id);
+    ASSERT_TRUE(found3.has_value());
+    EXPECT_EQ(found3.value().instance_id, 2u);
+    EXPECT_STREQ(found3.value().endpoint, "udp://10.0.0.2:30501");
+}
+
+/**
+ * @test Concurrent lookups share the cache without a lock and never see a torn entry
+ */
+TEST_F(SharedMemoryRegistryTest, LookupCacheConcurrentReaders)
+{
+    const uint64_t service_id = 0x0312;
+    ASSERT_TRUE(registry_->RegisterService(service_id, 1, 1, 0, "someip", "udp://10.0.0.1:30512").HasValue());
+
+    constexpr uint32_t THREADS = 4;
+    constexpr uint32_t LOOKUPS = 2000;
+    auto before = registry_->GetLookupCacheStats();
+    std::atomic<uint32_t> mismatches{0};
+    std::vector<std::thread> readers;
+    for (uint32_t t = 0; t < THREADS; ++t) {
+        readers.emplace_back([&]() {
+            for (uint32_t i = 0; i < LOOKUPS; ++i) {
+                auto found = registry_->FindService(service_id);
+                if (!found.has_value() || found.value().instance_id != 1 ||
+                    std::strcmp(found.value().endpoint, "udp://10.0.0.1:30512") != 0) {
+                    mismatches.fetch_add(1);
+                }
+            }
+        });
+    }
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_EQ(mismatches.load(), 0u);
+    auto after = registry_->GetLookupCacheStats();
+    EXPECT_EQ((after.hits - before.hits) + (after.misses - before.misses), uint64_t{THREADS} * LOOKUPS);
+    EXPECT_GT(after.hits - before.hits, after.misses - before.misses);
+}
+
 /**
  * @test Update heartbeat
  * @req SWS_CM_00311 (Service liveness)
@@ -226,12 +348,252 @@ TEST_F(SharedMemoryRegistryTest, UpdateHeartbeat)
     EXPECT_GT(found2.value().last_heartbeat_ns, initial_hb) << "Heartbeat should be updated";
 }
 
+/**
+ * @test Batched heartbeat refresh of resolved slots (broadcast → both registries)
+ */
+TEST_F(SharedMemoryRegistryTest, BatchedHeartbeatTargets)
+{
+    ASSERT_TRUE(registry_->RegisterService(0x0402, 1, 1, 0, "dds", "a").HasValue());
+    ASSERT_TRUE(registry_->RegisterService(0xFFFF, 1, 1, 0, "dds", "b").HasValue());
+    
+    Vector<HeartbeatTarget> targets;
+    ASSERT_TRUE(registry_->GetHeartbeatTargets(0x0402, 1, targets).HasValue());
+    ASSERT_TRUE(registry_->GetHeartbeatTargets(0xFFFF, 1, targets).HasValue());
+    ASSERT_EQ(targets.size(), 3u);
+    EXPECT_EQ(targets[0].interval_ms, RegistryConfig::QM_HEARTBEAT_INTERVAL_MS);
+    EXPECT_EQ(targets[1].registry, RegistryType::QM);
+    EXPECT_EQ(targets[2].registry, RegistryType::ASIL);
+    EXPECT_EQ(targets[2].interval_ms, RegistryConfig::ASIL_HEARTBEAT_INTERVAL_MS);
+    EXPECT_FALSE(registry_->GetHeartbeatTargets(0x0402, 2, targets).HasValue());
+    
+    // Explicit interval overrides the registry default
+    ASSERT_TRUE(registry_->RegisterService(0x0403, 1, 1, 0, "dds", "c", 20).HasValue());
+    Vector<HeartbeatTarget> explicit_targets;
+    ASSERT_TRUE(registry_->GetHeartbeatTargets(0x0403, 1, explicit_targets).HasValue());
+    ASSERT_EQ(explicit_targets.size(), 1u);
+    EXPECT_EQ(explicit_targets[0].interval_ms, 20u);
+    EXPECT_EQ(registry_->FindService(0x0403).value().heartbeat_interval_ms, 20u);
+    
+    const uint64_t stamp = 0x123456789ULL;
+    EXPECT_EQ(registry_->UpdateHeartbeats(targets, stamp), 0u);
+    EXPECT_EQ(registry_->FindService(0x0402).value().last_heartbeat_ns, stamp);
+    EXPECT_EQ(registry_->FindService(0xFFFF).value().last_heartbeat_ns, stamp);
+}
+
+/**
+ * @test Heartbeat refresh leaves the seqlock sequences untouched (no reader retries)
+ */
+TEST(SingleRegistryTest, HeartbeatBypassesSeqLock)
+{
+    SingleRegistry registry(RegistryType::QM);
+    ASSERT_TRUE(registry.Initialize().HasValue());
+    auto slot_index = registry.RegisterService(0x0403, 1, 1, 0, "dds", "hb");
+    ASSERT_TRUE(slot_index.HasValue());
+    
+    auto before = registry.FindServiceIndex(0x0403);
+    ASSERT_TRUE(before.has_value());
+    const uint64_t entry_seq = before.value().sequence.load();
+    const uint64_t slot_seq = registry.ReadSlot(slot_index.Value()).value().sequence.load();
+    
+    for (uint64_t stamp = 1; stamp <= 100; ++stamp) {
+        ASSERT_TRUE(registry.UpdateHeartbeat(slot_index.Value(), stamp).HasValue());
+    }
+    
+    auto after = registry.FindServiceIndex(0x0403);
+    ASSERT_TRUE(after.has_value());
+    EXPECT_EQ(after.value().sequence.load(), entry_seq);
+    EXPECT_EQ(after.value().last_heartbeat_ns.load(), 100u);
+    
+    auto slot = registry.ReadSlot(slot_index.Value());
+    ASSERT_TRUE(slot.has_value());
+    EXPECT_EQ(slot.value().sequence.load(), slot_seq);
+    EXPECT_EQ(slot.value().last_heartbeat_ns, 100u);
+}
+
+/**
+ * @test Statistics region counts writers and contended reads of every mapping
+ */
+TEST(SingleRegistryTest, StatisticsRegion)
+{
+    SingleRegistry registry(RegistryType::QM);
+    ASSERT_TRUE(registry.Initialize().HasValue());
+    auto first = registry.RegisterService(0x0404, 1, 1, 0, "dds", "a");
+    auto second = registry.RegisterService(0x0404, 2, 1, 0, "dds", "b");
+    auto third = registry.RegisterService(0x0405, 1, 1, 0, "dds", "c");
+    ASSERT_TRUE(first.HasValue() && second.HasValue() && third.HasValue());
+    ASSERT_TRUE(registry.UnregisterService(first.Value()).HasValue());
+    ASSERT_TRUE(registry.ReclaimSlot(third.Value(), getpid()).HasValue());
+    for (uint64_t stamp = 1; stamp <= 5; ++stamp) {
+        ASSERT_TRUE(registry.UpdateHeartbeat(second.Value(), stamp).HasValue());
+    }
+
+    // Uncontended lookups never touch the counters
+    ASSERT_TRUE(registry.FindService(0x0404).has_value());
+
+    // Hold the index entry of 0x0404 in a write through a second mapping:
+    // the lookup exhausts its retries and is accounted as one failed read
+    const size_t size = RegistryLayout::TotalSize(registry.GetSlotCount());
+    void* base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, registry.GetMemfd(), 0);
+    ASSERT_NE(base, MAP_FAILED);
+    auto& sequence = RegistryLayout::Index(base, registry.GetSlotCount())[second.Value()].sequence;
+    sequence.fetch_add(1);
+    EXPECT_FALSE(registry.FindService(0x0404).has_value());
+    sequence.fetch_add(1);
+    const uint32_t gave_up = SeqLockReader::GetBackoff().MaxRetries() + 1;
+
+    // Another process' view of the same memfd sees the same totals
+    SingleRegistry observer(RegistryType::QM);
+    ASSERT_TRUE(observer.InitializeFromFd(registry.GetMemfd()).HasValue());
+    auto stats = observer.GetStats();
+    ASSERT_TRUE(stats.HasValue());
+    EXPECT_EQ(stats.Value().registrations, 3u);
+    EXPECT_EQ(stats.Value().unregistrations, 1u);
+    EXPECT_EQ(stats.Value().reclaims, 1u);
+    EXPECT_EQ(stats.Value().heartbeats, 5u);
+    EXPECT_EQ(stats.Value().reader_retries, gave_up);
+    EXPECT_EQ(stats.Value().reader_failures, 1u);
+    EXPECT_EQ(stats.Value().max_retry_streak, gave_up);
+    EXPECT_EQ(stats.Value().writer_waits, 0u);
+    EXPECT_EQ(stats.Value().live_slots, 1u);
+    EXPECT_EQ(stats.Value().slot_count, registry.GetSlotCount());
+    EXPECT_EQ(stats.Value().generation, registry.GetGeneration());
+    munmap(base, size);
+
+    SharedMemoryRegistry dual;
+    ASSERT_TRUE(dual.Initialize().HasValue());
+    ASSERT_TRUE(dual.RegisterService(0xF010, 1, 1, 0, "dds", "asil").HasValue());
+    EXPECT_EQ(dual.GetStats(RegistryType::ASIL).Value().registrations, 1u);
+    EXPECT_EQ(dual.GetStats(RegistryType::QM).Value().registrations, 0u);
+    EXPECT_FALSE(dual.GetStats(RegistryType::BOTH).HasValue());
+}
+
+/**
+ * @test LookupService() reports a write-locked entry as contention, not as a miss
+ */
+TEST(SingleRegistryTest, LookupReportsContention)
+{
+    SingleRegistry registry(RegistryType::QM);
+    ASSERT_TRUE(registry.Initialize().HasValue());
+    uint32_t slot_index = 0;
+    EXPECT_EQ(registry.LookupService(0x0406, Liveness::ANY, slot_index).Error().Value(),
+              static_cast<int>(lap::com::ComErrc::kServiceNotAvailable));
+    auto registered = registry.RegisterService(0x0406, 1, 1, 0, "dds", "topic://contended");
+    ASSERT_TRUE(registered.HasValue());
+
+    // Spin-only policy keeps the test fast; restored below
+    const SeqLockBackoff saved = SeqLockReader::GetBackoff();
+    SeqLockBackoff spin_only;
+    spin_only.spin_count = 16;
+    spin_only.pause_rounds = 0;
+    spin_only.yield_count = 0;
+    spin_only.wait_count = 0;
+    SeqLockReader::SetBackoff(spin_only);
+
+    const size_t size = RegistryLayout::TotalSize(registry.GetSlotCount());
+    void* base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, registry.GetMemfd(), 0);
+    ASSERT_NE(base, MAP_FAILED);
+    auto& sequence = RegistryLayout::Index(base, registry.GetSlotCount())[registered.Value()].sequence;
+    sequence.fetch_add(1);
+    auto contended = registry.LookupService(0x0406, Liveness::ANY, slot_index);
+    sequence.fetch_add(1);
+    munmap(base, size);
+    SeqLockReader::SetBackoff(saved);
+
+    ASSERT_FALSE(contended.HasValue());
+    EXPECT_EQ(contended.Error().Value(), static_cast<int>(lap::com::ComErrc::kRegistryContended));
+    auto stats = registry.GetStats();
+    ASSERT_TRUE(stats.HasValue());
+    EXPECT_EQ(stats.Value().reader_retries, spin_only.MaxRetries() + 1u);
+
+    auto found = registry.LookupService(0x0406, Liveness::ANY, slot_index);
+    ASSERT_TRUE(found.HasValue());
+    EXPECT_EQ(slot_index, registered.Value());
+    EXPECT_STREQ(found.Value().endpoint, "topic://contended");
+}
+
+/**
+ * @test LIVE_ONLY lookups skip instances with a stale heartbeat and count them
+ */
+TEST(SingleRegistryTest, LivenessFiltersStaleInstances)
+{
+    SingleRegistry registry(RegistryType::QM);
+    ASSERT_TRUE(registry.Initialize().HasValue());
+    auto zombie = registry.RegisterService(0x0404, 1, 1, 0, "dds", "zombie");
+    auto live = registry.RegisterService(0x0404, 2, 1, 0, "dds", "live");
+    ASSERT_TRUE(zombie.HasValue());
+    ASSERT_TRUE(live.HasValue());
+    
+    // Age instance 1 beyond 3 × 100 ms
+    const uint64_t now_ns = SingleRegistry::MonotonicNowNs();
+    ASSERT_TRUE(registry.UpdateHeartbeat(zombie.Value(), now_ns - 400000000ULL).HasValue());
+    ASSERT_TRUE(registry.UpdateHeartbeat(live.Value(), now_ns).HasValue());
+    
+    EXPECT_EQ(registry.FindAllInstances(0x0404).size(), 2u);
+    EXPECT_EQ(registry.GetStaleCount(), 0u);
+    
+    auto found = registry.FindService(0x0404, Liveness::LIVE_ONLY);
+    ASSERT_TRUE(found.has_value());
+    EXPECT_EQ(found.value().instance_id, 2u);
+    EXPECT_EQ(registry.GetStaleCount(), 1u);
+    
+    auto instances = registry.FindAllInstances(0x0404, Liveness::LIVE_ONLY);
+    ASSERT_EQ(instances.size(), 1u);
+    EXPECT_EQ(instances[0].instance_id, 2u);
+    EXPECT_EQ(registry.GetStaleCount(), 2u);
+    
+    // Both stale: nothing to bind to
+    ASSERT_TRUE(registry.UpdateHeartbeat(live.Value(), now_ns - 400000000ULL).HasValue());
+    EXPECT_FALSE(registry.FindService(0x0404, Liveness::LIVE_ONLY).has_value());
+    EXPECT_TRUE(registry.FindService(0x0404).has_value());
+}
+
+/**
+ * @test Timer wheel fires each target at its own interval, also across revolutions
+ */
+TEST(HeartbeatTimerWheelTest, PerTargetIntervals)
+{
+    HeartbeatTimerWheel wheel(10);
+    const uint64_t start_ms = 1000000;
+    
+    wheel.Schedule(HeartbeatTarget{1, 1, 0, 1, 20, RegistryType::QM}, start_ms);
+    wheel.Schedule(HeartbeatTarget{2, 1, 0, 2, 50, RegistryType::QM}, start_ms);
+    wheel.Schedule(HeartbeatTarget{3, 1, 0, 3, 5000, RegistryType::QM}, start_ms);  // ~2 revolutions
+    ASSERT_EQ(wheel.Size(), 3u);
+    EXPECT_EQ(wheel.NextDeadlineMs(), start_ms + 20);
+    
+    uint32_t fired[4] = {0, 0, 0, 0};
+    Vector<HeartbeatTarget> due;
+    for (uint64_t now = start_ms + 1; now <= start_ms + 5000; ++now) {
+        due.clear();
+        wheel.Collect(now, due);
+        for (const auto& target : due) {
+            ++fired[target.service_id];
+        }
+        EXPECT_GE(wheel.NextDeadlineMs(), now);
+    }
+    
+    EXPECT_EQ(fired[1], 250u);
+    EXPECT_EQ(fired[2], 100u);
+    EXPECT_EQ(fired[3], 1u);
+    EXPECT_EQ(wheel.Size(), 3u);
+    
+    ASSERT_TRUE(wheel.FindInstance(2).has_value());
+    EXPECT_EQ(wheel.FindInstance(2).value(), 1u);
+    EXPECT_FALSE(wheel.FindInstance(4).has_value());
+    
+    EXPECT_EQ(wheel.Cancel(2, 1), 1u);
+    EXPECT_EQ(wheel.Size(), 2u);
+    EXPECT_FALSE(wheel.FindInstance(2).has_value());
+    wheel.Clear();
+    EXPECT_EQ(wheel.NextDeadlineMs(), HeartbeatTimerWheel::NO_DEADLINE);
+}
+
 // ============================================================================
 // Slot Mapping Tests
 // ============================================================================
 
 /**
- * @test Verify fixed slot mapping (slot = service_id & 1023)
+ * @test Verify QM and ASIL services with the same low bits live in separate registries
  */
 TEST_F(SharedMemoryRegistryTest, FixedSlotMapping)
 {
@@ -308,6 +670,598 @@ TEST_F(SharedMemoryRegistryTest, ASIL_CD_ServiceID_Boundary)
     // Behavior depends on fallback logic in SelectRegistry
 }
 
+/**
+ * @test Routing table: built-in ranges, overrides and loading slot_mapping.yaml
+ */
+TEST(RegistryRoutingTableTest, RangesAndYaml)
+{
+    RegistryRoutingTable routing;
+    EXPECT_EQ(routing.Route(0x0100), RegistryType::QM);
+    EXPECT_EQ(routing.Route(0xF001), RegistryType::ASIL);
+    EXPECT_EQ(routing.Route(0xF3FE), RegistryType::ASIL);
+    EXPECT_EQ(routing.Route(0xF3FF), RegistryType::QM);
+    EXPECT_EQ(routing.Route(0xFFFF), RegistryType::BOTH);
+    EXPECT_EQ(routing.Route(0x1F001), RegistryType::ASIL) << "Only the low 16 bits route";
+    EXPECT_EQ(routing.GetSearch(), RegistrySearch::ROUTED);
+
+    // Later ranges override earlier ones
+    EXPECT_TRUE(routing.AddRange(0x0200, 0x02FF, RegistryType::ASIL));
+    EXPECT_FALSE(routing.AddRange(0x0300, 0x02FF, RegistryType::ASIL));
+    EXPECT_EQ(routing.Route(0x0250), RegistryType::ASIL);
+
+    char path[] = "/tmp/lap_routing_XXXXXX";
+    const int fd = mkstemp(path);
+    ASSERT_GE(fd, 0);
+    const char yaml[] =
+        "slot_mapping:\n"
+        "  registry_routing:\n"
+        "    default: ASIL\n"
+        "    search: combined\n"
+        "    ranges:\n"
+        "      - { first: 0x0001, last: 0x0417, registry: QM }\n"
+        "      - { first: 0x0400, last: 1100, registry: BOTH }\n";
+    ASSERT_EQ(write(fd, yaml, sizeof(yaml) - 1), static_cast<ssize_t>(sizeof(yaml) - 1));
+    close(fd);
+
+    ASSERT_TRUE(routing.Load(path).HasValue());
+    EXPECT_EQ(routing.Route(0x0001), RegistryType::QM);
+    EXPECT_EQ(routing.Route(0x03FF), RegistryType::QM);
+    EXPECT_EQ(routing.Route(0x0400), RegistryType::BOTH);
+    EXPECT_EQ(routing.Route(1100), RegistryType::BOTH);
+    EXPECT_EQ(routing.Route(1101), RegistryType::ASIL);
+    EXPECT_EQ(routing.Route(0x0250), RegistryType::QM) << "Load() replaces earlier ranges";
+    EXPECT_EQ(routing.GetSearch(), RegistrySearch::COMBINED);
+
+    // Invalid files leave the table unchanged
+    EXPECT_FALSE(routing.Load("/nonexistent/slot_mapping.yaml").HasValue());
+    std::FILE* file = std::fopen(path, "w");
+    ASSERT_NE(file, nullptr);
+    std::fputs("slot_mapping:\n  registry_routing:\n    ranges:\n"
+               "      - { first: 0x0500, last: 0x0400, registry: QM }\n", file);
+    std::fclose(file);
+    EXPECT_FALSE(routing.Load(path).HasValue());
+    EXPECT_EQ(routing.Route(0x0400), RegistryType::BOTH);
+    EXPECT_EQ(routing.GetSearch(), RegistrySearch::COMBINED);
+
+    // Files without the section (or without slot_mapping at all) keep the table
+    const char* unrelated[] = {
+        "logging:\n  level: info\n",
+        "slot_mapping:\n  max_slots_limit: 65536\n",
+        "",
+    };
+    for (const char* text : unrelated) {
+        file = std::fopen(path, "w");
+        ASSERT_NE(file, nullptr);
+        std::fputs(text, file);
+        std::fclose(file);
+        EXPECT_TRUE(routing.Load(path).HasValue()) << text;
+        EXPECT_EQ(routing.Route(0x0400), RegistryType::BOTH);
+    }
+    unlink(path);
+}
+
+/**
+ * @test COMBINED search finds a service registered under a different routing
+ */
+TEST_F(SharedMemoryRegistryTest, CombinedSearchAfterReclassification)
+{
+    // Provider still routes 0x0500 to QM ...
+    ASSERT_TRUE(registry_->RegisterService(0x0500, 1, 1, 0, "dds", "topic://reclassified").HasValue());
+
+    // ... while this client already routes it to ASIL
+    RegistryRoutingTable routing;
+    ASSERT_TRUE(routing.AddRange(0x0500, 0x0500, RegistryType::ASIL));
+    registry_->SetRoutingTable(routing);
+    EXPECT_FALSE(registry_->FindService(0x0500).has_value());
+    EXPECT_TRUE(registry_->FindAllInstances(0x0500).empty());
+
+    routing.SetSearch(RegistrySearch::COMBINED);
+    registry_->SetRoutingTable(routing);
+    auto found = registry_->FindService(0x0500);
+    ASSERT_TRUE(found.has_value());
+    EXPECT_STREQ(found.value().endpoint, "topic://reclassified");
+    EXPECT_EQ(registry_->FindAllInstances(0x0500).size(), 1u);
+
+    // Both halves (ASIL miss, QM hit) stay cached
+    auto before = registry_->GetLookupCacheStats();
+    ASSERT_TRUE(registry_->FindService(0x0500).has_value());
+    EXPECT_EQ(registry_->GetLookupCacheStats().hits - before.hits, 2u);
+    EXPECT_EQ(registry_->GetLookupCacheStats().misses, before.misses);
+
+    EXPECT_EQ(registry_->LookupService(0x0501).Error().Value(),
+              static_cast<int>(lap::com::ComErrc::kServiceNotAvailable));
+}
+
+/**
+ * @test Services whose low 10 bits collide coexist (open addressing)
+ */
+TEST_F(SharedMemoryRegistryTest, CollidingLowBitsCoexist)
+{
+    // 0x0001 and 0x0401 shared slot 1 under the former "service_id & 1023" mapping
+    ASSERT_TRUE(registry_->RegisterService(0x0001, 1, 1, 0, "iceoryx2", "shm://a").HasValue());
+    ASSERT_TRUE(registry_->RegisterService(0x0401, 1, 1, 0, "iceoryx2", "shm://b").HasValue());
+    
+    auto found1 = registry_->FindService(0x0001);
+    auto found2 = registry_->FindService(0x0401);
+    ASSERT_TRUE(found1.has_value());
+    ASSERT_TRUE(found2.has_value());
+    EXPECT_STREQ(found1.value().endpoint, "shm://a");
+    EXPECT_STREQ(found2.value().endpoint, "shm://b");
+    
+    // Unregistering one must not hide the other
+    ASSERT_TRUE(registry_->UnregisterService(0x0001).HasValue());
+    EXPECT_FALSE(registry_->FindService(0x0001).has_value());
+    EXPECT_TRUE(registry_->FindService(0x0401).has_value());
+}
+
+/**
+ * @test Duplicate registration of an active service ID is rejected
+ */
+TEST_F(SharedMemoryRegistryTest, DuplicateServiceRejected)
+{
+    ASSERT_TRUE(registry_->RegisterService(0x0123, 1, 1, 0, "dds", "test").HasValue());
+    EXPECT_FALSE(registry_->RegisterService(0x0123, 1, 1, 0, "dds", "test").HasValue());
+    
+    // Re-registration succeeds after unregister (tombstone slot is reused)
+    ASSERT_TRUE(registry_->UnregisterService(0x0123).HasValue());
+    EXPECT_TRUE(registry_->RegisterService(0x0123, 1, 1, 0, "dds", "test").HasValue());
+}
+
+/**
+ * @test Explicit placement only inside the service's probe window, reachable by lookups
+ */
+TEST(SingleRegistryTest, ExplicitSlotInsideProbeWindow)
+{
+    SingleRegistry registry(RegistryType::QM);
+    ASSERT_TRUE(registry.Initialize().HasValue());
+
+    // First registration of an empty registry lands in the home slot (step 0)
+    auto home = registry.RegisterService(0x0420, 9, 1, 0, "dds", "home");
+    ASSERT_TRUE(home.HasValue());
+    ASSERT_TRUE(registry.UnregisterService(home.Value()).HasValue());
+    const uint32_t usable = registry.GetSlotCount() - 1;
+    auto slot_at = [&](uint32_t step) { return 1 + (home.Value() - 1 + step) % usable; };
+
+    EXPECT_EQ(registry.RegisterService(slot_at(RegistryConfig::MAX_PROBE_STEPS), 0x0420, 1, 1, 0, "dds", "far")
+                  .Error().Value(), static_cast<int>(lap::com::ComErrc::kSlotIndexInvalid))
+        << "Slots outside the probe window are never reached by FindService";
+
+    // Step 5: steps 1..4 are EMPTY and must not end the probe sequence
+    ASSERT_TRUE(registry.RegisterService(slot_at(5), 0x0420, 1, 1, 0, "dds", "pinned").HasValue());
+    uint32_t found_slot = RegistryConfig::RESERVED_SLOT;
+    auto found = registry.FindService(0x0420, Liveness::ANY, found_slot);
+    ASSERT_TRUE(found.has_value());
+    EXPECT_EQ(found_slot, slot_at(5));
+
+    EXPECT_EQ(registry.RegisterService(slot_at(7), 0x0420, 1, 1, 0, "dds", "again").Error().Value(),
+              static_cast<int>(lap::com::ComErrc::kSlotAlreadyReserved));
+
+    // A second instance placed before the first joins the chain in probe order
+    ASSERT_TRUE(registry.RegisterService(slot_at(2), 0x0420, 2, 1, 0, "dds", "second").HasValue());
+    auto instances = registry.FindAllInstances(0x0420);
+    ASSERT_EQ(instances.size(), 2u);
+    EXPECT_EQ(instances[0].slot_index, slot_at(2));
+    EXPECT_EQ(instances[1].slot_index, slot_at(5));
+}
+
+/**
+ * @test A writer killed while holding the structure seqlock does not block later
+ *       writers, and its half-done update is repaired
+ */
+TEST(SingleRegistryTest, WriterDeathIsRecovered)
+{
+    SingleRegistry registry(RegistryType::QM);
+    ASSERT_TRUE(registry.Initialize().HasValue());
+    auto first = registry.RegisterService(0x0430, 1, 1, 0, "dds", "one");
+    auto second = registry.RegisterService(0x0430, 2, 1, 0, "dds", "two");
+    auto third = registry.RegisterService(0x0430, 3, 1, 0, "dds", "three");
+    ASSERT_TRUE(first.HasValue() && second.HasValue() && third.HasValue());
+
+    const uint32_t slot_count = registry.GetSlotCount();
+    void* base = mmap(nullptr, RegistryLayout::TotalSize(slot_count), PROT_READ | PROT_WRITE, MAP_SHARED,
+                      registry.GetMemfd(), 0);
+    ASSERT_NE(base, MAP_FAILED);
+    RegistryHeader* header = RegistryLayout::Header(base);
+    ServiceIndexEntry* index = RegistryLayout::Index(base, slot_count);
+    std::atomic<uint32_t>* chains = RegistryLayout::Chains(base, slot_count);
+
+    int ready[2];
+    ASSERT_EQ(pipe(ready), 0);
+    pid_t writer = fork();
+    if (writer == 0) {
+        // Start releasing the second instance: index entry torn, chain cut short
+        new RegistryWriteGuard(*header);
+        new SeqLockWriter(index[second.Value()].sequence);
+        chains[first.Value()].store(CHAIN_END);
+        char byte = 1;
+        (void)!write(ready[1], &byte, 1);
+        pause();
+        _exit(0);
+    }
+    ASSERT_GT(writer, 0);
+    char byte = 0;
+    ASSERT_EQ(read(ready[0], &byte, 1), 1);
+    kill(writer, SIGKILL);
+    waitpid(writer, nullptr, 0);
+    close(ready[0]);
+    close(ready[1]);
+    EXPECT_EQ(header->structure_sequence.load() & 1, 1u) << "Writer died inside the structure seqlock";
+
+    alarm(10);  // A writer blocked forever fails the test here
+    auto next = registry.RegisterService(0x0431, 1, 1, 0, "dds", "after");
+    alarm(0);
+    ASSERT_TRUE(next.HasValue());
+    EXPECT_EQ(header->structure_sequence.load() & 1, 0u);
+    EXPECT_EQ(index[second.Value()].sequence.load() & 1, 0u) << "Torn index seqlock restored to even";
+
+    // The torn instance is cleared and the chain relinked around it
+    auto instances = registry.FindAllInstances(0x0430);
+    ASSERT_EQ(instances.size(), 2u);
+    EXPECT_EQ(instances[0].instance_id, 1u);
+    EXPECT_EQ(instances[1].instance_id, 3u);
+    EXPECT_FALSE(registry.ReadSlot(second.Value()).value().IsActive());
+
+    // Later writes keep even parity and the chain stays intact
+    ASSERT_TRUE(registry.UnregisterService(first.Value()).HasValue());
+    EXPECT_EQ(index[first.Value()].sequence.load() & 1, 0u);
+    instances = registry.FindAllInstances(0x0430);
+    ASSERT_EQ(instances.size(), 1u);
+    EXPECT_EQ(instances[0].instance_id, 3u);
+
+    munmap(base, RegistryLayout::TotalSize(slot_count));
+}
+
+/**
+ * @test An unusable writer mutex makes writes fail instead of running unlocked
+ */
+TEST(SingleRegistryTest, CorruptWriterMutexRejectsWrites)
+{
+    SingleRegistry registry(RegistryType::QM);
+    ASSERT_TRUE(registry.Initialize().HasValue());
+    auto first = registry.RegisterService(0x0432, 1, 1, 0, "dds", "one");
+    ASSERT_TRUE(first.HasValue());
+
+    const uint32_t slot_count = registry.GetSlotCount();
+    void* base = mmap(nullptr, RegistryLayout::TotalSize(slot_count), PROT_READ | PROT_WRITE, MAP_SHARED,
+                      registry.GetMemfd(), 0);
+    ASSERT_NE(base, MAP_FAILED);
+    RegistryHeader* header = RegistryLayout::Header(base);
+
+    // Corrupted mutex (invalid kind): lock and trylock fail with EINVAL
+    std::memset(static_cast<void*>(&header->writer_mutex), 0xFF, sizeof(header->writer_mutex));
+    ASSERT_EQ(pthread_mutex_trylock(&header->writer_mutex), EINVAL);
+
+    const uint64_t sequence = header->structure_sequence.load();
+    const uint32_t generation = header->generation.load();
+    auto next = registry.RegisterService(0x0433, 1, 1, 0, "dds", "two");
+    ASSERT_FALSE(next.HasValue());
+    EXPECT_EQ(next.Error().Value(), static_cast<int>(lap::com::ComErrc::kRegistryLayoutMismatch));
+    EXPECT_EQ(registry.UnregisterService(first.Value()).Error().Value(),
+              static_cast<int>(lap::com::ComErrc::kRegistryLayoutMismatch));
+    EXPECT_EQ(header->structure_sequence.load(), sequence) << "Seqlock untouched without the lock";
+    EXPECT_EQ(header->generation.load(), generation);
+    EXPECT_TRUE(registry.FindService(0x0432).has_value());
+
+    munmap(base, RegistryLayout::TotalSize(slot_count));
+}
+
+/**
+ * @test Several instances of one service ID coexist and are all discoverable
+ */
+TEST_F(SharedMemoryRegistryTest, MultipleInstancesCoexist)
+{
+    constexpr uint64_t service_id = 0x0200;
+    for (uint64_t instance_id = 1; instance_id <= 3; ++instance_id) {
+        ASSERT_TRUE(registry_->RegisterService(
+            service_id, instance_id, 1, 0, "iceoryx2", "shm://replica").HasValue());
+    }
+    
+    // Same (service_id, instance_id) is still a duplicate
+    EXPECT_FALSE(registry_->RegisterService(service_id, 2, 1, 0, "iceoryx2", "shm://replica").HasValue());
+    
+    auto instances = registry_->FindAllInstances(service_id);
+    ASSERT_EQ(instances.size(), 3u);
+    for (uint64_t i = 0; i < 3; ++i) {
+        EXPECT_EQ(instances[i].instance_id, i + 1);
+        EXPECT_EQ(instances[i].major_version, 1u);
+        EXPECT_EQ(instances[i].owner_pid, getpid());
+    }
+    
+    // FindService returns the head of the chain
+    auto found = registry_->FindService(service_id);
+    ASSERT_TRUE(found.has_value());
+    EXPECT_EQ(found.value().instance_id, 1u);
+    
+    EXPECT_TRUE(registry_->FindAllInstances(0x0201).empty());
+}
+
+/**
+ * @test Unregistering one instance keeps the rest of the chain intact
+ */
+TEST_F(SharedMemoryRegistryTest, UnregisterSingleInstance)
+{
+    constexpr uint64_t service_id = 0x0300;
+    for (uint64_t instance_id = 1; instance_id <= 3; ++instance_id) {
+        ASSERT_TRUE(registry_->RegisterService(
+            service_id, instance_id, 1, 0, "dds", "topic://replica").HasValue());
+    }
+    
+    ASSERT_TRUE(registry_->UnregisterService(service_id, 2).HasValue());
+    EXPECT_FALSE(registry_->UnregisterService(service_id, 2).HasValue());
+    
+    auto instances = registry_->FindAllInstances(service_id);
+    ASSERT_EQ(instances.size(), 2u);
+    EXPECT_EQ(instances[0].instance_id, 1u);
+    EXPECT_EQ(instances[1].instance_id, 3u);
+    
+    // New instance reuses the tombstone and is linked in probe order
+    ASSERT_TRUE(registry_->RegisterService(service_id, 4, 1, 0, "dds", "topic://replica").HasValue());
+    instances = registry_->FindAllInstances(service_id);
+    ASSERT_EQ(instances.size(), 3u);
+    EXPECT_EQ(instances[0].instance_id, 1u);
+    EXPECT_EQ(instances[1].instance_id, 4u);
+    EXPECT_EQ(instances[2].instance_id, 3u);
+    
+    // Removing the head promotes the next instance
+    ASSERT_TRUE(registry_->UnregisterService(service_id, 1).HasValue());
+    instances = registry_->FindAllInstances(service_id);
+    ASSERT_EQ(instances.size(), 2u);
+    EXPECT_EQ(instances[0].instance_id, 4u);
+    EXPECT_EQ(registry_->FindService(service_id).value().instance_id, 4u);
+}
+
+/**
+ * @test Index entries mirror the hot fields of their slot
+ */
+TEST_F(SharedMemoryRegistryTest, IndexEntryMirrorsSlot)
+{
+    constexpr uint64_t service_id = 0x0150;
+    SingleRegistry single(RegistryType::QM);
+    ASSERT_TRUE(single.Initialize().HasValue());
+    auto slot_index = single.RegisterService(service_id, 7, 2, 1, "iceoryx2", "shm://hot/cold");
+    ASSERT_TRUE(slot_index.HasValue());
+    ASSERT_TRUE(single.UpdateHeartbeat(slot_index.Value(), 987654321ULL).HasValue());
+    
+    auto entry = single.FindServiceIndex(service_id);
+    ASSERT_TRUE(entry.has_value());
+    EXPECT_EQ(entry.value().instance_id, 7u);
+    EXPECT_EQ(entry.value().major_version, 2u);
+    EXPECT_EQ(entry.value().minor_version, 1u);
+    EXPECT_EQ(entry.value().last_heartbeat_ns, 987654321ULL);
+    EXPECT_EQ(entry.value().owner_pid, getpid());
+    
+    // Full slot still carries the cold fields
+    auto slot = single.FindService(service_id);
+    ASSERT_TRUE(slot.has_value());
+    EXPECT_STREQ(slot.value().endpoint, "shm://hot/cold");
+    EXPECT_EQ(slot.value().last_heartbeat_ns, 987654321ULL);
+    
+    ASSERT_TRUE(single.UnregisterService(slot_index.Value()).HasValue());
+    EXPECT_FALSE(single.FindServiceIndex(service_id).has_value());
+}
+
+/**
+ * @test Snapshot returns the hot fields of every active service exactly once
+ */
+TEST_F(SharedMemoryRegistryTest, SnapshotActiveServices)
+{
+    ASSERT_TRUE(registry_->RegisterService(0x0010, 1, 1, 0, "iceoryx2", "shm://a").HasValue());
+    ASSERT_TRUE(registry_->RegisterService(0x0010, 2, 1, 0, "iceoryx2", "shm://b").HasValue());
+    ASSERT_TRUE(registry_->RegisterService(0x0020, 1, 2, 0, "dds", "topic://c").HasValue());
+    ASSERT_TRUE(registry_->RegisterService(0xF010, 1, 3, 0, "dds", "topic://d").HasValue());
+    ASSERT_TRUE(registry_->UnregisterService(0x0020).HasValue());
+    
+    std::vector<ServiceSlotSummary> entries;
+    auto result = registry_->Snapshot(entries);
+    ASSERT_TRUE(result.HasValue());
+    EXPECT_EQ(result.Value(), 0u);
+    ASSERT_EQ(entries.size(), 3u);
+    
+    uint32_t qm_instances = 0;
+    for (const auto& entry : entries) {
+        EXPECT_NE(entry.service_id, 0x0020u) << "Unregistered service must not appear";
+        EXPECT_NE(entry.slot_index, RegistryConfig::RESERVED_SLOT);
+        EXPECT_GT(entry.last_heartbeat_ns, 0u);
+        EXPECT_EQ(entry.owner_pid, getpid());
+        qm_instances += (entry.service_id == 0x0010) ? 1 : 0;
+    }
+    EXPECT_EQ(qm_instances, 2u);
+    
+    // QM entries come first
+    EXPECT_EQ(entries.back().service_id, 0xF010u);
+    EXPECT_EQ(entries.back().major_version, 3u);
+}
+
+/**
+ * @test Waiters sleep until a registration changes the generation
+ */
+TEST_F(SharedMemoryRegistryTest, WaitForChangeWakesOnRegister)
+{
+    constexpr uint64_t service_id = 0x0042;
+    uint32_t generation = registry_->GetGeneration(service_id);
+    
+    // Nothing happens: wait times out
+    auto timed_out = registry_->WaitForChange(service_id, generation, milliseconds(20));
+    ASSERT_FALSE(timed_out.HasValue());
+    EXPECT_EQ(timed_out.Error().Value(), static_cast<int>(lap::com::ComErrc::kTimeout));
+    
+    // Stale generation returns immediately
+    auto stale = registry_->WaitForChange(service_id, generation - 1, milliseconds(0));
+    ASSERT_TRUE(stale.HasValue());
+    EXPECT_EQ(stale.Value(), generation);
+    
+    std::atomic<bool> woken{false};
+    std::thread waiter([&]() {
+        auto result = registry_->WaitForChange(service_id, generation, seconds(5));
+        EXPECT_TRUE(result.HasValue());
+        woken.store(true, std::memory_order_release);
+    });
+    
+    std::this_thread::sleep_for(milliseconds(20));
+    EXPECT_FALSE(woken.load(std::memory_order_acquire));
+    
+    auto start = steady_clock::now();
+    ASSERT_TRUE(registry_->RegisterService(service_id, 1, 1, 0, "iceoryx2", "shm://notify").HasValue());
+    waiter.join();
+    EXPECT_TRUE(woken.load(std::memory_order_acquire));
+    EXPECT_LT(duration_cast<milliseconds>(steady_clock::now() - start).count(), 1000);
+    
+    // Heartbeats are not structural changes
+    uint32_t after_register = registry_->GetGeneration(service_id);
+    EXPECT_NE(after_register, generation);
+    ASSERT_TRUE(registry_->UpdateHeartbeat(service_id, 12345).HasValue());
+    EXPECT_EQ(registry_->GetGeneration(service_id), after_register);
+}
+
+/**
+ * @test Rejected and no-op writes leave the generation (and client caches) alone
+ */
+TEST(SingleRegistryTest, FailedWritesKeepGeneration)
+{
+    SingleRegistry registry(RegistryType::QM);
+    ASSERT_TRUE(registry.Initialize().HasValue());
+    auto first = registry.RegisterService(0x0434, 1, 1, 0, "dds", "one");
+    ASSERT_TRUE(first.HasValue());
+    const uint32_t generation = registry.GetGeneration();
+
+    // Duplicate instance
+    EXPECT_FALSE(registry.RegisterService(0x0434, 1, 1, 0, "dds", "again").HasValue());
+    // Explicit slot already occupied
+    EXPECT_FALSE(registry.RegisterService(first.Value(), 0x0435, 1, 1, 0, "dds", "taken").HasValue());
+    // Owner mismatch
+    EXPECT_FALSE(registry.ReclaimSlot(first.Value(), getpid() + 1).HasValue());
+    EXPECT_EQ(registry.GetGeneration(), generation);
+
+    ASSERT_TRUE(registry.UnregisterService(first.Value()).HasValue());
+    const uint32_t after_unregister = registry.GetGeneration();
+    EXPECT_NE(after_unregister, generation);
+
+    // Releasing a free slot changes nothing
+    ASSERT_TRUE(registry.UnregisterService(first.Value()).HasValue());
+    EXPECT_EQ(registry.GetGeneration(), after_unregister);
+}
+
+/**
+ * @test Arbitrary 64-bit service IDs fill a single registry at high load
+ */
+TEST(SingleRegistryTest, OpenAddressingHighLoad)
+{
+    SingleRegistry registry(RegistryType::QM);
+    ASSERT_TRUE(registry.Initialize().HasValue());
+    ASSERT_EQ(registry.GetSlotCount(), RegistryConfig::MAX_SLOTS);
+    
+    // ~75% load with a non-uniform ID distribution (stride of 1024)
+    constexpr uint32_t NUM_SERVICES = 768;
+    for (uint32_t i = 0; i < NUM_SERVICES; ++i) {
+        uint64_t service_id = 0x10000ULL + static_cast<uint64_t>(i) * 1024;
+        auto result = registry.RegisterService(service_id, i, 1, 0, "dds", "test");
+        ASSERT_TRUE(result.HasValue()) << "Failed at service " << i;
+        EXPECT_NE(result.Value(), RegistryConfig::RESERVED_SLOT);
+    }
+    
+    for (uint32_t i = 0; i < NUM_SERVICES; ++i) {
+        uint64_t service_id = 0x10000ULL + static_cast<uint64_t>(i) * 1024;
+        auto found = registry.FindService(service_id);
+        ASSERT_TRUE(found.has_value()) << "Missing service " << i;
+        EXPECT_EQ(found.value().instance_id, i);
+    }
+    
+    EXPECT_FALSE(registry.FindService(0xDEADBEEFULL).has_value());
+}
+
+/**
+ * @test Vectorized tag scan agrees with the scalar reference and the probe lookup
+ */
+TEST(SingleRegistryTest, ScanServiceMatchesScalar)
+{
+    SingleRegistry registry(RegistryType::QM);
+    ASSERT_TRUE(registry.Initialize().HasValue());
+
+    // ~50% load, every 16th service with three instances
+    constexpr uint32_t NUM_SERVICES = 448;
+    for (uint32_t i = 0; i < NUM_SERVICES; ++i) {
+        const uint64_t service_id = 0x20000ULL + i;
+        const uint32_t instances = (i % 16 == 0) ? 3 : 1;
+        for (uint32_t instance = 1; instance <= instances; ++instance) {
+            ASSERT_TRUE(registry.RegisterService(service_id, instance, 1, 0, "dds", "t").HasValue());
+        }
+    }
+    ASSERT_TRUE(registry.UnregisterService(registry.FindSlot(0x20001ULL).value()).HasValue());
+
+    std::vector<ServiceSlotSummary> all;
+    ASSERT_TRUE(registry.Snapshot(all).HasValue());
+    EXPECT_EQ(all.size(), NUM_SERVICES + (NUM_SERVICES / 16) * 2 - 1);
+
+    for (uint64_t service_id : {0x20000ULL, 0x20001ULL, 0x20010ULL, 0x20005ULL, 0xDEADBEEFULL}) {
+        std::vector<ServiceSlotSummary> scanned;
+        ASSERT_TRUE(registry.ScanService(service_id, scanned).HasValue());
+        auto probed = registry.FindAllInstances(service_id);
+        ASSERT_EQ(scanned.size(), probed.size()) << std::hex << service_id;
+
+        std::vector<uint32_t> scanned_slots;
+        std::vector<uint32_t> probed_slots;
+        for (const auto& entry : scanned) {
+            EXPECT_EQ(entry.service_id, service_id);
+            scanned_slots.push_back(entry.slot_index);
+        }
+        for (const auto& instance : probed) {
+            probed_slots.push_back(instance.slot_index);
+        }
+        std::sort(probed_slots.begin(), probed_slots.end());
+        EXPECT_EQ(scanned_slots, probed_slots);  // Scan returns slot order
+    }
+
+    // Every 64-tag pattern: SIMD masks equal the scalar reference
+    alignas(64) std::atomic<uint8_t> block[TagScan::BLOCK_SIZE];
+    for (uint32_t round = 0; round < 256; ++round) {
+        for (uint32_t i = 0; i < TagScan::BLOCK_SIZE; ++i) {
+            block[i].store(static_cast<uint8_t>((i * 7 + round * 13) % (round % 5 + 2)), std::memory_order_relaxed);
+        }
+        const uint8_t tag = static_cast<uint8_t>(round % 4);
+        EXPECT_EQ(TagScan::MatchMask(block, tag), TagScan::MatchMaskScalar(block, tag)) << TagScan::Isa();
+        EXPECT_EQ(TagScan::LiveMask(block), TagScan::LiveMaskScalar(block)) << TagScan::Isa();
+    }
+    EXPECT_EQ(TagScan::ValidMask(0, 1024), ~1ULL);
+    EXPECT_EQ(TagScan::ValidMask(960, 1000), (1ULL << 40) - 1);
+}
+
+/**
+ * @test Memory options parse and degrade gracefully (no huge pages / RLIMIT_MEMLOCK)
+ */
+TEST(SingleRegistryTest, MemoryOptionsFallBack)
+{
+    RegistryMemoryOptions options;
+    ASSERT_TRUE(RegistryMemoryOptions::Parse("hugepages,populate,mlock", options));
+    EXPECT_TRUE(options.huge_pages);
+    EXPECT_TRUE(options.populate);
+    EXPECT_TRUE(options.lock);
+    EXPECT_FALSE(RegistryMemoryOptions::Parse("populate,bogus", options));
+    EXPECT_TRUE(options.huge_pages);  // Unchanged on error
+    ASSERT_TRUE(RegistryMemoryOptions::Parse(nullptr, options));
+    EXPECT_FALSE(options.huge_pages || options.populate || options.lock);
+
+    ASSERT_TRUE(RegistryMemoryOptions::Parse("hugepages,populate,mlock", options));
+    SingleRegistry registry(RegistryType::QM);
+    registry.SetMemoryOptions(options);
+    ASSERT_TRUE(registry.Initialize().HasValue());
+    ASSERT_EQ(registry.GetSlotCount(), RegistryConfig::MAX_SLOTS);
+
+    // Huge pages and mlock depend on the host; the registry works either way
+    auto slot = registry.RegisterService(0x5150, 1, 1, 0, "shm", "mem-test");
+    ASSERT_TRUE(slot.HasValue());
+    auto found = registry.FindService(0x5150);
+    ASSERT_TRUE(found.has_value());
+    EXPECT_EQ(found.value().instance_id, 1u);
+
+    // A populated client view of the same memfd sees the same registry
+    SingleRegistry client(RegistryType::QM);
+    options.huge_pages = false;
+    client.SetMemoryOptions(options);
+    ASSERT_TRUE(client.InitializeFromFd(registry.GetMemfd()).HasValue());
+    EXPECT_EQ(client.IsHugePageBacked(), registry.IsHugePageBacked());
+    EXPECT_TRUE(client.FindService(0x5150).has_value());
+}
+
 // ============================================================================
 // Performance Tests
 // ============================================================================
@@ -378,7 +1332,7 @@ TEST_F(SharedMemoryRegistryTest, RegisterServiceLatency)
         auto end = high_resolution_clock::now();
         
         ASSERT_TRUE(result.HasValue()) << "Failed to register service_id 0x" 
-            << std::hex << service_id << " (slot " << std::dec << (service_id & 1023) << ")";
+            << std::hex << service_id;
         latencies_ns.push_back(duration_cast<nanoseconds>(end - start).count());
     }
     
@@ -299,6 +299,60 @@ TEST_F(SeqLockTest, ConcurrentReadWrite)
               << successful_writes.load() << " successful writes" << std::endl;
 }
 
+/**
+ * @test Batched range read delivers only selected slots, each consistent
+ */
+TEST_F(SeqLockTest, ReadRangeConsistency)
+{
+    constexpr uint32_t NUM_SLOTS = 100;  // Not a multiple of RANGE_BATCH_SIZE
+    std::vector<ServiceSlot> slots(NUM_SLOTS);
+    for (uint32_t i = 0; i < NUM_SLOTS; ++i) {
+        slots[i].service_id = i;
+        slots[i].instance_id = i;
+        slots[i].status = static_cast<uint32_t>((i % 2 == 0) ? SlotStatus::ACTIVE : SlotStatus::IDLE);
+    }
+    
+    std::atomic<bool> stop_flag{false};
+    
+    // Writer keeps service_id == instance_id invariant on the active slots
+    std::thread writer([&]() {
+        uint64_t value = NUM_SLOTS;
+        while (!stop_flag.load(std::memory_order_acquire)) {
+            ServiceSlot& slot = slots[(value * 2) % NUM_SLOTS];
+            SeqLockWriter lock(slot.sequence);
+            slot.service_id = value;
+            slot.instance_id = value;
+            ++value;
+        }
+    });
+    
+    auto read_ids = [](const ServiceSlot& s) -> lap::core::Optional<std::pair<uint64_t, uint64_t>> {
+        if (!s.IsActive()) {
+            return lap::core::Optional<std::pair<uint64_t, uint64_t>>{};
+        }
+        return std::make_pair(s.service_id, s.instance_id);
+    };
+    
+    uint64_t torn = 0;
+    uint64_t delivered = 0;
+    for (int round = 0; round < 1000; ++round) {
+        uint32_t failed = SeqLockReader::ReadRange(
+            slots.data(), NUM_SLOTS, read_ids,
+            [&](uint32_t index, std::pair<uint64_t, uint64_t>&& ids) {
+                EXPECT_EQ(index % 2, 0u) << "Inactive slot must be skipped";
+                torn += (ids.first != ids.second) ? 1 : 0;
+                ++delivered;
+            });
+        EXPECT_EQ(failed, 0u);
+    }
+    
+    stop_flag.store(true, std::memory_order_release);
+    writer.join();
+    
+    EXPECT_EQ(torn, 0u) << "ReadRange must never deliver a torn slot";
+    EXPECT_EQ(delivered, 1000u * NUM_SLOTS / 2);
+}
+
 // ============================================================================
 // Performance Tests
 // ============================================================================
@@ -412,6 +466,63 @@ TEST_F(SeqLockTest, ReadRetryLimit)
     EXPECT_FALSE(result.has_value()) << "Read should fail when write lock is held";
 }
 
+/**
+ * @test A configured backoff bounds the retries and reports the give-up
+ */
+TEST_F(SeqLockTest, BackoffRetryBudget)
+{
+    const SeqLockBackoff saved = SeqLockReader::GetBackoff();
+    SeqLockBackoff policy;
+    policy.spin_count = 4;
+    policy.pause_rounds = 2;
+    policy.yield_count = 2;
+    policy.wait_count = 2;
+    SeqLockReader::SetBackoff(policy);
+
+    uint32_t retries = 0;
+    {
+        SeqLockWriter writer(slot_.sequence);
+        auto result = SeqLockReader::ReadSlot(slot_, retries);
+        EXPECT_FALSE(result.has_value());
+    }
+
+    EXPECT_EQ(retries, policy.MaxRetries() + 1);
+    EXPECT_TRUE(SeqLockReader::GaveUp(retries));
+    EXPECT_FALSE(SeqLockReader::GaveUp(policy.MaxRetries()));
+    SeqLockReader::SetBackoff(saved);
+}
+
+/**
+ * @test A writer preempted for longer than a spin budget does not fail the read
+ *
+ * Holds the write lock for 200 µs - far beyond a pure PAUSE spin - and
+ * checks that the default policy escalates to yield/sleep and succeeds.
+ */
+TEST_F(SeqLockTest, BackoffOutlastsSlowWriter)
+{
+    std::atomic<bool> locked{false};
+    std::thread writer([this, &locked]() {
+        SeqLockWriter lock(slot_.sequence);
+        slot_.service_id = 0x1234;
+        locked.store(true, std::memory_order_release);
+        std::this_thread::sleep_for(microseconds(200));
+    });
+    while (!locked.load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+    }
+
+    uint32_t retries = 0;
+    auto result = SeqLockReader::Read(slot_, [](const ServiceSlot& s) {
+        return s.service_id;
+    }, retries);
+    writer.join();
+
+    ASSERT_TRUE(result.has_value()) << "Read gave up after " << retries << " retries";
+    EXPECT_EQ(result.value(), 0x1234u);
+    EXPECT_GT(retries, 0u);
+    EXPECT_FALSE(SeqLockReader::GaveUp(retries));
+}
+
 /**
  * @test Slot reset functionality
  */
@@ -439,6 +550,89 @@ TEST_F(SeqLockTest, SlotReset)
     EXPECT_EQ(slot_.endpoint[0], '\0');
 }
 
+// ============================================================================
+// SeqLocked<T, N> Tests
+// ============================================================================
+
+namespace
+{
+    /// Larger than a cache line so a torn copy would be visible
+    struct Pose
+    {
+        uint64_t words[24];
+    };
+}
+
+/**
+ * @test Versions start at 1 and Load() returns the newest value
+ */
+TEST(SeqLockedTest, StoreLoad)
+{
+    SeqLocked<Pose, 2> state;
+    Pose pose{};
+    EXPECT_EQ(state.Version(), 0u);
+    EXPECT_EQ(state.Load(pose), 0u) << "Never written";
+
+    for (uint64_t i = 1; i <= 5; ++i) {
+        std::fill(std::begin(pose.words), std::end(pose.words), i);
+        EXPECT_EQ(state.Store(pose), i);
+    }
+
+    Pose loaded{};
+    uint32_t retries = 0;
+    EXPECT_EQ(state.Load(loaded, retries), 5u);
+    EXPECT_EQ(retries, 0u);
+    EXPECT_EQ(loaded.words[0], 5u);
+    EXPECT_EQ(loaded.words[23], 5u);
+}
+
+/**
+ * @test Concurrent readers never observe a torn value or a version going back
+ */
+TEST(SeqLockedTest, ConcurrentReadersSeeConsistentValues)
+{
+    SeqLocked<Pose, 2> state;
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> torn{0};
+    std::atomic<uint64_t> regressions{0};
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 3; ++r) {
+        readers.emplace_back([&]() {
+            Pose pose{};
+            uint64_t last = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                const uint64_t version = state.Load(pose);
+                if (version == 0) {
+                    continue;
+                }
+                if (!std::all_of(std::begin(pose.words), std::end(pose.words),
+                                 [version](uint64_t w) { return w == version; })) {
+                    torn.fetch_add(1);
+                }
+                if (version < last) {
+                    regressions.fetch_add(1);
+                }
+                last = version;
+            }
+        });
+    }
+
+    Pose pose{};
+    for (uint64_t i = 1; i <= 200000; ++i) {
+        std::fill(std::begin(pose.words), std::end(pose.words), i);
+        state.Store(pose);
+    }
+    stop.store(true);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_EQ(torn.load(), 0u);
+    EXPECT_EQ(regressions.load(), 0u);
+    EXPECT_EQ(state.Version(), 200000u);
+}
+
 // ============================================================================
 // Main
 // ============================================================================
@@ -0,0 +1,870 @@
+/**
+ * @file        test_event.cpp
+ * @author      LightAP Development Team
+ * @brief       Unit tests for the ProxyEvent receive path
+ * @date        2025-11-20
+ * @details     Tests SampleQueue (ordering, drop-oldest overflow, multiple
+ *              producers) and ProxyEvent delivery from a binding thread,
+ *              including the batched GetNewSamples(f, max) drain, and the
+ *              SamplePool behind SkeletonEvent::Allocate() and received samples,
+ *              and zero-copy sends and receives through transport loans.
+ * @copyright   Copyright (c) 2025
+ * sdk:
+ * platform:    Linux 5.10+
+ * project:     LightAP
+ * @version
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author          <th>Description
+ * <tr><td>2025/11/20  <td>1.0      <td>LightAP Team    <td>Initial lock-free sample queue tests
+ * <tr><td>2025/11/21  <td>1.1      <td>LightAP Team    <td>Batched GetNewSamples(f, max)
+ * <tr><td>2025/11/22  <td>1.2      <td>LightAP Team    <td>Pooled sample allocation
+ * <tr><td>2025/11/23  <td>1.3      <td>LightAP Team    <td>Zero-copy send through loans
+ * <tr><td>2025/11/24  <td>1.4      <td>LightAP Team    <td>Zero-copy receive of borrowed samples
+ * </table>
+ */
+
+#include "Event.hpp"
+#include "SkeletonBase.hpp"
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace lap
+{
+namespace com
+{
+    /**
+     * @brief Test stand-in for the binding that feeds ProxyEvent::PushSample()
+     */
+    class EventBinding
+    {
+    public:
+        template<typename SampleType>
+        static void Deliver(ProxyEvent<SampleType>& event, SampleType value)
+        {
+            event.PushSample(SamplePtr<SampleType>(new SampleType(value)));
+        }
+
+        /// Deliver the way a binding does: deserialize into AllocateSample()
+        template<typename SampleType>
+        static SampleStorage* DeliverPooled(ProxyEvent<SampleType>& event, SampleType value)
+        {
+            auto sample = event.AllocateSample();
+            *sample = value;
+            SampleStorage* pool = sample.get_deleter().Storage();
+            event.PushSample(std::move(sample));
+            return pool;
+        }
+
+        /// Storage of the samples the binding gets from AllocateSample() (nullptr = heap)
+        template<typename SampleType>
+        static SampleStorage* PoolOf(ProxyEvent<SampleType>& event)
+        {
+            return event.AllocateSample().get_deleter().Storage();
+        }
+    };
+} // namespace com
+} // namespace lap
+
+using namespace lap::com;
+
+namespace
+{
+    /**
+     * @brief Binding that loans payloads from its own heap buffers
+     */
+    class LoanBinding : public binding::ITransportBinding
+    {
+    public:
+        explicit LoanBinding(bool zeroCopy = true, uint32_t maxLoans = 4)
+            : zero_copy_(zeroCopy), max_loans_(maxLoans) {}
+
+        Result<binding::EventLoan> LoanEvent(uint64_t service_id, uint64_t instance_id,
+                                             uint32_t event_id, size_t size) noexcept override
+        {
+            if (outstanding >= max_loans_) {
+                return Result<binding::EventLoan>::FromError(MakeErrorCode(ComErrc::kNetworkBindingFailure, 0));
+            }
+            binding::EventLoan loan;
+            loan.service_id = service_id;
+            loan.instance_id = instance_id;
+            loan.event_id = event_id;
+            loan.payload = new std::max_align_t[(size + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t)];
+            loan.size = size;
+            loan.handle = loan.payload;
+            ++outstanding;
+            return Result<binding::EventLoan>::FromValue(loan);
+        }
+
+        Result<void> SendLoanedEvent(binding::EventLoan& loan) noexcept override
+        {
+            sent.assign(static_cast<uint8_t*>(loan.payload), static_cast<uint8_t*>(loan.payload) + loan.size);
+            delete[] static_cast<std::max_align_t*>(loan.handle);
+            loan.handle = nullptr;
+            --outstanding;
+            ++loaned_sends;
+            return Result<void>::FromValue();
+        }
+
+        void ReleaseLoanedEvent(binding::EventLoan& loan) noexcept override
+        {
+            delete[] static_cast<std::max_align_t*>(loan.handle);
+            loan.handle = nullptr;
+            --outstanding;
+            ++released;
+        }
+
+        Result<void> SendEvent(uint64_t, uint64_t, uint32_t, const binding::ByteBuffer& data) noexcept override
+        {
+            sent = data;
+            ++copied_sends;
+            return Result<void>::FromValue();
+        }
+
+        Result<void> Initialize() noexcept override { return Result<void>::FromValue(); }
+        Result<void> Shutdown() noexcept override { return Result<void>::FromValue(); }
+        Result<void> OfferService(uint64_t, uint64_t) noexcept override { return Result<void>::FromValue(); }
+        Result<void> StopOfferService(uint64_t, uint64_t) noexcept override { return Result<void>::FromValue(); }
+        Result<std::vector<uint64_t>> FindService(uint64_t) noexcept override
+        {
+            return Result<std::vector<uint64_t>>::FromValue({});
+        }
+        Result<void> SubscribeEvent(uint64_t, uint64_t, uint32_t, binding::EventCallback) noexcept override
+        {
+            return Result<void>::FromValue();
+        }
+        Result<void> UnsubscribeEvent(uint64_t, uint64_t, uint32_t) noexcept override
+        {
+            deliver_ = nullptr;
+            return Result<void>::FromValue();
+        }
+
+        Result<void> SubscribeLoanedEvent(uint64_t, uint64_t, uint32_t,
+                                          binding::LoanedEventCallback callback) noexcept override
+        {
+            deliver_ = std::move(callback);
+            return Result<void>::FromValue();
+        }
+
+        void ReleaseReceivedEvent(binding::EventLoan& loan) noexcept override
+        {
+            delete[] static_cast<std::max_align_t*>(loan.handle);
+            loan.handle = nullptr;
+            --borrowed;
+        }
+
+        uint32_t GetMaxBorrowedSamples() const noexcept override { return max_borrowed; }
+
+        /// Deliver @p size bytes placed @p offset bytes into a fresh buffer
+        const void* Receive(const void* data, size_t size, size_t offset = 0)
+        {
+            auto* buffer = new std::max_align_t[(offset + size) / sizeof(std::max_align_t) + 1];
+            binding::EventLoan loan;
+            loan.payload = reinterpret_cast<uint8_t*>(buffer) + offset;
+            loan.size = size;
+            loan.handle = buffer;
+            std::memcpy(loan.payload, data, size);
+            ++borrowed;
+            deliver_(loan);
+            return loan.payload;
+        }
+
+        bool Subscribed() const noexcept
+        {
+            return static_cast<bool>(deliver_);
+        }
+        Result<binding::ByteBuffer> CallMethod(uint64_t, uint64_t, uint32_t, const binding::ByteBuffer&) noexcept override
+        {
+            return Result<binding::ByteBuffer>::FromError(MakeErrorCode(ComErrc::kNotSupported, 0));
+        }
+        Result<void> RegisterMethod(uint64_t, uint64_t, uint32_t, binding::MethodCallback) noexcept override
+        {
+            return Result<void>::FromError(MakeErrorCode(ComErrc::kNotSupported, 0));
+        }
+        Result<binding::ByteBuffer> GetField(uint64_t, uint64_t, uint32_t) noexcept override
+        {
+            return Result<binding::ByteBuffer>::FromError(MakeErrorCode(ComErrc::kNotSupported, 0));
+        }
+        Result<void> SetField(uint64_t, uint64_t, uint32_t, const binding::ByteBuffer&) noexcept override
+        {
+            return Result<void>::FromError(MakeErrorCode(ComErrc::kNotSupported, 0));
+        }
+        const char* GetName() const noexcept override { return "loan"; }
+        uint32_t GetVersion() const noexcept override { return 1; }
+        uint32_t GetPriority() const noexcept override { return 0; }
+        bool SupportsZeroCopy() const noexcept override { return zero_copy_; }
+        bool SupportsService(uint64_t) const noexcept override { return true; }
+        binding::TransportMetrics GetMetrics() const noexcept override { return binding::TransportMetrics(); }
+
+        uint32_t outstanding{0};
+        uint32_t released{0};
+        uint32_t loaned_sends{0};
+        uint32_t copied_sends{0};
+        uint32_t borrowed{0};
+        uint32_t max_borrowed{0};
+        binding::ByteBuffer sent;
+
+    private:
+        bool zero_copy_;
+        uint32_t max_loans_;
+        binding::LoanedEventCallback deliver_;
+    };
+
+    /**
+     * @brief Zero-copy binding whose listener thread delivers continuously
+     * @details Like a real binding, UnsubscribeEvent() returns only once the
+     *          listener no longer calls back.
+     */
+    class ListenerBinding : public LoanBinding
+    {
+    public:
+        ~ListenerBinding() override
+        {
+            Stop();
+        }
+
+        Result<void> SubscribeLoanedEvent(uint64_t, uint64_t, uint32_t,
+                                          binding::LoanedEventCallback callback) noexcept override
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            deliver_ = std::move(callback);
+            return Result<void>::FromValue();
+        }
+
+        Result<void> UnsubscribeEvent(uint64_t, uint64_t, uint32_t) noexcept override
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            deliver_ = nullptr;
+            return Result<void>::FromValue();
+        }
+
+        void ReleaseReceivedEvent(binding::EventLoan& loan) noexcept override
+        {
+            delete[] static_cast<std::max_align_t*>(loan.handle);
+            loan.handle = nullptr;
+            in_flight.fetch_sub(1);
+        }
+
+        /// Deliver frames (every other one misaligned, so it is copied) until Stop()
+        template<typename SampleType>
+        void Start()
+        {
+            running_ = true;
+            listener_ = std::thread([this]() {
+                uint32_t sequence = 0;
+                while (running_.load()) {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    if (!deliver_) {
+                        continue;
+                    }
+                    const size_t offset = sequence % 2;
+                    auto* buffer = new std::max_align_t[(offset + sizeof(SampleType)) / sizeof(std::max_align_t) + 1];
+                    binding::EventLoan loan;
+                    loan.payload = reinterpret_cast<uint8_t*>(buffer) + offset;
+                    loan.size = sizeof(SampleType);
+                    loan.handle = buffer;
+                    std::memset(loan.payload, 0, sizeof(SampleType));
+                    std::memcpy(loan.payload, &sequence, sizeof(sequence));
+                    ++sequence;
+                    in_flight.fetch_add(1);
+                    deliver_(loan);
+                    delivered.fetch_add(1);
+                }
+            });
+        }
+
+        void Stop()
+        {
+            running_ = false;
+            if (listener_.joinable()) {
+                listener_.join();
+            }
+        }
+
+        std::atomic<uint32_t> delivered{0};
+        std::atomic<int32_t> in_flight{0};
+
+    private:
+        std::mutex mutex_;
+        binding::LoanedEventCallback deliver_;
+        std::atomic<bool> running_{false};
+        std::thread listener_;
+    };
+
+    struct Frame
+    {
+        uint32_t sequence;
+        uint8_t pixels[60];
+    };
+    
+    /**
+     * @brief Skeleton owning one event, offered through SkeletonBase
+     */
+    class FrameSkeleton : public SkeletonBase
+    {
+    public:
+        FrameSkeleton() noexcept
+            : SkeletonBase(lap::core::InstanceSpecifier("test/frame_skeleton"))
+        {}
+        
+        SkeletonEvent<Frame> frames;
+        
+    protected:
+        Result<void> DoOfferService() noexcept override
+        {
+            SetEventOffered(frames, true);
+            return Result<void>::FromValue();
+        }
+        
+        void DoStopOfferService() noexcept override
+        {
+            SetEventOffered(frames, false);
+        }
+    };
+} // namespace
+
+/**
+ * @test FIFO order, exact (non power of two) capacity and drop-oldest overflow
+ */
+TEST(SampleQueueTest, DropOldestWhenFull)
+{
+    SampleQueue<std::unique_ptr<int>> queue(3);
+    ASSERT_TRUE(queue.IsValid());
+    EXPECT_EQ(queue.Capacity(), 3u);
+
+    for (int i = 1; i <= 3; ++i) {
+        EXPECT_EQ(queue.Push(std::make_unique<int>(i)), 0u);
+    }
+    auto extra = std::make_unique<int>(99);
+    EXPECT_FALSE(queue.TryPush(extra));
+    ASSERT_NE(extra, nullptr) << "Rejected value stays with the caller";
+
+    EXPECT_EQ(queue.Push(std::make_unique<int>(4)), 1u);
+    EXPECT_EQ(queue.Size(), 3u);
+
+    std::unique_ptr<int> value;
+    for (int expected = 2; expected <= 4; ++expected) {
+        ASSERT_TRUE(queue.TryPop(value));
+        EXPECT_EQ(*value, expected);
+    }
+    EXPECT_FALSE(queue.TryPop(value));
+    EXPECT_EQ(queue.Size(), 0u);
+
+    queue.Push(std::make_unique<int>(5));
+    queue.Clear();
+    EXPECT_EQ(queue.Size(), 0u);
+}
+
+/**
+ * @test One producer thread, one consumer thread: every element arrives in order
+ */
+TEST(SampleQueueTest, SingleProducerOrdering)
+{
+    constexpr uint64_t kCount = 200000;
+    SampleQueue<uint64_t> queue(64);
+
+    std::thread producer([&queue]() {
+        for (uint64_t i = 1; i <= kCount; ++i) {
+            uint64_t value = i;
+            while (!queue.TryPush(value)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    uint64_t expected = 1;
+    uint64_t value = 0;
+    while (expected <= kCount) {
+        if (queue.TryPop(value)) {
+            ASSERT_EQ(value, expected);
+            ++expected;
+        }
+    }
+    producer.join();
+    EXPECT_EQ(queue.Size(), 0u);
+}
+
+/**
+ * @test Several producers with overwrite: per-producer order is kept, nothing is duplicated
+ */
+TEST(SampleQueueTest, MultipleProducersDropOldest)
+{
+    constexpr uint32_t kProducers = 4;
+    constexpr uint64_t kPerProducer = 50000;
+    SampleQueue<uint64_t> queue(16, SampleQueueProducers::kMultiple);
+
+    std::atomic<uint64_t> dropped{0};
+    std::atomic<uint32_t> running{kProducers};
+    std::vector<std::thread> producers;
+    for (uint32_t p = 0; p < kProducers; ++p) {
+        producers.emplace_back([&, p]() {
+            for (uint64_t i = 1; i <= kPerProducer; ++i) {
+                dropped.fetch_add(queue.Push((static_cast<uint64_t>(p) << 32) | i), std::memory_order_relaxed);
+            }
+            running.fetch_sub(1, std::memory_order_release);
+        });
+    }
+
+    std::vector<uint64_t> last(kProducers, 0);
+    uint64_t received = 0;
+    uint64_t value = 0;
+    for (;;) {
+        const bool done = running.load(std::memory_order_acquire) == 0;
+        while (queue.TryPop(value)) {
+            const uint32_t p = static_cast<uint32_t>(value >> 32);
+            const uint64_t seq = value & 0xFFFFFFFFULL;
+            ASSERT_LT(p, kProducers);
+            ASSERT_GT(seq, last[p]);
+            last[p] = seq;
+            ++received;
+        }
+        if (done) {
+            break;
+        }
+    }
+    for (auto& t : producers) {
+        t.join();
+    }
+    EXPECT_EQ(received + dropped.load(), kProducers * kPerProducer);
+}
+
+/**
+ * @test ProxyEvent: depth from Subscribe(), drop-oldest, handler and unsubscribe
+ */
+TEST(ProxyEventTest, QueueDepthFromSubscribe)
+{
+    ProxyEvent<int> event;
+    EventBinding::Deliver(event, 1);
+    EXPECT_EQ(event.GetNewSamples(), 0u) << "Samples before Subscribe() are discarded";
+    EXPECT_EQ(event.GetNextSample().Error().Value(), static_cast<int>(ComErrc::kServiceNotAvailable));
+
+    ASSERT_TRUE(event.Subscribe(2).HasValue());
+    EXPECT_EQ(event.GetSubscriptionState(), SubscriptionState::kSubscribed);
+
+    int notified = 0;
+    ASSERT_TRUE(event.SetReceiveHandler([&notified]() { ++notified; }).HasValue());
+    for (int i = 1; i <= 3; ++i) {
+        EventBinding::Deliver(event, i);
+    }
+    EXPECT_EQ(notified, 3);
+    EXPECT_EQ(event.GetNewSamples(), 2u);
+
+    auto sample = event.GetNextSample();
+    ASSERT_TRUE(sample.HasValue());
+    EXPECT_EQ(*sample.Value(), 2);
+    ASSERT_TRUE(event.GetNextSample().HasValue());
+    EXPECT_EQ(event.GetNextSample().Error().Value(), static_cast<int>(ComErrc::kMaxSamplesExceeded));
+
+    event.Unsubscribe();
+    EXPECT_EQ(event.GetSubscriptionState(), SubscriptionState::kNotSubscribed);
+    EventBinding::Deliver(event, 4);
+    EXPECT_EQ(notified, 3) << "Unsubscribe() removes the handler";
+
+    // Resubscribe with the default depth
+    ASSERT_TRUE(event.Subscribe(0).HasValue());
+    for (int i = 0; i < 300; ++i) {
+        EventBinding::Deliver(event, i);
+    }
+    EXPECT_EQ(event.GetNewSamples(), ProxyEvent<int>::kDefaultQueueDepth);
+}
+
+/**
+ * @test GetNewSamples(f, max): arrival order, batch limit, unsubscribed error
+ */
+TEST(ProxyEventTest, GetNewSamplesWithCallable)
+{
+    ProxyEvent<int> event;
+    auto unsubscribed = event.GetNewSamples([](SamplePtr<int>) {});
+    ASSERT_FALSE(unsubscribed.HasValue());
+    EXPECT_EQ(unsubscribed.Error().Value(), static_cast<int>(ComErrc::kServiceNotAvailable));
+
+    ASSERT_TRUE(event.Subscribe(8).HasValue());
+    for (int i = 1; i <= 5; ++i) {
+        EventBinding::Deliver(event, i);
+    }
+
+    std::vector<int> received;
+    auto collect = [&received](SamplePtr<int> sample) { received.push_back(*sample); };
+
+    auto first = event.GetNewSamples(collect, 3);
+    ASSERT_TRUE(first.HasValue());
+    EXPECT_EQ(first.Value(), 3u);
+    EXPECT_EQ(event.GetNewSamples(), 2u);
+
+    auto rest = event.GetNewSamples(collect);
+    ASSERT_TRUE(rest.HasValue());
+    EXPECT_EQ(rest.Value(), 2u);
+    EXPECT_EQ(received, (std::vector<int>{1, 2, 3, 4, 5}));
+
+    auto empty = event.GetNewSamples(collect);
+    ASSERT_TRUE(empty.HasValue());
+    EXPECT_EQ(empty.Value(), 0u);
+}
+
+/**
+ * @test SamplePool: fixed capacity, slot reuse, samples outliving the owner
+ */
+TEST(SamplePoolTest, CapacityAndLifetime)
+{
+    SamplePoolHandle pool(SamplePool::Create<uint64_t>(2));
+    ASSERT_NE(pool, nullptr);
+    EXPECT_EQ(pool->Capacity(), 2u);
+
+    auto first = MakePooledSample<uint64_t>(*pool, 1u);
+    auto second = MakePooledSample<uint64_t>(*pool, 2u);
+    ASSERT_TRUE(first && second);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(first.get()) % alignof(uint64_t), 0u);
+    EXPECT_FALSE(MakePooledSample<uint64_t>(*pool, 3u)) << "Pool is exhausted";
+
+    const uint64_t* slot = first.get();
+    first.reset();
+    auto third = MakePooledSample<uint64_t>(*pool, 3u);
+    ASSERT_TRUE(third);
+    EXPECT_EQ(third.get(), slot) << "Freed slot is reused";
+
+    // Converted to SamplePtr the sample still returns to the pool
+    SamplePtr<uint64_t> held(std::move(second));
+    EXPECT_EQ(held.get_deleter().Storage(), pool.get());
+    pool.reset();
+    EXPECT_EQ(*held, 2u) << "Samples keep the pool alive";
+    held.reset();
+    third.reset();
+
+    SamplePtr<int> heap = std::make_unique<int>(7);
+    EXPECT_EQ(heap.get_deleter().Storage(), nullptr);
+}
+
+/**
+ * @test SamplePool: concurrent acquire/recycle from several threads
+ */
+TEST(SamplePoolTest, ConcurrentAcquireRecycle)
+{
+    constexpr uint32_t kThreads = 4;
+    constexpr uint32_t kCapacity = 8;
+    SamplePoolHandle pool(SamplePool::Create<uint64_t>(kCapacity));
+    ASSERT_NE(pool, nullptr);
+
+    std::atomic<uint32_t> inUse{0};
+    std::atomic<bool> overcommitted{false};
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&, t]() {
+            for (uint64_t i = 0; i < 50000; ++i) {
+                auto sample = MakePooledSample<uint64_t>(*pool, (static_cast<uint64_t>(t) << 32) | i);
+                if (!sample) {
+                    continue;
+                }
+                if (inUse.fetch_add(1) + 1 > kCapacity) {
+                    overcommitted.store(true);
+                }
+                if (*sample != ((static_cast<uint64_t>(t) << 32) | i)) {
+                    overcommitted.store(true);
+                }
+                inUse.fetch_sub(1);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_FALSE(overcommitted.load());
+
+    std::vector<std::unique_ptr<uint64_t, SampleDeleter<uint64_t>>> all;
+    for (uint32_t i = 0; i < kCapacity; ++i) {
+        all.push_back(MakePooledSample<uint64_t>(*pool, i));
+        ASSERT_TRUE(all.back()) << "Every slot was returned";
+    }
+}
+
+/**
+ * @test SkeletonEvent::Allocate() is bounded by SetMaxSamples()
+ */
+TEST(SkeletonEventTest, AllocateFromPool)
+{
+    SkeletonEvent<int> event;
+    ASSERT_FALSE(event.SetMaxSamples(0).HasValue());
+    ASSERT_TRUE(event.SetMaxSamples(2).HasValue());
+
+    auto first = event.Allocate();
+    auto second = event.Allocate();
+    ASSERT_TRUE(first.HasValue() && second.HasValue());
+    auto third = event.Allocate();
+    ASSERT_FALSE(third.HasValue());
+    EXPECT_EQ(third.Error().Value(), static_cast<int>(ComErrc::kSampleAllocationFailure));
+
+    first.Value().reset();
+    EXPECT_TRUE(event.Allocate().HasValue()) << "A released sample frees its slot";
+}
+
+/**
+ * @test SkeletonEvent::EnableZeroCopy(): samples are built in loans and sent in place
+ */
+TEST(SkeletonEventTest, ZeroCopySendThroughLoans)
+{
+    LoanBinding plain(false);
+    SkeletonEvent<Frame> rejected;
+    EXPECT_EQ(rejected.EnableZeroCopy(plain, 1, 1, 1).Error().Value(), static_cast<int>(ComErrc::kNotSupported));
+
+    LoanBinding binding(true, 1);
+    SkeletonEvent<std::string> strings;
+    EXPECT_EQ(strings.EnableZeroCopy(binding, 1, 1, 1).Error().Value(), static_cast<int>(ComErrc::kNotSupported))
+        << "Only trivially copyable samples can live in a loan";
+
+    FrameSkeleton skeleton;
+    SkeletonEvent<Frame>& event = skeleton.frames;
+    ASSERT_TRUE(event.EnableZeroCopy(binding, 0x10, 0x20, 0x30).HasValue());
+    ASSERT_TRUE(skeleton.OfferService().HasValue());
+
+    auto loaned = event.Allocate();
+    ASSERT_TRUE(loaned.HasValue());
+    EXPECT_EQ(binding.outstanding, 1u);
+    loaned.Value()->sequence = 42;
+    std::memset(loaned.Value()->pixels, 0xAB, sizeof(Frame::pixels));
+    const void* payload = loaned.Value().get();
+
+    // The binding's only loan is taken: the next sample falls back to the pool
+    auto pooled = event.Allocate();
+    ASSERT_TRUE(pooled.HasValue());
+    EXPECT_NE(static_cast<const void*>(pooled.Value().get()), payload);
+    pooled.Value()->sequence = 7;
+
+    ASSERT_TRUE(event.Send(std::move(loaned.Value())).HasValue());
+    EXPECT_EQ(binding.loaned_sends, 1u);
+    EXPECT_EQ(binding.outstanding, 0u);
+    ASSERT_EQ(binding.sent.size(), sizeof(Frame));
+    Frame received;
+    std::memcpy(&received, binding.sent.data(), sizeof(Frame));
+    EXPECT_EQ(received.sequence, 42u);
+    EXPECT_EQ(received.pixels[59], 0xAB);
+
+    ASSERT_TRUE(event.Send(std::move(pooled.Value())).HasValue());
+    EXPECT_EQ(binding.copied_sends, 1u) << "Pool samples are copied once into the transport";
+    std::memcpy(&received, binding.sent.data(), sizeof(Frame));
+    EXPECT_EQ(received.sequence, 7u);
+
+    // Dropping a loaned sample without Send() returns the loan
+    {
+        auto dropped = event.Allocate();
+        ASSERT_TRUE(dropped.HasValue());
+        EXPECT_EQ(binding.outstanding, 1u);
+    }
+    EXPECT_EQ(binding.outstanding, 0u);
+    EXPECT_EQ(binding.released, 1u);
+    
+    // StopOfferService() withdraws the event through SkeletonBase
+    skeleton.StopOfferService();
+    auto late = event.Allocate();
+    ASSERT_TRUE(late.HasValue());
+    EXPECT_EQ(event.Send(std::move(late.Value())).Error().Value(), static_cast<int>(ComErrc::kServiceNotOffered));
+}
+
+/**
+ * @test ProxyEvent: binding samples come from the pool, overflow goes to the heap
+ */
+TEST(ProxyEventTest, PooledReceiveSamples)
+{
+    ProxyEvent<int> event;
+    ASSERT_TRUE(event.Subscribe(2).HasValue());
+
+    auto* pool = static_cast<SamplePool*>(EventBinding::DeliverPooled(event, 1));
+    ASSERT_NE(pool, nullptr);
+    EXPECT_EQ(pool->Capacity(), 4u);
+
+    // Hold two samples, queue two more: the pool (2 x depth) is now exhausted
+    auto held1 = event.GetNextSample();
+    EXPECT_EQ(EventBinding::DeliverPooled(event, 2), pool);
+    auto held2 = event.GetNextSample();
+    EXPECT_EQ(EventBinding::DeliverPooled(event, 3), pool);
+    EXPECT_EQ(EventBinding::DeliverPooled(event, 4), pool);
+    EXPECT_EQ(EventBinding::DeliverPooled(event, 5), nullptr) << "Exhausted pool falls back to the heap";
+
+    // Dropping 3 and releasing 2 return their slots
+    held2 = event.GetNextSample();
+    EXPECT_EQ(EventBinding::DeliverPooled(event, 6), pool);
+    EXPECT_EQ(EventBinding::DeliverPooled(event, 7), pool);
+
+    std::vector<int> received;
+    ASSERT_TRUE(event.GetNewSamples([&received](SamplePtr<int> sample) { received.push_back(*sample); }).HasValue());
+    EXPECT_EQ(received, (std::vector<int>{6, 7}));
+    EXPECT_EQ(*held1.Value(), 1);
+    EXPECT_EQ(*held2.Value(), 4);
+}
+
+/**
+ * @test ProxyEvent: the receive pool is bounded by kMaxPoolBytes as well as by count
+ */
+TEST(ProxyEventTest, ReceivePoolBoundedByBytes)
+{
+    struct Image
+    {
+        uint8_t bytes[1U << 20];
+    };
+    ProxyEvent<Image> images;
+    ASSERT_TRUE(images.Subscribe(0).HasValue());
+    auto* pool = static_cast<SamplePool*>(EventBinding::PoolOf(images));
+    ASSERT_NE(pool, nullptr);
+    EXPECT_EQ(pool->Capacity(), ProxyEvent<Image>::kMaxPoolBytes / sizeof(Image));
+
+    struct Frame8M
+    {
+        uint8_t bytes[8U << 20];
+    };
+    ProxyEvent<Frame8M> frames;
+    ASSERT_TRUE(frames.Subscribe(2).HasValue());
+    EXPECT_EQ(EventBinding::PoolOf(frames), nullptr) << "Samples larger than kMaxPoolBytes come from the heap";
+}
+
+/**
+ * @test ProxyEvent::EnableZeroCopy(): received samples point into transport memory
+ */
+TEST(ProxyEventTest, ZeroCopyReceiveBorrowsPayload)
+{
+    LoanBinding plain(false);
+    ProxyEvent<Frame> rejected;
+    EXPECT_EQ(rejected.EnableZeroCopy(plain, 1, 1, 1).Error().Value(), static_cast<int>(ComErrc::kNotSupported));
+    EXPECT_FALSE(plain.Subscribed());
+
+    LoanBinding binding;
+    ProxyEvent<std::string> strings;
+    EXPECT_EQ(strings.EnableZeroCopy(binding, 1, 1, 1).Error().Value(), static_cast<int>(ComErrc::kNotSupported))
+        << "Only trivially copyable samples can be borrowed";
+    {
+        ProxyEvent<Frame> event;
+        ASSERT_TRUE(event.Subscribe(4).HasValue());
+        ASSERT_TRUE(event.EnableZeroCopy(binding, 0x10, 0x20, 0x30).HasValue());
+        ASSERT_TRUE(binding.Subscribed());
+        EXPECT_EQ(EventBinding::PoolOf(event), nullptr) << "No receive pool in zero-copy mode";
+
+        Frame frame{};
+        frame.sequence = 42;
+        frame.pixels[59] = 0xAB;
+        const void* payload = binding.Receive(&frame, sizeof(frame));
+        EXPECT_EQ(binding.borrowed, 1u);
+
+        auto sample = event.GetNextSample();
+        ASSERT_TRUE(sample.HasValue());
+        EXPECT_EQ(static_cast<const void*>(sample.Value().get()), payload) << "No copy out of the transport";
+        EXPECT_EQ(sample.Value()->sequence, 42u);
+        EXPECT_EQ(sample.Value()->pixels[59], 0xAB);
+        sample.Value().reset();
+        EXPECT_EQ(binding.borrowed, 0u) << "Dropping the sample returns the payload";
+
+        // A misaligned payload is copied into a heap sample and returned at once
+        frame.sequence = 43;
+        payload = binding.Receive(&frame, sizeof(frame), 1);
+        EXPECT_EQ(binding.borrowed, 0u);
+        sample = event.GetNextSample();
+        ASSERT_TRUE(sample.HasValue());
+        EXPECT_NE(static_cast<const void*>(sample.Value().get()), payload);
+        EXPECT_EQ(sample.Value()->sequence, 43u);
+
+        // A payload of the wrong size is returned and not delivered
+        binding.Receive(&frame, sizeof(frame) - 1);
+        EXPECT_EQ(binding.borrowed, 0u);
+        EXPECT_EQ(event.GetNewSamples(), 0u);
+
+        // Samples still queued are returned when the event goes away
+        binding.Receive(&frame, sizeof(frame));
+        binding.Receive(&frame, sizeof(frame));
+        EXPECT_EQ(binding.borrowed, 2u);
+    }
+    EXPECT_EQ(binding.borrowed, 0u);
+    EXPECT_FALSE(binding.Subscribed());
+}
+
+/**
+ * @test ProxyEvent::EnableZeroCopy(): the queue depth must fit the transport's borrow limit
+ */
+TEST(ProxyEventTest, ZeroCopyDepthWithinBorrowLimit)
+{
+    LoanBinding binding;
+    binding.max_borrowed = 2;
+    {
+        ProxyEvent<Frame> deep;
+        ASSERT_TRUE(deep.Subscribe(4).HasValue());
+        auto rejected = deep.EnableZeroCopy(binding, 0x10, 0x20, 0x30);
+        ASSERT_FALSE(rejected.HasValue());
+        EXPECT_EQ(rejected.Error().Value(), static_cast<int>(ComErrc::kInvalidArgument));
+        EXPECT_FALSE(binding.Subscribed());
+    }
+
+    ProxyEvent<Frame> event;
+    ASSERT_TRUE(event.EnableZeroCopy(binding, 0x10, 0x20, 0x30).HasValue());
+    EXPECT_EQ(event.Subscribe(3).Error().Value(), static_cast<int>(ComErrc::kInvalidArgument));
+    EXPECT_FALSE(event.Subscribe(0).HasValue()) << "kDefaultQueueDepth exceeds the limit";
+    EXPECT_EQ(event.GetSubscriptionState(), SubscriptionState::kNotSubscribed);
+    ASSERT_TRUE(event.Subscribe(2).HasValue());
+
+    // A full queue drops (returns) the oldest: never more than the limit borrowed
+    Frame frame{};
+    for (uint32_t i = 0; i < 3; ++i) {
+        frame.sequence = i;
+        binding.Receive(&frame, sizeof(frame));
+    }
+    EXPECT_EQ(binding.borrowed, 2u);
+    auto sample = event.GetNextSample();
+    ASSERT_TRUE(sample.HasValue());
+    EXPECT_EQ(sample.Value()->sequence, 1u);
+}
+
+/**
+ * @test ProxyEvent: resubscribing with a new depth while the zero-copy listener keeps delivering
+ */
+TEST(ProxyEventTest, ZeroCopyResubscribeWhileDelivering)
+{
+    ListenerBinding binding;
+    {
+        ProxyEvent<Frame> event;
+        ASSERT_TRUE(event.Subscribe(2).HasValue());
+        ASSERT_TRUE(event.EnableZeroCopy(binding, 0x10, 0x20, 0x30).HasValue());
+        binding.Start<Frame>();
+
+        for (uint32_t round = 0; round < 200; ++round) {
+            event.Unsubscribe();
+            // Each depth differs from the last: the ring and pool are replaced
+            ASSERT_TRUE(event.Subscribe(2 + round % 5).HasValue());
+            auto sample = event.GetNextSample();
+            std::this_thread::yield();
+        }
+        binding.Stop();
+        EXPECT_GT(binding.delivered.load(), 0u);
+    }
+    EXPECT_EQ(binding.in_flight.load(), 0) << "Every borrowed payload was returned";
+}
+
+/**
+ * @test ProxyEvent fed from a binding thread while the application polls
+ */
+TEST(ProxyEventTest, BindingThreadToConsumer)
+{
+    constexpr int kCount = 100000;
+    ProxyEvent<int> event;
+    ASSERT_TRUE(event.Subscribe(kCount).HasValue());
+
+    std::thread binding([&event]() {
+        for (int i = 0; i < kCount; ++i) {
+            EventBinding::Deliver(event, i);
+        }
+    });
+
+    int expected = 0;
+    while (expected < kCount) {
+        auto sample = event.GetNextSample();
+        if (sample.HasValue()) {
+            ASSERT_EQ(*sample.Value(), expected);
+            ++expected;
+        }
+    }
+    binding.join();
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
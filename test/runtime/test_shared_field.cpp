@@ -0,0 +1,152 @@
+/**
+ * @file        test_shared_field.cpp
+ * @author      LightAP Development Team
+ * @brief       Unit tests for field values shared through SeqLocked shared memory
+ * @date        2025-11-20
+ * @details     Tests SharedFieldValue (writer/reader roles, layout checks, restart)
+ *              and the SkeletonField::EnableSharedValue / ProxyField::AttachSharedValue
+ *              path, including a reader in a forked process.
+ * @copyright   Copyright (c) 2025
+ * sdk:
+ * platform:    Linux 5.10+
+ * project:     LightAP
+ * @version
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author          <th>Description
+ * <tr><td>2025/11/20  <td>1.0      <td>LightAP Team    <td>Initial shared field tests
+ * </table>
+ */
+
+#include "Field.hpp"
+#include "SharedFieldValue.hpp"
+
+#include <gtest/gtest.h>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace lap::com;
+
+namespace
+{
+    struct VehicleState
+    {
+        double speed;
+        double yaw_rate;
+        uint32_t gear;
+        uint32_t sequence;
+    };
+
+    class SharedFieldTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            MakeSharedFieldName(name_, 0x0100, static_cast<lap::core::UInt16>(getpid()), 1);
+            SharedFieldValue<VehicleState>::Unlink(name_);
+        }
+
+        void TearDown() override
+        {
+            SharedFieldValue<VehicleState>::Unlink(name_);
+        }
+
+        char name_[FIELD_NAME_SIZE]{};
+    };
+}
+
+/**
+ * @test Writer publishes, reader maps read-only and loads the newest value
+ */
+TEST_F(SharedFieldTest, WriterAndReader)
+{
+    SharedFieldValue<VehicleState> reader;
+    EXPECT_EQ(reader.Open(name_).Error().Value(), static_cast<int>(ComErrc::kServiceNotAvailable));
+
+    SharedFieldValue<VehicleState> writer;
+    ASSERT_TRUE(writer.Create(name_).HasValue());
+    EXPECT_TRUE(writer.IsWriter());
+
+    ASSERT_TRUE(reader.Open(name_).HasValue());
+    EXPECT_FALSE(reader.IsWriter());
+    EXPECT_EQ(reader.Load().Error().Value(), static_cast<int>(ComErrc::kFieldValueIsNotValid));
+    EXPECT_EQ(reader.Store(VehicleState{}).Error().Value(), static_cast<int>(ComErrc::kInvalidState));
+
+    ASSERT_TRUE(writer.Store(VehicleState{12.5, 0.1, 3, 1}).HasValue());
+    ASSERT_TRUE(writer.Store(VehicleState{13.0, 0.2, 3, 2}).HasValue());
+    auto value = reader.Load();
+    ASSERT_TRUE(value.HasValue());
+    EXPECT_DOUBLE_EQ(value.Value().speed, 13.0);
+    EXPECT_EQ(value.Value().sequence, 2u);
+    EXPECT_EQ(reader.Version(), 2u);
+
+    // Single writer per object
+    SharedFieldValue<VehicleState> second;
+    EXPECT_EQ(second.Create(name_).Error().Value(), static_cast<int>(ComErrc::kInvalidState));
+
+    // A restarted writer keeps the value and continues the versions
+    writer.Close();
+    ASSERT_TRUE(second.Create(name_).HasValue());
+    EXPECT_EQ(second.Version(), 2u);
+    ASSERT_TRUE(second.Store(VehicleState{14.0, 0.0, 4, 3}).HasValue());
+    EXPECT_EQ(reader.Version(), 3u);
+
+    // Different value type under the same name is rejected
+    SharedFieldValue<uint64_t> mismatched;
+    EXPECT_EQ(mismatched.Open(name_).Error().Value(), static_cast<int>(ComErrc::kInvalidArgument));
+}
+
+/**
+ * @test Non trivially copyable field types are not shared
+ */
+TEST_F(SharedFieldTest, NonTrivialTypeNotSupported)
+{
+    SharedFieldValue<std::string> value;
+    EXPECT_EQ(value.Create(name_).Error().Value(), static_cast<int>(ComErrc::kNotSupported));
+    EXPECT_FALSE(value.IsOpen());
+
+    SkeletonField<std::string> field(true, false, false);
+    EXPECT_FALSE(field.EnableSharedValue(name_).HasValue());
+}
+
+/**
+ * @test ProxyField::Get() in another process reads SkeletonField::Update() values
+ */
+TEST_F(SharedFieldTest, ProxyGetFromSkeletonUpdate)
+{
+    // Getter-only field without notifier: Update() is accepted once shared
+    SkeletonField<VehicleState> skeleton(true, false, false);
+    EXPECT_FALSE(skeleton.Update(VehicleState{}).HasValue());
+    ASSERT_TRUE(skeleton.EnableSharedValue(name_).HasValue());
+    ASSERT_TRUE(skeleton.Update(VehicleState{27.0, 0.05, 5, 42}).HasValue());
+
+    const pid_t child = fork();
+    ASSERT_GE(child, 0);
+    if (child == 0) {
+        ProxyField<VehicleState> proxy(true, false, false);
+        if (!proxy.AttachSharedValue(name_).HasValue()) {
+            _exit(1);
+        }
+        // Not connected to any transport: served from shared memory
+        auto value = proxy.Get();
+        _exit(value.HasValue() && value.Value().sequence == 42 && value.Value().gear == 5 ? 0 : 2);
+    }
+
+    int status = 0;
+    ASSERT_EQ(waitpid(child, &status, 0), child);
+    ASSERT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(WEXITSTATUS(status), 0);
+
+    // Detached proxy falls back to the (unconnected) transport path
+    ProxyField<VehicleState> proxy(true, false, false);
+    ASSERT_TRUE(proxy.AttachSharedValue(name_).HasValue());
+    ASSERT_TRUE(proxy.Get().HasValue());
+    proxy.DetachSharedValue();
+    EXPECT_EQ(proxy.Get().Error().Value(), static_cast<int>(ComErrc::kServiceNotAvailable));
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -14,6 +14,7 @@
 #include <gtest/gtest.h>
 #include "RegistryInitializer.hpp"
 #include "SharedMemoryRegistry.hpp"
+#include "ComTypes.hpp"
 
 #include <sys/wait.h>
 #include <unistd.h>
@@ -258,6 +259,130 @@ TEST_F(MultiProcessRegistryTest, CrossProcessServiceDiscovery)
     waitpid(server_pid, &status, 0);
 }
 
+// Test 4: Slots of a crashed owner are reclaimed by the server
+TEST_F(MultiProcessRegistryTest, CrashedOwnerSlotsReaped)
+{
+    pid_t server_pid = fork();
+    if (server_pid == 0)
+    {
+        RegistryInitializer server(RegistryType::QM, kSocketPath);
+        server.Initialize();
+        
+        std::thread shutdown_thread([&server]() {
+            std::this_thread::sleep_for(5s);
+            server.Shutdown();
+        });
+        
+        server.Run(false);
+        shutdown_thread.join();
+        exit(0);
+    }
+    
+    std::this_thread::sleep_for(500ms);
+    
+    // Owner process: register and die without unregistering
+    pid_t owner_pid = fork();
+    if (owner_pid == 0)
+    {
+        SingleRegistry registry(RegistryType::QM);
+        registry.InitializeFromSocket(kSocketPath);
+        auto result = registry.RegisterService(0x2001, 1, 1, 0, "dds", "crash_topic");
+        _exit(result.HasValue() ? 0 : 1);
+    }
+    
+    int status;
+    waitpid(owner_pid, &status, 0);
+    ASSERT_EQ(WEXITSTATUS(status), 0);
+    
+    SingleRegistry registry(RegistryType::QM);
+    ASSERT_TRUE(registry.InitializeFromSocket(kSocketPath).HasValue());
+    
+    // Reaper must notice the dead owner within one reap interval (+ margin)
+    bool reaped = false;
+    for (int i = 0; i < 100 && !reaped; ++i)
+    {
+        reaped = !registry.FindService(0x2001).has_value();
+        if (!reaped)
+        {
+            std::this_thread::sleep_for(10ms);
+        }
+    }
+    EXPECT_TRUE(reaped);
+    
+    kill(server_pid, SIGTERM);
+    waitpid(server_pid, &status, 0);
+}
+
+// Test 5: Server grows a full registry into a larger memfd, clients follow
+TEST_F(MultiProcessRegistryTest, OnlineResizeMigratesClients)
+{
+    pid_t server_pid = fork();
+    if (server_pid == 0)
+    {
+        RegistryInitializer server(RegistryType::QM, kSocketPath);
+        server.SetSlotCount(16, 64);
+        server.Initialize();
+        
+        std::thread shutdown_thread([&server]() {
+            std::this_thread::sleep_for(5s);
+            server.Shutdown();
+        });
+        
+        server.Run(false);
+        shutdown_thread.join();
+        exit(0);
+    }
+    
+    std::this_thread::sleep_for(500ms);
+    
+    SingleRegistry registry(RegistryType::QM);
+    ASSERT_TRUE(registry.InitializeFromSocket(kSocketPath).HasValue());
+    ASSERT_EQ(registry.GetSlotCount(), 16u);
+    
+    // 12 of 16 slots = GROW_LOAD_PERCENT: the server doubles the registry
+    constexpr uint64_t kServices = 12;
+    for (uint64_t i = 0; i < kServices; ++i)
+    {
+        ASSERT_TRUE(registry.RegisterService(0x3000 + i, i, 1, 0, "dds", "resize").HasValue());
+    }
+    
+    bool retired = false;
+    for (int i = 0; i < 200 && !retired; ++i)
+    {
+        retired = registry.IsRetired();
+        if (!retired)
+        {
+            std::this_thread::sleep_for(10ms);
+        }
+    }
+    ASSERT_TRUE(retired);
+    
+    // Writes to the retired registry are refused, lookups still see the old contents
+    auto late = registry.RegisterService(0x3FFF, 1, 1, 0, "dds", "late");
+    ASSERT_FALSE(late.HasValue());
+    EXPECT_EQ(late.Error().Value(), static_cast<int>(lap::com::ComErrc::kRegistryRetired));
+    EXPECT_TRUE(registry.FindService(0x3000).has_value());
+    
+    // A reconnecting client gets the successor with every instance carried over
+    SingleRegistry successor(RegistryType::QM);
+    ASSERT_TRUE(successor.InitializeFromSocket(kSocketPath).HasValue());
+    EXPECT_EQ(successor.GetSlotCount(), 32u);
+    EXPECT_EQ(successor.GetEpoch(), 1u);
+    EXPECT_FALSE(successor.IsRetired());
+    for (uint64_t i = 0; i < kServices; ++i)
+    {
+        auto found = successor.FindService(0x3000 + i);
+        ASSERT_TRUE(found.has_value()) << "Missing service " << i;
+        EXPECT_EQ(found.value().instance_id, i);
+        EXPECT_EQ(found.value().owner_pid, getpid());
+    }
+    EXPECT_TRUE(successor.RegisterService(0x3FFF, 1, 1, 0, "dds", "late").HasValue());
+    
+    int status;
+    kill(server_pid, SIGTERM);
+    waitpid(server_pid, &status, 0);
+}
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);